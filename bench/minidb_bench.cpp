@@ -0,0 +1,372 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <thread>
+#include <vector>
+#include "data_manager.hpp"
+#include "workload.hpp"
+using namespace std;
+
+// minidb_bench 在合成的 student/course/enrollment 数据上对 MiniDB 的各个操作做微基准测试，结果以 JSON 输出：
+//   insert —— insertIntoTable 按批装入三张表，每批一个样本
+//   select —— 单表扫描 SELECT ... WHERE GPA > x AND Major = 'y'
+//   join   —— student 与 enrollment 的 INNER JOIN，WHERE 选出一个姓名
+//   update —— 按主键更新一行的 GPA（student.ID 上有哈希索引）
+//   delete —— 按主键删除一行
+//   save   —— saveDatabase 写出整个数据库（检查点）
+//   load   —— 新的 MiniDB 中 loadDatabase 并把每张表读入内存
+// SELECT、连接、UPDATE 和 DELETE 以 SQL 文本经 MiniDB::run 执行，相同形状的语句走计划缓存，查询结果的编码计入耗时但不输出
+
+namespace
+{
+    const char *const DATABASE = "bench";
+    const char *const ALL_BENCHMARKS = "insert,select,join,update,delete,save,load";
+
+    struct Options
+    {
+        size_t rows = 100000;
+        size_t ops = 50;
+        size_t repeat = 3;
+        size_t batch = 1000;
+        uint64_t seed = 42;
+        size_t threads = 0;
+        string walSync = "OFF";
+        string benchmarks = ALL_BENCHMARKS;
+        string dir = "minidb_bench_data";
+        string output;
+        string emitSql;
+    };
+
+    // 一个基准的结果：每次操作的耗时（微秒）、处理的行数和结束时进程的峰值内存
+    struct Result
+    {
+        string name;
+        vector<double> latencies;
+        double seconds = 0;
+        uint64_t rows = 0;
+        long peakRssKb = 0;
+    };
+
+    // 类 NullBuffer 丢弃写入的所有字节，测试期间代替标准输出
+    class NullBuffer : public streambuf
+    {
+    protected:
+        int overflow(int c) override { return c; }
+        streamsize xsputn(const char *, streamsize n) override { return n; }
+    };
+
+    long peakRssKb()
+    {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    void usage(const char *program)
+    {
+        cerr << "Usage: " << program << " [options]\n"
+             << "  --rows N          student rows; enrollment gets 2N, course N/100 (default 100000)\n"
+             << "  --ops N           operations timed by select, join, update and delete (default 50)\n"
+             << "  --repeat N        repetitions of save and load (default 3)\n"
+             << "  --batch N         rows per INSERT batch (default 1000)\n"
+             << "  --seed N          data and query seed (default 42)\n"
+             << "  --threads N       scan threads, 0 for all hardware threads (default 0)\n"
+             << "  --wal-sync MODE   FULL, GROUP or OFF (default OFF)\n"
+             << "  --benchmarks LIST comma-separated subset of " << ALL_BENCHMARKS << "\n"
+             << "  --dir PATH        directory for the database files (default minidb_bench_data)\n"
+             << "  --output FILE     write the JSON report to FILE instead of standard output\n"
+             << "  --emit-sql FILE   write the generated data as a SQL script and exit" << endl;
+    }
+
+    bool parseOptions(int argc, char *argv[], Options &options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            string name = argv[i];
+            if (i + 1 >= argc)
+                return false;
+            string value = argv[++i];
+            char *end = nullptr;
+            unsigned long long number = strtoull(value.c_str(), &end, 10);
+            bool isNumber = !value.empty() && *end == '\0';
+            if (name == "--rows" && isNumber && number > 0)
+                options.rows = number;
+            else if (name == "--ops" && isNumber && number > 0)
+                options.ops = number;
+            else if (name == "--repeat" && isNumber && number > 0)
+                options.repeat = number;
+            else if (name == "--batch" && isNumber && number > 0)
+                options.batch = number;
+            else if (name == "--seed" && isNumber)
+                options.seed = number;
+            else if (name == "--threads" && isNumber)
+                options.threads = number;
+            else if (name == "--wal-sync" && (value == "FULL" || value == "GROUP" || value == "OFF"))
+                options.walSync = value;
+            else if (name == "--benchmarks")
+                options.benchmarks = value;
+            else if (name == "--dir")
+                options.dir = value;
+            else if (name == "--output")
+                options.output = value;
+            else if (name == "--emit-sql")
+                options.emitSql = value;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    bool selected(const Options &options, const string &name)
+    {
+        stringstream list(options.benchmarks);
+        string item;
+        while (getline(list, item, ','))
+        {
+            if (item == name)
+                return true;
+        }
+        return false;
+    }
+
+    // 函数 measure 执行 count 次 op(i)，记录每次的耗时；每次执行之前先在计时之外调用 prepare
+    Result measure(const string &name, size_t count, const function<void(size_t)> &op, const function<void()> &prepare = nullptr)
+    {
+        Result result;
+        result.name = name;
+        result.latencies.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (prepare)
+                prepare();
+            auto before = chrono::steady_clock::now();
+            op(i);
+            double elapsed = chrono::duration<double, micro>(chrono::steady_clock::now() - before).count();
+            result.latencies.push_back(elapsed);
+            result.seconds += elapsed / 1e6;
+        }
+        result.peakRssKb = peakRssKb();
+        return result;
+    }
+
+    // 函数 percentile 按最近秩法取第 p 百分位，sorted 已升序排列
+    double percentile(const vector<double> &sorted, double p)
+    {
+        if (sorted.empty())
+            return 0;
+        size_t rank = static_cast<size_t>(p / 100 * sorted.size() + 0.999999);
+        return sorted[min(sorted.size(), max<size_t>(rank, 1)) - 1];
+    }
+
+    void writeNumber(ostream &out, double value)
+    {
+        char text[32];
+        snprintf(text, sizeof(text), "%.3f", value);
+        out << text;
+    }
+
+    void writeReport(ostream &out, const Options &options, const Workload &workload, const vector<Result> &results)
+    {
+        const WorkloadShape &shape = workload.shape();
+        out << "{\n"
+            << "  \"rows\": " << options.rows << ",\n"
+            << "  \"seed\": " << options.seed << ",\n"
+            << "  \"threads\": " << (options.threads != 0 ? options.threads : thread::hardware_concurrency()) << ",\n"
+            << "  \"wal_sync\": \"" << options.walSync << "\",\n"
+            << "  \"tables\": {\"student\": " << shape.students << ", \"course\": " << shape.courses << ", \"enrollment\": " << shape.enrollments << "},\n"
+            << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result &result = results[i];
+            vector<double> sorted = result.latencies;
+            sort(sorted.begin(), sorted.end());
+            double total = 0;
+            for (double latency : sorted)
+                total += latency;
+            out << (i > 0 ? ",\n" : "\n") << "    {\"name\": \"" << result.name << "\", \"ops\": " << sorted.size() << ", \"rows\": " << result.rows << ", \"seconds\": ";
+            writeNumber(out, result.seconds);
+            out << ", \"ops_per_sec\": ";
+            writeNumber(out, result.seconds > 0 ? sorted.size() / result.seconds : 0);
+            out << ", \"rows_per_sec\": ";
+            writeNumber(out, result.seconds > 0 ? result.rows / result.seconds : 0);
+            out << ",\n     \"latency_us\": {\"mean\": ";
+            writeNumber(out, sorted.empty() ? 0 : total / sorted.size());
+            const pair<const char *, double> points[] = {{"p50", 50}, {"p90", 90}, {"p99", 99}, {"max", 100}};
+            for (const auto &point : points)
+            {
+                out << ", \"" << point.first << "\": ";
+                writeNumber(out, percentile(sorted, point.second));
+            }
+            out << "}, \"peak_rss_kb\": " << result.peakRssKb << "}";
+        }
+        out << "\n  ]\n}" << endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    Workload workload(options.rows, options.seed);
+    if (!options.emitSql.empty())
+    {
+        ofstream script(options.emitSql);
+        if (!script.is_open())
+        {
+            cerr << "Failed to open " << options.emitSql << "." << endl;
+            return 1;
+        }
+        workload.writeScript(script, DATABASE, options.batch);
+        return 0;
+    }
+
+    // 报告写到原来的标准输出或文件；数据库文件放在单独的目录中，每次从空目录开始
+    ofstream reportFile;
+    if (!options.output.empty())
+    {
+        reportFile.open(options.output);
+        if (!reportFile.is_open())
+        {
+            cerr << "Failed to open " << options.output << "." << endl;
+            return 1;
+        }
+    }
+    error_code code;
+    filesystem::create_directories(options.dir, code);
+    filesystem::current_path(options.dir, code);
+    if (code)
+    {
+        cerr << "Cannot use directory " << options.dir << ": " << code.message() << endl;
+        return 1;
+    }
+    for (const char *suffix : {".mdb", ".wal", ".txt"})
+        filesystem::remove(string(DATABASE) + suffix, code);
+
+    NullBuffer discard;
+    streambuf *stdoutBuffer = cout.rdbuf(&discard);
+    ostream console(stdoutBuffer);
+    ostream &report = options.output.empty() ? console : reportFile;
+
+    vector<Result> results;
+    mt19937_64 random(options.seed);
+    {
+        MiniDB db;
+        db.run("SET WAL_SYNC = " + options.walSync);
+        if (options.threads != 0)
+            db.run("SET THREADS = " + to_string(options.threads));
+        db.run(string("CREATE DATABASE ") + DATABASE);
+        db.run(string("USE DATABASE ") + DATABASE);
+        for (const string &statement : Workload::schema())
+            db.run(statement);
+
+        // 装入数据本身就是 insert 基准，没有选中时也要执行，只是不报告
+        vector<vector<string>> rows;
+        size_t totalRows = 0;
+        vector<pair<const char *, size_t>> batches;
+        for (const char *table : Workload::TABLES)
+        {
+            for (size_t first = 0; first < workload.tableRows(table); first += options.batch)
+                batches.emplace_back(table, first);
+            totalRows += workload.tableRows(table);
+        }
+        Result insert = measure("insert", batches.size(), [&](size_t i)
+                                {
+            workload.rowsOf(batches[i].first, batches[i].second, options.batch, rows);
+            db.insertIntoTable(batches[i].first, rows); });
+        insert.rows = totalRows;
+        if (selected(options, "insert"))
+            results.push_back(insert);
+
+        if (selected(options, "select"))
+        {
+            results.push_back(measure("select", options.ops, [&](size_t)
+                                      {
+                char threshold[16];
+                snprintf(threshold, sizeof(threshold), "%.2f", 3.90 + random() % 10 / 100.0);
+                db.run(string("SELECT ID, Name, GPA FROM student WHERE GPA > ") + threshold + " AND Major = '" +
+                       Workload::majorAt(random() % Workload::majorCount()) + "'"); }));
+            results.back().rows = options.ops * workload.shape().students;
+        }
+        if (selected(options, "join"))
+        {
+            results.push_back(measure("join", options.ops, [&](size_t)
+                                      { db.run("SELECT student.Name, enrollment.CourseID FROM student INNER JOIN enrollment ON student.ID = enrollment.StudentID "
+                                               "WHERE student.Name = '" +
+                                               Workload::nameAt(random() % Workload::nameCount()) + "'"); }));
+            results.back().rows = options.ops * (workload.shape().students + workload.shape().enrollments);
+        }
+
+        // UPDATE 和 DELETE 按主键定位一行，用 student.ID 上的哈希索引；每个 ID 只删除一次
+        if (selected(options, "update") || selected(options, "delete"))
+            db.run("CREATE INDEX student_id ON student(ID)");
+        if (selected(options, "update"))
+        {
+            results.push_back(measure("update", options.ops, [&](size_t)
+                                      {
+                char gpa[16];
+                snprintf(gpa, sizeof(gpa), "%.2f", (200 + random() % 201) / 100.0);
+                db.run(string("UPDATE student SET GPA = ") + gpa + " WHERE ID = " + to_string(1 + random() % workload.shape().students)); }));
+            results.back().rows = options.ops;
+        }
+        if (selected(options, "delete"))
+        {
+            set<size_t> ids;
+            size_t count = min(options.ops, workload.shape().students);
+            while (ids.size() < count)
+                ids.insert(1 + random() % workload.shape().students);
+            vector<size_t> order(ids.begin(), ids.end());
+            shuffle(order.begin(), order.end(), random);
+            results.push_back(measure("delete", count, [&](size_t i)
+                                      { db.run("DELETE FROM student WHERE ID = " + to_string(order[i])); }));
+            results.back().rows = count;
+        }
+
+        // save 之后数据库文件包含全部数据，load 从它读取
+        bool save = selected(options, "save");
+        Result saved = measure("save", save ? options.repeat : 1, [&](size_t)
+                               { db.saveDatabase(DATABASE); });
+        saved.rows = totalRows;
+        if (save)
+            results.push_back(saved);
+    }
+    if (selected(options, "load"))
+    {
+        // 上一次读入的 MiniDB 在计时之外释放
+        unique_ptr<MiniDB> fresh;
+        uint64_t loadedRows = 0;
+        results.push_back(measure("load", options.repeat, [&](size_t)
+                                  {
+            fresh = make_unique<MiniDB>();
+            fresh->loadDatabase(DATABASE);
+            fresh->useDatabase(DATABASE);
+            string message;
+            loadedRows = 0;
+            for (auto &tablePair : fresh->getCurrentDatabase()->tables)
+            {
+                if (!tablePair.second.materialize(message))
+                    cerr << message << endl;
+                loadedRows += tablePair.second.rowCount;
+            } }, [&]()
+                                  { fresh.reset(); }));
+        results.back().rows = loadedRows;
+    }
+
+    cout.rdbuf(stdoutBuffer);
+    writeReport(report, options, workload, results);
+    return 0;
+}
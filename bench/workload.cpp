@@ -0,0 +1,166 @@
+#include "workload.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    const char *const FIRST_NAMES[] = {
+        "Alice", "Bob", "Catherine", "Dave", "Eva", "Frank", "Grace", "Henry", "Irene", "Jack",
+        "Karen", "Leo", "Maria", "Nathan", "Olivia", "Peter", "Quinn", "Rachel", "Sam", "Tina",
+        "Umar", "Vera", "Walter", "Xenia", "Yusuf", "Zoe", "Amir", "Bianca", "Chen", "Diana",
+        "Emil", "Fatima", "Gustav", "Hana", "Ivan", "Julia", "Kenji", "Lena", "Mateo", "Nora"};
+    const char *const LAST_NAMES[] = {
+        "Johnson", "Smith", "Lee", "Brown", "White", "Garcia", "Miller", "Davis", "Wilson", "Moore",
+        "Taylor", "Anderson", "Thomas", "Jackson", "Martin", "Thompson", "Clark", "Lewis", "Walker", "Hall",
+        "Young", "King", "Wright", "Lopez", "Hill", "Scott", "Green", "Adams", "Baker", "Nelson",
+        "Carter", "Mitchell", "Perez", "Roberts", "Turner", "Phillips", "Campbell", "Parker", "Evans", "Edwards"};
+    const char *const MAJORS[] = {
+        "Computer Science", "Electrical Engineering", "Mathematics", "Physics", "Chemistry", "Biology",
+        "Economics", "History", "Philosophy", "Psychology", "Statistics", "Mechanical Engineering"};
+    const char *const COURSE_PREFIXES[] = {"Introduction to", "Advanced", "Topics in", "Seminar in"};
+
+    const size_t FIRST_COUNT = sizeof(FIRST_NAMES) / sizeof(FIRST_NAMES[0]);
+    const size_t LAST_COUNT = sizeof(LAST_NAMES) / sizeof(LAST_NAMES[0]);
+    const size_t MAJOR_COUNT = sizeof(MAJORS) / sizeof(MAJORS[0]);
+    const size_t PREFIX_COUNT = sizeof(COURSE_PREFIXES) / sizeof(COURSE_PREFIXES[0]);
+    const size_t FIRST_COURSE_ID = 101;
+
+    // 函数 splitMix 是 SplitMix64 的一步，把任意输入打散为均匀的 64 位数
+    uint64_t splitMix(uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ULL;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    std::string quoted(const std::string &text)
+    {
+        return "'" + text + "'";
+    }
+
+    int tableId(const std::string &table)
+    {
+        for (int id = 0; id < 3; ++id)
+        {
+            if (table == Workload::TABLES[id])
+                return id;
+        }
+        return -1;
+    }
+}
+
+const char *const Workload::TABLES[3] = {"student", "course", "enrollment"};
+
+WorkloadShape workloadShape(size_t rows)
+{
+    WorkloadShape shape;
+    shape.students = rows;
+    shape.courses = std::max<size_t>(16, rows / 100);
+    shape.enrollments = 2 * rows;
+    return shape;
+}
+
+Workload::Workload(size_t rows, uint64_t workloadSeed) : size(workloadShape(rows)), seed(workloadSeed)
+{
+}
+
+size_t Workload::tableRows(const std::string &table) const
+{
+    switch (tableId(table))
+    {
+    case 0:
+        return size.students;
+    case 1:
+        return size.courses;
+    case 2:
+        return size.enrollments;
+    default:
+        return 0;
+    }
+}
+
+std::vector<std::string> Workload::schema()
+{
+    return {"CREATE TABLE student (ID INTEGER, Name TEXT, GPA FLOAT, Major TEXT)",
+            "CREATE TABLE course (CourseID INTEGER, CourseName TEXT, Department TEXT)",
+            "CREATE TABLE enrollment (StudentID INTEGER, CourseID INTEGER)"};
+}
+
+uint64_t Workload::mix(uint64_t table, uint64_t row, uint64_t field) const
+{
+    return splitMix(splitMix(seed ^ (table << 56) ^ (field << 48)) ^ row);
+}
+
+void Workload::rowsOf(const std::string &table, size_t first, size_t count, std::vector<std::vector<std::string>> &rows) const
+{
+    int id = tableId(table);
+    size_t end = std::min(tableRows(table), first + count);
+    rows.clear();
+    for (size_t row = first; row < end; ++row)
+    {
+        rows.emplace_back();
+        std::vector<std::string> &values = rows.back();
+        if (id == 0)
+        {
+            // GPA 在 2.00 到 4.00 之间，保留两位小数
+            char gpa[16];
+            std::snprintf(gpa, sizeof(gpa), "%.2f", (200 + mix(id, row, 1) % 201) / 100.0);
+            values = {std::to_string(row + 1), quoted(nameAt(mix(id, row, 0) % nameCount())), gpa, quoted(majorAt(mix(id, row, 2) % MAJOR_COUNT))};
+        }
+        else if (id == 1)
+        {
+            std::string department = MAJORS[row % MAJOR_COUNT];
+            std::string name = std::string(COURSE_PREFIXES[(row / MAJOR_COUNT) % PREFIX_COUNT]) + " " + department + " " + std::to_string(FIRST_COURSE_ID + row);
+            values = {std::to_string(FIRST_COURSE_ID + row), quoted(name), quoted(department)};
+        }
+        else
+        {
+            values = {std::to_string(1 + mix(id, row, 0) % size.students), std::to_string(FIRST_COURSE_ID + mix(id, row, 1) % size.courses)};
+        }
+    }
+}
+
+void Workload::writeScript(std::ostream &out, const std::string &database, size_t batch) const
+{
+    out << "CREATE DATABASE " << database << ";\nUSE DATABASE " << database << ";\n";
+    for (const std::string &statement : schema())
+        out << statement << ";\n";
+    std::vector<std::vector<std::string>> rows;
+    for (const char *table : TABLES)
+    {
+        for (size_t first = 0; first < tableRows(table); first += batch)
+        {
+            rowsOf(table, first, batch, rows);
+            out << "INSERT INTO " << table << " VALUES ";
+            for (size_t i = 0; i < rows.size(); ++i)
+            {
+                out << (i > 0 ? ", (" : "(");
+                for (size_t j = 0; j < rows[i].size(); ++j)
+                    out << (j > 0 ? ", " : "") << rows[i][j];
+                out << ')';
+            }
+            out << ";\n";
+        }
+    }
+}
+
+size_t Workload::nameCount()
+{
+    return FIRST_COUNT * LAST_COUNT;
+}
+
+std::string Workload::nameAt(size_t index)
+{
+    return std::string(FIRST_NAMES[index % FIRST_COUNT]) + " " + LAST_NAMES[index / FIRST_COUNT % LAST_COUNT];
+}
+
+size_t Workload::majorCount()
+{
+    return MAJOR_COUNT;
+}
+
+std::string Workload::majorAt(size_t index)
+{
+    return MAJORS[index % MAJOR_COUNT];
+}
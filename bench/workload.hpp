@@ -0,0 +1,53 @@
+#ifndef WORKLOAD_HPP
+#define WORKLOAD_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 合成数据的规模：student 表 rows 行，每个学生平均选两门课（enrollment 表 2 * rows 行），
+// 每 100 个学生开一门课（course 表 rows / 100 行，至少 16 行）
+struct WorkloadShape
+{
+    size_t students = 0;
+    size_t courses = 0;
+    size_t enrollments = 0;
+};
+
+WorkloadShape workloadShape(size_t rows);
+
+// 类 Workload 按种子确定地生成 test0.sql 中 student、course、enrollment 三张表的数据。
+// 每一行只由种子和行号决定，与生成的顺序和批大小无关，同样的参数在任何机器上得到相同的数据
+class Workload
+{
+public:
+    static const char *const TABLES[3];
+
+    Workload(size_t rows, uint64_t seed);
+    const WorkloadShape &shape() const { return size; }
+    uint64_t getSeed() const { return seed; }
+    // 函数 tableRows 返回表 table 的总行数
+    size_t tableRows(const std::string &table) const;
+    // 函数 schema 返回建立三张表的 CREATE TABLE 语句
+    static std::vector<std::string> schema();
+    // 函数 rowsOf 生成表 table 的第 first 行起的 count 行，值的写法与 INSERT 相同（TEXT 带引号）
+    void rowsOf(const std::string &table, size_t first, size_t count, std::vector<std::vector<std::string>> &rows) const;
+    // 函数 writeScript 把建库、建表和全部数据写成 minidb 可以直接执行的 SQL 脚本，每条 INSERT 插入 batch 行
+    void writeScript(std::ostream &out, const std::string &database, size_t batch) const;
+
+    // 以下供基准测试生成查询条件：学生的 Name 和 Major 取自固定的名单
+    static size_t nameCount();
+    static std::string nameAt(size_t index);
+    static size_t majorCount();
+    static std::string majorAt(size_t index);
+
+private:
+    WorkloadShape size;
+    uint64_t seed;
+
+    // 函数 mix 返回编号为 table 的表第 row 行的第 field 个伪随机数
+    uint64_t mix(uint64_t table, uint64_t row, uint64_t field) const;
+};
+
+#endif // WORKLOAD_HPP
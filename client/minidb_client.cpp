@@ -0,0 +1,100 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include "protocol.hpp"
+using namespace std;
+
+// minidb_client 是 minidb --serve 的命令行客户端：从文件或标准输入读取 SQL，每凑齐以分号结尾的一行就作为一个请求发给服务器，
+// 把回复中的输出写到标准输出、错误信息写到标准错误。语句的切分和执行都在服务器上进行
+
+// 函数 endsStatement 扫描新读入的一行，更新引号状态，返回这一行是否在引号外以分号结尾（忽略 -- 注释和行尾空白）
+static bool endsStatement(const string &line, char &quote)
+{
+    char last = 0;
+    for (size_t i = 0; i < line.size(); ++i)
+    {
+        char c = line[i];
+        if (quote)
+        {
+            if (c == quote)
+                quote = 0;
+            last = c;
+            continue;
+        }
+        if (c == '\'' || c == '"')
+            quote = c;
+        else if (c == '-' && i + 1 < line.size() && line[i + 1] == '-')
+            break;
+        if (c != ' ' && c != '\t' && c != '\r')
+            last = c;
+    }
+    return !quote && last == ';';
+}
+
+// 函数 submit 发出一个请求并打印回复，连接断开时返回 false
+static bool submit(int fd, const string &request)
+{
+    string output, errors;
+    if (!writeFrame(fd, request) || !readFrame(fd, output) || !readFrame(fd, errors))
+    {
+        cerr << "Error: connection to server lost." << endl;
+        return false;
+    }
+    cout << output << flush;
+    cerr << errors << flush;
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 3 || (argc >= 2 && string(argv[1]) == "--help"))
+    {
+        cout << "Usage: " << argv[0] << " [address] [file.sql]" << endl;
+        return 1;
+    }
+    string address = argc >= 2 ? argv[1] : DEFAULT_SERVER_ADDRESS;
+    ifstream file;
+    if (argc == 3)
+    {
+        file.open(argv[2]);
+        if (!file.is_open())
+        {
+            cout << "File not found" << endl;
+            return 1;
+        }
+    }
+    istream &input = argc == 3 ? static_cast<istream &>(file) : cin;
+    bool interactive = argc < 3 && isatty(STDIN_FILENO);
+
+    string error;
+    int fd = connectTo(address, error);
+    if (fd < 0)
+    {
+        cerr << "Error: cannot connect to " << error << endl;
+        return 1;
+    }
+    string request, line;
+    char quote = 0;
+    if (interactive)
+        cout << "minidb> " << flush;
+    while (getline(input, line))
+    {
+        request += line;
+        request += '\n';
+        if (endsStatement(line, quote))
+        {
+            if (!submit(fd, request))
+                return 1;
+            request.clear();
+        }
+        if (interactive)
+            cout << (request.empty() ? "minidb> " : "   ...> ") << flush;
+    }
+    // 结尾缺少分号的语句也发出去，服务器照样执行
+    if (request.find_first_not_of(" \t\r\n") != string::npos && !submit(fd, request))
+        return 1;
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,309 @@
+#include "aggregate.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+namespace
+{
+    uint64_t mix(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    uint64_t floatBits(double value)
+    {
+        // -0.0 与 0.0 相等，必须落入同一个分组
+        if (value == 0)
+            value = 0;
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    bool sameValue(const ColumnData &column, size_t first, size_t second)
+    {
+        switch (column.getType())
+        {
+        case ColumnType::INTEGER:
+            return column.intAt(first) == column.intAt(second);
+        case ColumnType::FLOAT:
+            return column.floatAt(first) == column.floatAt(second);
+        default:
+            if (column.isDictionary() && column.codeAt(first) == column.codeAt(second))
+                return true;
+            return stripQuotes(column.textAt(first)) == stripQuotes(column.textAt(second));
+        }
+    }
+}
+
+ColumnType aggregateResultType(const AggregateSpec &spec)
+{
+    if (spec.function == AggregateFunction::COUNT)
+        return ColumnType::INTEGER;
+    if (spec.function == AggregateFunction::AVG)
+        return ColumnType::FLOAT;
+    return spec.column->getType();
+}
+
+std::string aggregateName(AggregateFunction function, const std::string &column)
+{
+    static const char *const names[] = {"", "COUNT", "SUM", "AVG", "MIN", "MAX"};
+    return std::string(names[static_cast<int>(function)]) + "(" + column + ")";
+}
+
+void HashAggregator::setup(const std::vector<const ColumnData *> &groupColumns, const std::vector<AggregateSpec> &aggregates)
+{
+    keys = groupColumns;
+    specs = aggregates;
+    groupRows.clear();
+    groupHashes.clear();
+    states.clear();
+    slots.assign(64, 0);
+    canonicalCodes.assign(keys.size(), {});
+    for (size_t k = 0; k < keys.size(); ++k)
+    {
+        const ColumnData &column = *keys[k];
+        if (!column.isDictionary())
+            continue;
+        // 字典按存储文本去重，'a' 与不带引号的 a 是两个字典项；把它们映射到同一个规范编码后按编码求哈希
+        std::unordered_map<std::string_view, uint16_t> firstCode;
+        std::vector<uint16_t> &canonical = canonicalCodes[k];
+        canonical.resize(column.dictionarySize());
+        for (size_t code = 0; code < canonical.size(); ++code)
+        {
+            canonical[code] = firstCode.emplace(stripQuotes(column.dictionaryText(code)), static_cast<uint16_t>(code)).first->second;
+        }
+    }
+}
+
+uint64_t HashAggregator::hashRow(size_t row) const
+{
+    uint64_t hash = 0x9e3779b97f4a7c15ULL;
+    for (size_t k = 0; k < keys.size(); ++k)
+    {
+        const ColumnData &column = *keys[k];
+        uint64_t value;
+        if (column.getType() == ColumnType::INTEGER)
+            value = static_cast<uint64_t>(column.intAt(row));
+        else if (column.getType() == ColumnType::FLOAT)
+            value = floatBits(column.floatAt(row));
+        else if (column.isDictionary())
+            value = canonicalCodes[k][column.codeAt(row)];
+        else
+            value = std::hash<std::string_view>()(stripQuotes(column.textAt(row)));
+        hash = mix(hash ^ value) + k;
+    }
+    return hash;
+}
+
+bool HashAggregator::sameGroup(size_t first, size_t second) const
+{
+    for (const ColumnData *column : keys)
+    {
+        if (!sameValue(*column, first, second))
+            return false;
+    }
+    return true;
+}
+
+void HashAggregator::growSlots()
+{
+    std::vector<uint32_t> grown(slots.size() * 2, 0);
+    size_t mask = grown.size() - 1;
+    for (size_t group = 0; group < groupRows.size(); ++group)
+    {
+        size_t slot = groupHashes[group] & mask;
+        while (grown[slot] != 0)
+            slot = (slot + 1) & mask;
+        grown[slot] = static_cast<uint32_t>(group + 1);
+    }
+    slots.swap(grown);
+}
+
+size_t HashAggregator::findOrAdd(size_t row, uint64_t hash)
+{
+    size_t mask = slots.size() - 1;
+    size_t slot = hash & mask;
+    for (; slots[slot] != 0; slot = (slot + 1) & mask)
+    {
+        size_t group = slots[slot] - 1;
+        if (groupHashes[group] == hash && sameGroup(groupRows[group], row))
+            return group;
+    }
+    size_t group = groupRows.size();
+    groupRows.push_back(row);
+    groupHashes.push_back(hash);
+    states.resize(states.size() + specs.size());
+    slots[slot] = static_cast<uint32_t>(group + 1);
+    // 装载因子超过 1/2 时扩容
+    if (groupRows.size() * 2 > slots.size())
+        growSlots();
+    return group;
+}
+
+void HashAggregator::update(State &state, const AggregateSpec &spec, size_t row) const
+{
+    const ColumnData *column = spec.column;
+    bool first = state.count++ == 0;
+    switch (spec.function)
+    {
+    case AggregateFunction::SUM:
+    case AggregateFunction::AVG:
+        if (column->getType() == ColumnType::INTEGER)
+        {
+            // 整数求和按无符号回绕，溢出时与 64 位二进制补码加法的结果一致
+            state.intValue = static_cast<int64_t>(static_cast<uint64_t>(state.intValue) + static_cast<uint64_t>(column->intAt(row)));
+            state.floatValue += static_cast<double>(column->intAt(row));
+        }
+        else
+            state.floatValue += column->floatAt(row);
+        break;
+    case AggregateFunction::MIN:
+    case AggregateFunction::MAX:
+    {
+        bool isMin = spec.function == AggregateFunction::MIN;
+        if (column->getType() == ColumnType::INTEGER)
+        {
+            int64_t value = column->intAt(row);
+            if (first || (isMin ? value < state.intValue : value > state.intValue))
+                state.intValue = value;
+        }
+        else if (column->getType() == ColumnType::FLOAT)
+        {
+            double value = column->floatAt(row);
+            if (first || (isMin ? value < state.floatValue : value > state.floatValue))
+                state.floatValue = value;
+        }
+        else
+        {
+            std::string_view value = stripQuotes(column->textAt(row));
+            std::string_view current = stripQuotes(column->textAt(state.row));
+            if (first || (isMin ? value < current : value > current))
+                state.row = row;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void HashAggregator::combine(State &into, const State &from, const AggregateSpec &spec) const
+{
+    if (from.count == 0)
+        return;
+    if (into.count == 0)
+    {
+        into = from;
+        return;
+    }
+    into.count += from.count;
+    switch (spec.function)
+    {
+    case AggregateFunction::SUM:
+    case AggregateFunction::AVG:
+        into.intValue = static_cast<int64_t>(static_cast<uint64_t>(into.intValue) + static_cast<uint64_t>(from.intValue));
+        into.floatValue += from.floatValue;
+        break;
+    case AggregateFunction::MIN:
+    case AggregateFunction::MAX:
+    {
+        bool isMin = spec.function == AggregateFunction::MIN;
+        ColumnType type = spec.column->getType();
+        if (type == ColumnType::INTEGER)
+            into.intValue = isMin ? std::min(into.intValue, from.intValue) : std::max(into.intValue, from.intValue);
+        else if (type == ColumnType::FLOAT)
+        {
+            if (isMin ? from.floatValue < into.floatValue : from.floatValue > into.floatValue)
+                into.floatValue = from.floatValue;
+        }
+        else
+        {
+            std::string_view value = stripQuotes(spec.column->textAt(from.row));
+            std::string_view current = stripQuotes(spec.column->textAt(into.row));
+            if (isMin ? value < current : value > current)
+                into.row = from.row;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void HashAggregator::add(size_t row)
+{
+    size_t group = keys.empty() && !groupRows.empty() ? 0 : findOrAdd(row, hashRow(row));
+    State *groupStates = states.data() + group * specs.size();
+    for (size_t i = 0; i < specs.size(); ++i)
+        update(groupStates[i], specs[i], row);
+}
+
+void HashAggregator::merge(const HashAggregator &partial)
+{
+    for (size_t from = 0; from < partial.groupRows.size(); ++from)
+    {
+        size_t into = findOrAdd(partial.groupRows[from], partial.groupHashes[from]);
+        for (size_t i = 0; i < specs.size(); ++i)
+            combine(states[into * specs.size() + i], partial.states[from * specs.size() + i], specs[i]);
+    }
+}
+
+void HashAggregator::result(size_t aggregate, ColumnData &out) const
+{
+    const AggregateSpec &spec = specs[aggregate];
+    if (keys.empty() && groupRows.empty())
+    {
+        if (spec.function == AggregateFunction::COUNT || spec.function == AggregateFunction::SUM)
+        {
+            out = ColumnData(aggregateResultType(spec));
+            if (out.getType() == ColumnType::INTEGER)
+                out.appendInt(0);
+            else
+                out.appendFloat(0);
+        }
+        else
+        {
+            out = ColumnData(ColumnType::TEXT);
+            out.appendText("NULL");
+        }
+        return;
+    }
+
+    out = ColumnData(aggregateResultType(spec));
+    out.reserve(groupRows.size());
+    for (size_t group = 0; group < groupRows.size(); ++group)
+    {
+        const State &state = states[group * specs.size() + aggregate];
+        switch (spec.function)
+        {
+        case AggregateFunction::COUNT:
+            out.appendInt(state.count);
+            break;
+        case AggregateFunction::SUM:
+            if (out.getType() == ColumnType::INTEGER)
+                out.appendInt(state.intValue);
+            else
+                out.appendFloat(state.floatValue);
+            break;
+        case AggregateFunction::AVG:
+            out.appendFloat(state.floatValue / static_cast<double>(state.count));
+            break;
+        default:
+            if (out.getType() == ColumnType::INTEGER)
+                out.appendInt(state.intValue);
+            else if (out.getType() == ColumnType::FLOAT)
+                out.appendFloat(state.floatValue);
+            else
+                out.appendText(spec.column->textAt(state.row));
+            break;
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef AGGREGATE_HPP
+#define AGGREGATE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "column_store.hpp"
+#include "parser.hpp"
+
+// 一个聚合函数及其输入列，COUNT(*) 的 column 为空指针
+struct AggregateSpec
+{
+    AggregateFunction function = AggregateFunction::COUNT;
+    const ColumnData *column = nullptr;
+};
+
+// 函数 aggregateResultType 返回聚合结果的类型：COUNT 为 INTEGER，AVG 为 FLOAT，SUM/MIN/MAX 与输入列相同
+ColumnType aggregateResultType(const AggregateSpec &spec);
+// 函数 aggregateName 返回结果列的列名，例如 AVG(GPA)、COUNT(*)
+std::string aggregateName(AggregateFunction function, const std::string &column);
+
+// 类 HashAggregator 是哈希聚合算子：按分组列把行归入分组，每个分组为每个聚合函数保留一个中间状态。
+// 分组只记下第一次出现的行（代表行），分组列的值从代表行读出，相等比较也与代表行比较，逐行不复制任何值；
+// 分组按第一次出现的顺序排列。并行扫描时每个 morsel 用一个复制自原型的局部聚合器，最后按 morsel 顺序 merge，
+// 结果与单线程扫描相同
+class HashAggregator
+{
+public:
+    // 函数 setup 绑定分组列和聚合函数；字典编码的分组列预先算出每个编码去掉引号后的规范编码
+    void setup(const std::vector<const ColumnData *> &groupColumns, const std::vector<AggregateSpec> &aggregates);
+    void add(size_t row);
+    // 函数 merge 把另一个局部聚合器的分组按其出现顺序并入本聚合器
+    void merge(const HashAggregator &partial);
+
+    size_t groupCount() const { return groupRows.size(); }
+    const std::vector<size_t> &getGroupRows() const { return groupRows; }
+    // 函数 result 把第 aggregate 个聚合函数在各分组上的结果依次追加到 out；
+    // 没有分组列且没有输入行时输出一行：COUNT 为 0，其余为 NULL（此时 out 为 TEXT 列）
+    void result(size_t aggregate, ColumnData &out) const;
+
+private:
+    // 一个分组中一个聚合函数的中间状态：count 为已累计的行数，SUM/AVG 累加在 intValue/floatValue 中，
+    // MIN/MAX 的当前值在 intValue/floatValue 中，TEXT 列的 MIN/MAX 记下所在的行
+    struct State
+    {
+        int64_t count = 0;
+        int64_t intValue = 0;
+        double floatValue = 0;
+        size_t row = 0;
+    };
+
+    std::vector<const ColumnData *> keys;
+    std::vector<std::vector<uint16_t>> canonicalCodes; // 与 keys 对应，非字典列为空
+    std::vector<AggregateSpec> specs;
+    std::vector<size_t> groupRows;
+    std::vector<uint64_t> groupHashes;
+    std::vector<State> states;  // 第 g 个分组的状态为 states[g * specs.size() ...]
+    std::vector<uint32_t> slots; // 开放寻址的分组表，保存分组下标 + 1，0 为空位
+
+    uint64_t hashRow(size_t row) const;
+    bool sameGroup(size_t first, size_t second) const;
+    size_t findOrAdd(size_t row, uint64_t hash);
+    void growSlots();
+    void update(State &state, const AggregateSpec &spec, size_t row) const;
+    void combine(State &into, const State &from, const AggregateSpec &spec) const;
+};
+
+#endif // AGGREGATE_HPP
@@ -0,0 +1,39 @@
+#include "arena.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+void *Arena::allocate(size_t bytes, size_t alignment)
+{
+    uintptr_t address = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    if (!cursor || address + bytes > reinterpret_cast<uintptr_t>(limit))
+    {
+        // 块从 4 KB 开始按两倍增长，小表不必预留大块；单个对象比块还大时为它单独申请
+        size_t size = std::max(nextBlock, bytes + alignment);
+        blocks.emplace_back(new unsigned char[size]);
+        cursor = blocks.back().get();
+        limit = cursor + size;
+        reserved += size;
+        nextBlock = std::min(nextBlock * 2, MAX_BLOCK);
+        address = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    }
+    cursor = reinterpret_cast<unsigned char *>(address + bytes);
+    return reinterpret_cast<void *>(address);
+}
+
+void Arena::clear()
+{
+    blocks.clear();
+    cursor = limit = nullptr;
+    nextBlock = FIRST_BLOCK;
+    reserved = 0;
+}
+
+void Arena::swap(Arena &other) noexcept
+{
+    blocks.swap(other.blocks);
+    std::swap(cursor, other.cursor);
+    std::swap(limit, other.limit);
+    std::swap(nextBlock, other.nextBlock);
+    std::swap(reserved, other.reserved);
+}
@@ -0,0 +1,43 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// 类 Arena 是按块分配的线性（bump-pointer）内存池：allocate 只在当前块内移动指针，块用完时再申请一块更大的；
+// 分配出去的内存从不单独释放，clear 或析构时整块归还。适合生命周期与所属结构相同的大量小对象，例如 B+ 树节点。
+// 放在 Arena 中的对象不会被析构，只能是平凡可析构的类型
+class Arena
+{
+public:
+    Arena() = default;
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    Arena(Arena &&other) noexcept { swap(other); }
+    Arena &operator=(Arena &&other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // 函数 allocate 返回 bytes 字节、按 alignment（2 的幂）对齐的内存
+    void *allocate(size_t bytes, size_t alignment);
+    // 函数 clear 归还所有块，之前分配的内存全部失效
+    void clear();
+    // 函数 reservedBytes 返回已向系统申请的字节数
+    size_t reservedBytes() const { return reserved; }
+    void swap(Arena &other) noexcept;
+
+private:
+    static constexpr size_t FIRST_BLOCK = 4 * 1024;
+    static constexpr size_t MAX_BLOCK = 1024 * 1024;
+
+    std::vector<std::unique_ptr<unsigned char[]>> blocks;
+    unsigned char *cursor = nullptr;
+    unsigned char *limit = nullptr;
+    size_t nextBlock = FIRST_BLOCK;
+    size_t reserved = 0;
+};
+
+#endif // ARENA_HPP
@@ -0,0 +1,394 @@
+#ifndef BPTREE_HPP
+#define BPTREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+#include "arena.hpp"
+
+// 类模板 BPlusTree 是内存中的 B+ 树，保存 (键, 行号) 对并按 (键, 行号) 排序，因此重复键也能精确删除。
+// 每个节点占固定的 4 个缓存行并按缓存行对齐；叶子节点之间用双向链表相连，支持顺序和范围扫描。
+// 删除只从叶子中移除条目、不合并节点，空叶子在扫描时跳过。节点从树自己的 Arena 中分配，从不单独释放，
+// 清空或销毁树时整块归还。
+template <typename Key>
+class BPlusTree
+{
+public:
+    struct Entry
+    {
+        Key key;
+        uint64_t row;
+
+        bool operator<(const Entry &other) const
+        {
+            return key < other.key || (!(other.key < key) && row < other.row);
+        }
+    };
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t NODE_BYTES = 4 * CACHE_LINE;
+
+    struct Node
+    {
+        bool leaf;
+        uint16_t count;
+    };
+    struct alignas(CACHE_LINE) Leaf : Node
+    {
+        static constexpr size_t CAPACITY = (NODE_BYTES - 8 - 2 * sizeof(void *)) / sizeof(Entry);
+        Leaf *prev;
+        Leaf *next;
+        Entry entries[CAPACITY];
+    };
+    struct alignas(CACHE_LINE) Inner : Node
+    {
+        static constexpr size_t CAPACITY = (NODE_BYTES - 8 - sizeof(Node *)) / (sizeof(Entry) + sizeof(Node *));
+        Entry keys[CAPACITY]; // keys[i] 为 children[i + 1] 子树中的最小条目
+        Node *children[CAPACITY + 1];
+    };
+
+public:
+    class Iterator
+    {
+    public:
+        Iterator() = default;
+        Iterator(const Leaf *leafNode, size_t position) : leaf(leafNode), pos(position) { skipEmpty(); }
+        bool valid() const { return leaf != nullptr; }
+        const Key &key() const { return leaf->entries[pos].key; }
+        uint64_t row() const { return leaf->entries[pos].row; }
+        void next()
+        {
+            ++pos;
+            skipEmpty();
+        }
+
+    private:
+        const Leaf *leaf = nullptr;
+        size_t pos = 0;
+
+        void skipEmpty()
+        {
+            while (leaf && pos >= leaf->count)
+            {
+                leaf = leaf->next;
+                pos = 0;
+            }
+        }
+    };
+
+    BPlusTree() = default;
+    BPlusTree(const BPlusTree &other) { copyFrom(other); }
+    BPlusTree &operator=(const BPlusTree &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+    BPlusTree(BPlusTree &&other) noexcept { swap(other); }
+    BPlusTree &operator=(BPlusTree &&other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+    ~BPlusTree() { clear(); }
+
+    size_t size() const { return entryCount; }
+
+    void clear()
+    {
+        nodes.clear();
+        root = nullptr;
+        first = nullptr;
+        entryCount = 0;
+    }
+
+    // 函数 bulkLoad 用已按 (键, 行号) 排好序的条目自底向上一次性建树
+    void bulkLoad(const std::vector<Entry> &sorted)
+    {
+        clear();
+        if (sorted.empty())
+            return;
+        std::vector<Node *> level;
+        std::vector<Entry> lowKeys;
+        Leaf *previous = nullptr;
+        for (size_t i = 0; i < sorted.size(); i += Leaf::CAPACITY)
+        {
+            Leaf *leaf = newLeaf();
+            size_t count = std::min(Leaf::CAPACITY, sorted.size() - i);
+            for (size_t j = 0; j < count; ++j)
+                leaf->entries[j] = sorted[i + j];
+            leaf->count = static_cast<uint16_t>(count);
+            leaf->prev = previous;
+            if (previous)
+                previous->next = leaf;
+            else
+                first = leaf;
+            previous = leaf;
+            level.push_back(leaf);
+            lowKeys.push_back(sorted[i]);
+        }
+        while (level.size() > 1)
+        {
+            std::vector<Node *> parents;
+            std::vector<Entry> parentKeys;
+            for (size_t i = 0; i < level.size(); i += Inner::CAPACITY + 1)
+            {
+                Inner *inner = newInner();
+                size_t count = std::min(Inner::CAPACITY + 1, level.size() - i);
+                for (size_t j = 0; j < count; ++j)
+                {
+                    inner->children[j] = level[i + j];
+                    if (j > 0)
+                        inner->keys[j - 1] = lowKeys[i + j];
+                }
+                inner->count = static_cast<uint16_t>(count - 1);
+                parents.push_back(inner);
+                parentKeys.push_back(lowKeys[i]);
+            }
+            level.swap(parents);
+            lowKeys.swap(parentKeys);
+        }
+        root = level[0];
+        entryCount = sorted.size();
+    }
+
+    void insert(const Key &key, uint64_t row)
+    {
+        Entry entry{key, row};
+        if (!root)
+        {
+            Leaf *leaf = newLeaf();
+            leaf->entries[0] = entry;
+            leaf->count = 1;
+            root = first = leaf;
+            entryCount = 1;
+            return;
+        }
+        Entry splitKey;
+        Node *sibling = insertInto(root, entry, splitKey);
+        if (sibling)
+        {
+            Inner *newRoot = newInner();
+            newRoot->children[0] = root;
+            newRoot->children[1] = sibling;
+            newRoot->keys[0] = splitKey;
+            newRoot->count = 1;
+            root = newRoot;
+        }
+        entryCount++;
+    }
+
+    bool erase(const Key &key, uint64_t row)
+    {
+        Entry entry{key, row};
+        Leaf *leaf = findLeaf(entry);
+        for (; leaf; leaf = leaf->next)
+        {
+            size_t pos = leafLowerBound(leaf, entry);
+            if (pos < leaf->count)
+            {
+                if (entry < leaf->entries[pos])
+                    return false;
+                for (size_t i = pos + 1; i < leaf->count; ++i)
+                    leaf->entries[i - 1] = leaf->entries[i];
+                leaf->count--;
+                entryCount--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Iterator begin() const { return Iterator(first, 0); }
+
+    // 函数 lowerBound 返回第一个键不小于 key 的位置；inclusive 为 false 时返回第一个键大于 key 的位置
+    Iterator lowerBound(const Key &key, bool inclusive) const
+    {
+        Iterator it;
+        if (!root)
+            return it;
+        Entry probe{key, inclusive ? 0 : UINT64_MAX};
+        Leaf *leaf = findLeaf(probe);
+        size_t pos = leafLowerBound(leaf, probe);
+        it = Iterator(leaf, pos);
+        while (it.valid() && !inclusive && !(key < it.key()))
+            it.next();
+        return it;
+    }
+
+    // 函数 toSorted 按顺序导出全部条目，用于复制和持久化
+    void toSorted(std::vector<Entry> &out) const
+    {
+        out.clear();
+        out.reserve(entryCount);
+        for (Iterator it = begin(); it.valid(); it.next())
+            out.push_back({it.key(), it.row()});
+    }
+
+private:
+    Node *root = nullptr;
+    Leaf *first = nullptr;
+    size_t entryCount = 0;
+    Arena nodes;
+
+    Leaf *newLeaf()
+    {
+        Leaf *leaf = new (nodes.allocate(sizeof(Leaf), alignof(Leaf))) Leaf();
+        leaf->leaf = true;
+        leaf->count = 0;
+        leaf->prev = leaf->next = nullptr;
+        return leaf;
+    }
+
+    Inner *newInner()
+    {
+        Inner *inner = new (nodes.allocate(sizeof(Inner), alignof(Inner))) Inner();
+        inner->leaf = false;
+        inner->count = 0;
+        return inner;
+    }
+
+    void swap(BPlusTree &other)
+    {
+        std::swap(root, other.root);
+        std::swap(first, other.first);
+        std::swap(entryCount, other.entryCount);
+        nodes.swap(other.nodes);
+    }
+
+    void copyFrom(const BPlusTree &other)
+    {
+        std::vector<Entry> entries;
+        other.toSorted(entries);
+        bulkLoad(entries);
+    }
+
+    static size_t leafLowerBound(const Leaf *leaf, const Entry &entry)
+    {
+        size_t low = 0, high = leaf->count;
+        while (low < high)
+        {
+            size_t mid = (low + high) / 2;
+            if (leaf->entries[mid] < entry)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low;
+    }
+
+    // 函数 childIndex 返回 entry 所在的子树下标
+    static size_t childIndex(const Inner *inner, const Entry &entry)
+    {
+        size_t low = 0, high = inner->count;
+        while (low < high)
+        {
+            size_t mid = (low + high) / 2;
+            if (entry < inner->keys[mid])
+                high = mid;
+            else
+                low = mid + 1;
+        }
+        return low;
+    }
+
+    Leaf *findLeaf(const Entry &entry) const
+    {
+        Node *node = root;
+        while (node && !node->leaf)
+        {
+            const Inner *inner = static_cast<const Inner *>(node);
+            node = inner->children[childIndex(inner, entry)];
+        }
+        return static_cast<Leaf *>(node);
+    }
+
+    // 函数 insertInto 把条目插入 node 子树；节点分裂时返回新的右兄弟，并通过 splitKey 返回其最小条目
+    Node *insertInto(Node *node, const Entry &entry, Entry &splitKey)
+    {
+        if (node->leaf)
+        {
+            Leaf *leaf = static_cast<Leaf *>(node);
+            size_t pos = leafLowerBound(leaf, entry);
+            if (leaf->count < Leaf::CAPACITY)
+            {
+                for (size_t i = leaf->count; i > pos; --i)
+                    leaf->entries[i] = leaf->entries[i - 1];
+                leaf->entries[pos] = entry;
+                leaf->count++;
+                return nullptr;
+            }
+            Entry all[Leaf::CAPACITY + 1];
+            for (size_t i = 0, j = 0; i <= Leaf::CAPACITY; ++i)
+                all[i] = (i == pos) ? entry : leaf->entries[j++];
+            Leaf *right = newLeaf();
+            size_t leftCount = (Leaf::CAPACITY + 1) / 2;
+            for (size_t i = 0; i < leftCount; ++i)
+                leaf->entries[i] = all[i];
+            for (size_t i = leftCount; i <= Leaf::CAPACITY; ++i)
+                right->entries[i - leftCount] = all[i];
+            leaf->count = static_cast<uint16_t>(leftCount);
+            right->count = static_cast<uint16_t>(Leaf::CAPACITY + 1 - leftCount);
+            right->next = leaf->next;
+            right->prev = leaf;
+            if (leaf->next)
+                leaf->next->prev = right;
+            leaf->next = right;
+            splitKey = right->entries[0];
+            return right;
+        }
+
+        Inner *inner = static_cast<Inner *>(node);
+        size_t child = childIndex(inner, entry);
+        Entry childKey;
+        Node *childSibling = insertInto(inner->children[child], entry, childKey);
+        if (!childSibling)
+            return nullptr;
+        if (inner->count < Inner::CAPACITY)
+        {
+            for (size_t i = inner->count; i > child; --i)
+            {
+                inner->keys[i] = inner->keys[i - 1];
+                inner->children[i + 1] = inner->children[i];
+            }
+            inner->keys[child] = childKey;
+            inner->children[child + 1] = childSibling;
+            inner->count++;
+            return nullptr;
+        }
+        Entry keys[Inner::CAPACITY + 1];
+        Node *children[Inner::CAPACITY + 2];
+        for (size_t i = 0, j = 0; i <= Inner::CAPACITY; ++i)
+            keys[i] = (i == child) ? childKey : inner->keys[j++];
+        for (size_t i = 0, j = 0; i <= Inner::CAPACITY + 1; ++i)
+            children[i] = (i == child + 1) ? childSibling : inner->children[j++];
+        size_t leftKeys = (Inner::CAPACITY + 1) / 2;
+        Inner *right = newInner();
+        for (size_t i = 0; i < leftKeys; ++i)
+        {
+            inner->keys[i] = keys[i];
+            inner->children[i] = children[i];
+        }
+        inner->children[leftKeys] = children[leftKeys];
+        inner->count = static_cast<uint16_t>(leftKeys);
+        splitKey = keys[leftKeys];
+        size_t rightKeys = Inner::CAPACITY - leftKeys;
+        for (size_t i = 0; i < rightKeys; ++i)
+        {
+            right->keys[i] = keys[leftKeys + 1 + i];
+            right->children[i] = children[leftKeys + 1 + i];
+        }
+        right->children[rightKeys] = children[Inner::CAPACITY + 1];
+        right->count = static_cast<uint16_t>(rightKeys);
+        return right;
+    }
+};
+
+#endif // BPTREE_HPP
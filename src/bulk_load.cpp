@@ -0,0 +1,99 @@
+#include "bulk_load.hpp"
+
+size_t findUnquoted(std::string_view text, char target, size_t start)
+{
+    char quote = 0;
+    for (size_t i = start; i < text.size(); ++i)
+    {
+        char c = text[i];
+        if (quote)
+        {
+            if (c == quote)
+                quote = 0;
+        }
+        else if (c == '\'' || c == '"')
+        {
+            quote = c;
+        }
+        else if (c == target)
+        {
+            return i;
+        }
+    }
+    return std::string_view::npos;
+}
+
+void splitValues(std::string_view valueList, std::vector<std::string_view> &values)
+{
+    values.clear();
+    size_t start = 0;
+    while (true)
+    {
+        size_t end = findUnquoted(valueList, ',', start);
+        if (end == std::string_view::npos)
+        {
+            values.push_back(valueList.substr(start));
+            return;
+        }
+        values.push_back(valueList.substr(start, end - start));
+        start = end + 1;
+    }
+}
+
+ChunkedLineReader::~ChunkedLineReader()
+{
+    if (file)
+        std::fclose(file);
+}
+
+bool ChunkedLineReader::open(const std::string &path)
+{
+    file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    totalBytes = size > 0 ? static_cast<size_t>(size) : 0;
+    buffer.clear();
+    position = 0;
+    eof = false;
+    return true;
+}
+
+void ChunkedLineReader::refill()
+{
+    // 把未处理完的半行移到缓冲区开头，再读入下一块
+    buffer.erase(0, position);
+    position = 0;
+    size_t kept = buffer.size();
+    buffer.resize(kept + CHUNK_SIZE);
+    size_t got = std::fread(&buffer[kept], 1, CHUNK_SIZE, file);
+    buffer.resize(kept + got);
+    if (got < CHUNK_SIZE)
+        eof = true;
+}
+
+bool ChunkedLineReader::nextLine(std::string_view &line)
+{
+    while (true)
+    {
+        size_t newline = buffer.find('\n', position);
+        if (newline == std::string::npos && eof)
+        {
+            // 最后一行可能没有换行符
+            if (position >= buffer.size())
+                return false;
+            newline = buffer.size();
+        }
+        if (newline != std::string::npos)
+        {
+            line = std::string_view(buffer).substr(position, newline - position);
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+            position = newline + 1;
+            return true;
+        }
+        refill();
+    }
+}
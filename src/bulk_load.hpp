@@ -0,0 +1,42 @@
+#ifndef BULK_LOAD_HPP
+#define BULK_LOAD_HPP
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 函数 findUnquoted 返回 start 之后第一个不在单引号或双引号内的 target，找不到时返回 npos
+size_t findUnquoted(std::string_view text, char target, size_t start = 0);
+
+// 函数 splitValues 按引号外的逗号把一行值拆开，各个值不去除空白
+void splitValues(std::string_view valueList, std::vector<std::string_view> &values);
+
+// 类 ChunkedLineReader 以大块读取文件并逐行返回，行内容指向内部缓冲区，直到下一次调用前有效
+class ChunkedLineReader
+{
+public:
+    static const size_t CHUNK_SIZE = 4 * 1024 * 1024;
+
+    ChunkedLineReader() = default;
+    ChunkedLineReader(const ChunkedLineReader &) = delete;
+    ChunkedLineReader &operator=(const ChunkedLineReader &) = delete;
+    ~ChunkedLineReader();
+
+    bool open(const std::string &path);
+    // 函数 fileSize 返回文件的总字节数，用于预先估计行数
+    size_t fileSize() const { return totalBytes; }
+    // 函数 nextLine 读出下一行（不含换行符和行尾的 \r），文件结束时返回 false
+    bool nextLine(std::string_view &line);
+
+private:
+    std::FILE *file = nullptr;
+    size_t totalBytes = 0;
+    std::string buffer;
+    size_t position = 0;
+    bool eof = false;
+
+    void refill();
+};
+
+#endif // BULK_LOAD_HPP
@@ -0,0 +1,632 @@
+#include "column_store.hpp"
+#include "removespace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <functional>
+
+// 函数 parseColumnType 用于把类型名转换为 ColumnType
+bool parseColumnType(const std::string &typeName, ColumnType &type)
+{
+    if (typeName == "INTEGER")
+        type = ColumnType::INTEGER;
+    else if (typeName == "FLOAT")
+        type = ColumnType::FLOAT;
+    else if (typeName == "TEXT")
+        type = ColumnType::TEXT;
+    else
+        return false;
+    return true;
+}
+
+// 函数 columnTypeName 用于得到类型在 SQL 中的名称
+const char *columnTypeName(ColumnType type)
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        return "INTEGER";
+    case ColumnType::FLOAT:
+        return "FLOAT";
+    default:
+        return "TEXT";
+    }
+}
+
+// 函数 parseInteger 用于把完整的文本解析为整数，存在多余字符时失败
+bool parseInteger(std::string_view text, int64_t &value)
+{
+    text = trimView(text);
+    if (text.size() > 1 && text.front() == '+')
+        text.remove_prefix(1);
+    if (text.empty())
+        return false;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+// 函数 parseFloat 用于把完整的文本解析为浮点数，存在多余字符时失败
+bool parseFloat(std::string_view text, double &value)
+{
+    text = trimView(text);
+    if (text.size() > 1 && text.front() == '+')
+        text.remove_prefix(1);
+    if (text.empty())
+        return false;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+// 函数 stripQuotes 用于去掉 TEXT 值两端的单引号
+std::string_view stripQuotes(std::string_view text)
+{
+    if (text.size() >= 2 && text.front() == '\'' && text.back() == '\'')
+    {
+        return text.substr(1, text.size() - 2);
+    }
+    return text;
+}
+
+void formatInteger(std::string &out, int64_t value)
+{
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+// 浮点数使用能精确还原的最短写法，并保证带有小数点（4 写成 4.0）
+void formatFloat(std::string &out, double value)
+{
+    char buffer[64];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+    if (std::memchr(buffer, '.', result.ptr - buffer) == nullptr &&
+        std::memchr(buffer, 'e', result.ptr - buffer) == nullptr &&
+        std::memchr(buffer, 'n', result.ptr - buffer) == nullptr)
+    {
+        out += ".0";
+    }
+}
+
+size_t ColumnData::size() const
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        return ints.size();
+    case ColumnType::FLOAT:
+        return floats.size();
+    default:
+        return encoding == TextEncoding::DICTIONARY ? codes.size() : textRefs.size();
+    }
+}
+
+void ColumnData::reserve(size_t rows, size_t textBytesHint)
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        ints.reserve(rows);
+        break;
+    case ColumnType::FLOAT:
+        floats.reserve(rows);
+        break;
+    default:
+        if (encoding == TextEncoding::DICTIONARY)
+        {
+            codes.reserve(rows);
+            break;
+        }
+        textRefs.reserve(rows);
+        textBytes.reserve(textBytesHint);
+        break;
+    }
+}
+
+bool ColumnData::appendParsed(std::string_view text)
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+    {
+        int64_t value;
+        if (!parseInteger(text, value))
+            return false;
+        ints.push_back(value);
+        return true;
+    }
+    case ColumnType::FLOAT:
+    {
+        double value;
+        if (!parseFloat(text, value))
+            return false;
+        floats.push_back(value);
+        return true;
+    }
+    default:
+        appendText(trimView(text));
+        return true;
+    }
+}
+
+void ColumnData::appendText(std::string_view value)
+{
+    if (encoding == TextEncoding::DICTIONARY)
+    {
+        int32_t code = addCode(value);
+        if (code >= 0)
+        {
+            codes.push_back(static_cast<uint16_t>(code));
+            return;
+        }
+        decodeDictionary();
+    }
+    textRefs.push_back({textBytes.append(value), static_cast<uint32_t>(value.size())});
+}
+
+void ColumnData::popBack()
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        ints.pop_back();
+        break;
+    case ColumnType::FLOAT:
+        floats.pop_back();
+        break;
+    default:
+        if (encoding == TextEncoding::DICTIONARY)
+        {
+            codes.pop_back();
+            break;
+        }
+        const TextRef &ref = textRefs[textRefs.size() - 1];
+        textBytes.unwind(ref.data, ref.length);
+        textRefs.pop_back();
+        break;
+    }
+}
+
+void ColumnData::truncate(size_t rows)
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        ints.resize(std::min(rows, ints.size()));
+        break;
+    case ColumnType::FLOAT:
+        floats.resize(std::min(rows, floats.size()));
+        break;
+    default:
+        if (encoding == TextEncoding::DICTIONARY)
+        {
+            codes.resize(std::min(rows, codes.size()));
+        }
+        else if (rows < textRefs.size())
+        {
+            for (size_t row = rows; row < textRefs.size(); ++row)
+                deadBytes += textRefs[row].length;
+            textRefs.resize(rows);
+        }
+        break;
+    }
+}
+
+bool ColumnData::assignParsed(size_t row, std::string_view text)
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+    {
+        int64_t value;
+        if (!parseInteger(text, value))
+            return false;
+        ints.set(row, value);
+        return true;
+    }
+    case ColumnType::FLOAT:
+    {
+        double value;
+        if (!parseFloat(text, value))
+            return false;
+        floats.set(row, value);
+        return true;
+    }
+    default:
+        setText(row, trimView(text));
+        return true;
+    }
+}
+
+// 新值总是追加到字节存储末尾，旧值的字节可能仍被快照引用，不原地覆盖；废弃字节过多时整体压缩
+void ColumnData::setText(size_t row, std::string_view value)
+{
+    if (encoding == TextEncoding::DICTIONARY)
+    {
+        int32_t code = addCode(value);
+        if (code >= 0)
+        {
+            codes.set(row, static_cast<uint16_t>(code));
+            return;
+        }
+        decodeDictionary();
+    }
+    deadBytes += textRefs[row].length;
+    textRefs.set(row, {textBytes.append(value), static_cast<uint32_t>(value.size())});
+    if (deadBytes > 4096 && deadBytes * 2 > textBytes.usedBytes())
+    {
+        compactText(nullptr);
+    }
+}
+
+// 压缩写入新的字节存储和地址数组，快照仍引用的旧段和旧块保持不变
+void ColumnData::compactText(const std::vector<char> *erased)
+{
+    TextHeap packed;
+    packed.reserve(textBytes.usedBytes() - std::min(deadBytes, textBytes.usedBytes()));
+    SegmentedArray<TextRef, COLUMN_SEGMENT_BITS> refs;
+    refs.reserve(textRefs.size());
+    for (size_t row = 0; row < textRefs.size(); ++row)
+    {
+        if (erased && (*erased)[row])
+            continue;
+        TextRef ref = textRefs[row];
+        refs.push_back({packed.append(std::string_view(ref.data, ref.length)), ref.length});
+    }
+    textRefs = std::move(refs);
+    textBytes.swap(packed);
+    deadBytes = 0;
+}
+
+void ColumnData::appendValue(std::string &out, size_t row) const
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        formatInteger(out, ints[row]);
+        break;
+    case ColumnType::FLOAT:
+        formatFloat(out, floats[row]);
+        break;
+    default:
+        out.append(textAt(row));
+        break;
+    }
+}
+
+// 保留的值写入新的数组而不是原地前移，快照仍引用的段保持不变
+template <typename Array>
+static void eraseFromArray(Array &values, const std::vector<char> &erased)
+{
+    Array kept;
+    kept.reserve(values.size());
+    for (size_t row = 0; row < values.size(); ++row)
+    {
+        if (!erased[row])
+        {
+            kept.push_back(values[row]);
+        }
+    }
+    values = std::move(kept);
+}
+
+void ColumnData::eraseRows(const std::vector<char> &erased)
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        eraseFromArray(ints, erased);
+        break;
+    case ColumnType::FLOAT:
+        eraseFromArray(floats, erased);
+        break;
+    default:
+    {
+        if (encoding == TextEncoding::DICTIONARY)
+        {
+            eraseFromArray(codes, erased);
+            break;
+        }
+        compactText(&erased);
+        break;
+    }
+    }
+}
+
+template <typename T>
+static void appendRaw(std::string &out, const T *values, size_t count)
+{
+    out.append(reinterpret_cast<const char *>(values), count * sizeof(T));
+}
+
+template <typename Array>
+static void appendSegments(std::string &out, const Array &values)
+{
+    out.reserve(out.size() + values.size() * sizeof(values[0]));
+    values.forEachSegment([&](const auto *segment, size_t count)
+                          { appendRaw(out, segment, count); });
+}
+
+void ColumnData::serialize(std::string &out) const
+{
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        appendSegments(out, ints);
+        break;
+    case ColumnType::FLOAT:
+        appendSegments(out, floats);
+        break;
+    default:
+    {
+        if (encoding == TextEncoding::DICTIONARY)
+        {
+            uint32_t entries = static_cast<uint32_t>(dictionary.size());
+            appendRaw(out, &entries, 1);
+            std::vector<uint64_t> offsets;
+            offsets.reserve(dictionary.size() + 1);
+            offsets.push_back(0);
+            for (size_t code = 0; code < dictionary.size(); ++code)
+                offsets.push_back(offsets.back() + dictionary[code].length);
+            appendRaw(out, offsets.data(), offsets.size());
+            for (size_t code = 0; code < dictionary.size(); ++code)
+                out.append(dictionaryText(code));
+            appendSegments(out, codes);
+            break;
+        }
+        std::vector<uint64_t> offsets;
+        offsets.reserve(textRefs.size() + 1);
+        uint64_t offset = 0;
+        offsets.push_back(offset);
+        for (size_t row = 0; row < textRefs.size(); ++row)
+        {
+            offset += textRefs[row].length;
+            offsets.push_back(offset);
+        }
+        appendRaw(out, offsets.data(), offsets.size());
+        out.reserve(out.size() + offset);
+        for (size_t row = 0; row < textRefs.size(); ++row)
+            out.append(textAt(row));
+        break;
+    }
+    }
+}
+
+// 函数 dictionarySlotsFor 返回容纳 entries 个字典项所需的查找表大小（2 的幂，装载率不超过一半）
+static size_t dictionarySlotsFor(size_t entries)
+{
+    size_t slots = 16;
+    while (slots < entries * 2)
+        slots *= 2;
+    return slots;
+}
+
+static size_t hashText(std::string_view value)
+{
+    return std::hash<std::string_view>()(value);
+}
+
+bool ColumnData::deserialize(std::string_view bytes, size_t rowCount, TextEncoding textEncoding)
+{
+    ints.clear();
+    floats.clear();
+    textRefs.clear();
+    textBytes.clear();
+    deadBytes = 0;
+    clearDictionary();
+    encoding = TextEncoding::PLAIN;
+    switch (type)
+    {
+    case ColumnType::INTEGER:
+        if (bytes.size() != rowCount * sizeof(int64_t))
+            return false;
+        ints.append(bytes.data(), rowCount);
+        return true;
+    case ColumnType::FLOAT:
+        if (bytes.size() != rowCount * sizeof(double))
+            return false;
+        floats.append(bytes.data(), rowCount);
+        return true;
+    default:
+    {
+        if (textEncoding == TextEncoding::DICTIONARY)
+            return deserializeDictionary(bytes, rowCount);
+        size_t header = (rowCount + 1) * sizeof(uint64_t);
+        if (bytes.size() < header)
+            return false;
+        std::vector<uint64_t> offsets(rowCount + 1);
+        std::memcpy(offsets.data(), bytes.data(), header);
+        if (offsets[0] != 0 || offsets[rowCount] != bytes.size() - header)
+            return false;
+        const char *base = textBytes.append(bytes.substr(header));
+        textRefs.reserve(rowCount);
+        for (size_t row = 0; row < rowCount; ++row)
+        {
+            uint64_t length = offsets[row + 1] - offsets[row];
+            if (offsets[row + 1] < offsets[row] || length > UINT32_MAX)
+            {
+                textRefs.clear();
+                textBytes.clear();
+                return false;
+            }
+            textRefs.push_back({base + offsets[row], static_cast<uint32_t>(length)});
+        }
+        encodeDictionary();
+        return true;
+    }
+    }
+}
+
+bool ColumnData::deserializeDictionary(std::string_view bytes, size_t rowCount)
+{
+    uint32_t entries;
+    if (bytes.size() < sizeof(entries))
+        return false;
+    std::memcpy(&entries, bytes.data(), sizeof(entries));
+    size_t header = sizeof(entries) + (static_cast<size_t>(entries) + 1) * sizeof(uint64_t);
+    if (entries > DICTIONARY_LIMIT || bytes.size() < header)
+        return false;
+    std::vector<uint64_t> offsets(entries + 1);
+    std::memcpy(offsets.data(), bytes.data() + sizeof(entries), offsets.size() * sizeof(uint64_t));
+    uint64_t textLength = offsets[entries];
+    if (offsets[0] != 0 || bytes.size() - header < textLength || bytes.size() - header - textLength != rowCount * sizeof(uint16_t))
+        return false;
+    encoding = TextEncoding::DICTIONARY;
+    const char *base = dictionaryBytes.append(bytes.substr(header, textLength));
+    dictionary.reserve(entries);
+    for (size_t i = 0; i < entries; ++i)
+    {
+        if (offsets[i + 1] < offsets[i] || offsets[i + 1] - offsets[i] > UINT32_MAX)
+        {
+            clearDictionary();
+            encoding = TextEncoding::PLAIN;
+            return false;
+        }
+        dictionary.push_back({base + offsets[i], static_cast<uint32_t>(offsets[i + 1] - offsets[i])});
+    }
+    codes.append(bytes.data() + header + textLength, rowCount);
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        if (codes[row] >= entries)
+        {
+            clearDictionary();
+            encoding = TextEncoding::PLAIN;
+            return false;
+        }
+    }
+    rehashDictionary(dictionarySlotsFor(entries));
+    return true;
+}
+
+int32_t ColumnData::findCode(std::string_view value) const
+{
+    if (!dictionarySlots)
+        return -1;
+    const std::vector<int32_t> &slots = *dictionarySlots;
+    size_t mask = slots.size() - 1;
+    for (size_t slot = hashText(value) & mask;; slot = (slot + 1) & mask)
+    {
+        int32_t code = slots[slot];
+        if (code < 0)
+            return -1;
+        if (dictionaryText(code) == value)
+            return code;
+    }
+}
+
+int32_t ColumnData::addCode(std::string_view value)
+{
+    int32_t code = findCode(value);
+    if (code >= 0)
+        return code;
+    if (dictionary.size() >= DICTIONARY_LIMIT)
+        return -1;
+    if (!dictionarySlots || dictionarySlots->size() < dictionarySlotsFor(dictionary.size() + 1))
+        rehashDictionary(dictionarySlotsFor(dictionary.size() + 1));
+    else if (dictionarySlots.use_count() > 1)
+        dictionarySlots = std::make_shared<std::vector<int32_t>>(*dictionarySlots);
+    else
+        std::atomic_thread_fence(std::memory_order_acquire);
+    code = static_cast<int32_t>(dictionary.size());
+    dictionary.push_back({dictionaryBytes.append(value), static_cast<uint32_t>(value.size())});
+    std::vector<int32_t> &slots = *dictionarySlots;
+    size_t mask = slots.size() - 1;
+    size_t slot = hashText(value) & mask;
+    while (slots[slot] >= 0)
+        slot = (slot + 1) & mask;
+    slots[slot] = code;
+    return code;
+}
+
+void ColumnData::rehashDictionary(size_t slotCount)
+{
+    auto slots = std::make_shared<std::vector<int32_t>>(slotCount, -1);
+    size_t mask = slotCount - 1;
+    for (size_t code = 0; code < dictionary.size(); ++code)
+    {
+        size_t slot = hashText(dictionaryText(code)) & mask;
+        while ((*slots)[slot] >= 0)
+            slot = (slot + 1) & mask;
+        (*slots)[slot] = static_cast<int32_t>(code);
+    }
+    dictionarySlots = std::move(slots);
+}
+
+void ColumnData::clearDictionary()
+{
+    codes.clear();
+    dictionary.clear();
+    dictionaryBytes.clear();
+    dictionarySlots.reset();
+}
+
+void ColumnData::decodeDictionary()
+{
+    textRefs.clear();
+    textBytes.clear();
+    deadBytes = 0;
+    textRefs.reserve(codes.size());
+    // 各行直接引用字典项的字节，字典的字节存储转为列的字节存储
+    for (size_t row = 0; row < codes.size(); ++row)
+        textRefs.push_back(dictionary[codes[row]]);
+    textBytes.swap(dictionaryBytes);
+    clearDictionary();
+    encoding = TextEncoding::PLAIN;
+}
+
+bool ColumnData::encodeDictionary()
+{
+    if (type != ColumnType::TEXT)
+        return false;
+    if (encoding == TextEncoding::DICTIONARY)
+        return true;
+    encoding = TextEncoding::DICTIONARY;
+    codes.reserve(textRefs.size());
+    for (size_t row = 0; row < textRefs.size(); ++row)
+    {
+        int32_t code = addCode(std::string_view(textRefs[row].data, textRefs[row].length));
+        if (code < 0)
+        {
+            clearDictionary();
+            encoding = TextEncoding::PLAIN;
+            return false;
+        }
+        codes.push_back(static_cast<uint16_t>(code));
+    }
+    textRefs.clear();
+    textBytes.clear();
+    deadBytes = 0;
+    return true;
+}
+
+bool Tombstones::mark(size_t row)
+{
+    size_t word = row / 64;
+    uint64_t bit = uint64_t(1) << (row % 64);
+    if (word >= words.size())
+        words.resize(word + 1, 0);
+    if (words[word] & bit)
+        return false;
+    words.mutableAt(word) |= bit;
+    ++deletedCount;
+    return true;
+}
+
+bool Tombstones::unmark(size_t row)
+{
+    if (!contains(row))
+        return false;
+    words.mutableAt(row / 64) &= ~(uint64_t(1) << (row % 64));
+    --deletedCount;
+    return true;
+}
+
+void Tombstones::erasedRows(size_t rowCount, std::vector<char> &erased) const
+{
+    erased.assign(rowCount, 0);
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        erased[row] = contains(row) ? 1 : 0;
+    }
+}
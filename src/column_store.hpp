@@ -0,0 +1,181 @@
+#ifndef COLUMN_STORE_HPP
+#define COLUMN_STORE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "segmented.hpp"
+
+enum class ColumnType
+{
+    INTEGER,
+    FLOAT,
+    TEXT
+};
+
+bool parseColumnType(const std::string &typeName, ColumnType &type);
+const char *columnTypeName(ColumnType type);
+bool parseInteger(std::string_view text, int64_t &value);
+bool parseFloat(std::string_view text, double &value);
+std::string_view stripQuotes(std::string_view text);
+void formatInteger(std::string &out, int64_t value);
+void formatFloat(std::string &out, double value);
+
+// TEXT 列中一个值在 TextHeap 中的地址和长度
+struct TextRef
+{
+    const char *data;
+    uint32_t length;
+};
+
+// TEXT 列的编码：PLAIN 为每行的偏移量 + 字节缓冲区；DICTIONARY 为每个不同的值只存一份的字典加每行 16 位的编码
+enum class TextEncoding : uint8_t
+{
+    PLAIN,
+    DICTIONARY
+};
+
+// 字典编码的 TEXT 列最多容纳的不同值个数，超过时自动改为 PLAIN
+const size_t DICTIONARY_LIMIT = 65536;
+// 列按 2^COLUMN_SEGMENT_BITS 行分段存放，与并行扫描的 morsel 大小相同
+const size_t COLUMN_SEGMENT_BITS = 16;
+
+// 类 ColumnData 保存表中一列的全部值：
+// INTEGER/FLOAT 使用原生 int64_t/double 数组，TEXT 新建时使用字典编码，不同的值过多时改用 地址 + 字节存储。
+// 各数组都是写时复制的分段数组，复制 ColumnData 只共享各段，得到的副本是一个不随原列变化的快照
+class ColumnData
+{
+public:
+    ColumnData() = default;
+    explicit ColumnData(ColumnType columnType) : type(columnType) {}
+
+    ColumnType getType() const { return type; }
+    size_t size() const;
+    void reserve(size_t rows, size_t textBytes = 0);
+
+    // 解析并校验一个文本值后追加到列尾，值不合法时返回 false 且不修改列
+    bool appendParsed(std::string_view text);
+    void appendInt(int64_t value) { ints.push_back(value); }
+    void appendFloat(double value) { floats.push_back(value); }
+    void appendText(std::string_view value);
+    void popBack();
+    // 函数 truncate 丢弃 rows 行之后追加的所有值，用于回滚一批追加
+    void truncate(size_t rows);
+
+    // 解析并校验一个文本值后覆盖第 row 行
+    bool assignParsed(size_t row, std::string_view text);
+    void setInt(size_t row, int64_t value) { ints.set(row, value); }
+    void setFloat(size_t row, double value) { floats.set(row, value); }
+    void setText(size_t row, std::string_view value);
+    // 函数 detachRow 在第 row 行所在的 INTEGER/FLOAT 段被快照共享时先复制，之后各线程可以并发修改这个段中不同的行
+    void detachRow(size_t row)
+    {
+        if (type == ColumnType::INTEGER)
+            ints.detach(row);
+        else if (type == ColumnType::FLOAT)
+            floats.detach(row);
+    }
+
+    int64_t intAt(size_t row) const { return ints[row]; }
+    double floatAt(size_t row) const { return floats[row]; }
+    std::string_view textAt(size_t row) const
+    {
+        const TextRef &ref = encoding == TextEncoding::DICTIONARY ? dictionary[codes[row]] : textRefs[row];
+        return std::string_view(ref.data, ref.length);
+    }
+    // 函数 intBlock/floatBlock/codeBlock 返回第 row 行的值的地址，从 row 行到所在段末尾的值连续存放
+    const int64_t *intBlock(size_t row) const { return ints.block(row); }
+    const double *floatBlock(size_t row) const { return floats.block(row); }
+
+    TextEncoding getEncoding() const { return isDictionary() ? TextEncoding::DICTIONARY : TextEncoding::PLAIN; }
+    bool isDictionary() const { return type == ColumnType::TEXT && encoding == TextEncoding::DICTIONARY; }
+    uint16_t codeAt(size_t row) const { return codes[row]; }
+    const uint16_t *codeBlock(size_t row) const { return codes.block(row); }
+    size_t dictionarySize() const { return dictionary.size(); }
+    // 函数 dictionaryText 返回字典项 code 的存储文本
+    std::string_view dictionaryText(size_t code) const { return std::string_view(dictionary[code].data, dictionary[code].length); }
+    // 函数 findCode 返回与存储文本 value 完全相同的字典项的编码，不存在时返回 -1
+    int32_t findCode(std::string_view value) const;
+    // 函数 encodeDictionary 尝试把 PLAIN 列改为字典编码，不同的值超过 DICTIONARY_LIMIT 时保持原样并返回 false
+    bool encodeDictionary();
+
+    // 以存储格式（与插入时的写法一致）输出第 row 行的值
+    void appendValue(std::string &out, size_t row) const;
+    // 删除 erased[row] 非零的行，单次遍历完成压缩
+    void eraseRows(const std::vector<char> &erased);
+
+    // 函数 serialize 把整列编码为磁盘段：INTEGER/FLOAT 为原生数组，PLAIN 的 TEXT 为 (行数 + 1) 个偏移量加紧凑的字节区，
+    // 字典编码的 TEXT 为字典项个数、(个数 + 1) 个偏移量、字典字节区，再加每行的 16 位编码
+    void serialize(std::string &out) const;
+    // 函数 deserialize 从磁盘段恢复 rowCount 行，段长度、偏移量或编码不一致时返回 false 且清空列；
+    // PLAIN 的 TEXT 段读入后如果不同的值足够少，会改为字典编码
+    bool deserialize(std::string_view bytes, size_t rowCount, TextEncoding textEncoding = TextEncoding::PLAIN);
+
+private:
+    ColumnType type = ColumnType::TEXT;
+    SegmentedArray<int64_t, COLUMN_SEGMENT_BITS> ints;
+    SegmentedArray<double, COLUMN_SEGMENT_BITS> floats;
+    SegmentedArray<TextRef, COLUMN_SEGMENT_BITS> textRefs;
+    TextHeap textBytes;
+    size_t deadBytes = 0; // textBytes 中不再被引用的字节数
+    TextEncoding encoding = TextEncoding::DICTIONARY;
+    SegmentedArray<uint16_t, COLUMN_SEGMENT_BITS> codes;      // 字典编码时每行的编码
+    SegmentedArray<TextRef, COLUMN_SEGMENT_BITS> dictionary;  // 编码 -> 字典项在 dictionaryBytes 中的地址
+    TextHeap dictionaryBytes;
+    std::shared_ptr<std::vector<int32_t>> dictionarySlots; // 开放寻址的查找表，保存编码，-1 为空位；修改前被共享时先复制
+
+    // 函数 compactText 把仍被引用的字节复制到新的字节存储，erased 非空时同时删除其中标记的行
+    void compactText(const std::vector<char> *erased);
+    // 函数 addCode 返回 value 的编码，不存在时加入字典；字典已满时返回 -1
+    int32_t addCode(std::string_view value);
+    void rehashDictionary(size_t slotCount);
+    bool deserializeDictionary(std::string_view bytes, size_t rowCount);
+    // 函数 decodeDictionary 把字典编码的列改为 PLAIN
+    void decodeDictionary();
+    void clearDictionary();
+};
+
+// 类 Tombstones 是表的删除位图：DELETE 只把被删除的行置位，所有扫描都跳过这些行，
+// 直到 VACUUM 一次性压缩各列并清空位图，在此之前行号保持不变
+class Tombstones
+{
+public:
+    bool any() const { return deletedCount != 0; }
+    size_t count() const { return deletedCount; }
+    bool contains(size_t row) const
+    {
+        size_t word = row / 64;
+        return word < words.size() && (words[word] >> (row % 64) & 1) != 0;
+    }
+    // 函数 wordAt 返回 [row, row + 64) 行的删除标记，第 i 位对应第 row + i 行
+    uint64_t wordAt(size_t row) const
+    {
+        size_t word = row / 64;
+        size_t shift = row % 64;
+        if (word >= words.size())
+            return 0;
+        uint64_t bits = words[word] >> shift;
+        if (shift != 0 && word + 1 < words.size())
+            bits |= words[word + 1] << (64 - shift);
+        return bits;
+    }
+    // 函数 mark 把第 row 行标记为已删除，该行已经删除时返回 false
+    bool mark(size_t row);
+    // 函数 unmark 撤销第 row 行的删除标记，用于回滚事务，该行没有删除时返回 false
+    bool unmark(size_t row);
+    // 函数 erasedRows 按 ColumnData::eraseRows 的格式给出前 rowCount 行的删除标记
+    void erasedRows(size_t rowCount, std::vector<char> &erased) const;
+    void clear()
+    {
+        words.clear();
+        deletedCount = 0;
+    }
+
+private:
+    SegmentedArray<uint64_t, 10> words; // 只覆盖到最后一个被删除的行，之后的行都未删除
+    size_t deletedCount = 0;
+};
+
+#endif // COLUMN_STORE_HPP
\ No newline at end of file
@@ -1,31 +1,232 @@
 #include "data_manager.hpp"
 #include "removespace.hpp"
+#include "predicate.hpp"
+#include "join.hpp"
+#include "planner.hpp"
+#include "storage.hpp"
+#include "bulk_load.hpp"
+#include "aggregate.hpp"
+#include "sort.hpp"
+#include "snapshot.hpp"
+#include <cstdio>
 #include <numeric>
 #include <string>
 #include <algorithm>
 #include <cctype>
 
 
-bool isValidColumnType(const std::string &type);
-// 函数 trim 用于去除字符串两端的空格
-// 函数 join 用于将字符串数组连接成一个字符串，每个元素之间用 delimiter 分隔
-std::string join(const std::vector<std::string> &elements, const std::string &delimiter)
-{
-    if (elements.empty())
-        return "";
-
-    return std::accumulate(std::next(elements.begin()), elements.end(), elements[0],
-                           [&delimiter](const std::string &a, const std::string &b)
-                           {
-                               return a + delimiter + b;
-                           });
-}
 
 // 函数addColumns 用于向表中添加列
-void Table::addColumns(const std::string &columnName, const std::string &columnType)
+void Table::addColumns(const std::string &columnName, ColumnType columnType)
 {
     columns.push_back({columnName, columnType});
+    data.emplace_back(columnType);
 };
+// 函数 findColumn 用于查找列的下标，不存在时返回 -1
+int Table::findColumn(const std::string &columnName) const
+{
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        if (columns[i].name == columnName)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+// 函数 appendRow 用于解析逗号分隔的值列表，校验类型后直接追加到各列
+bool Table::appendRow(std::string_view valueList, std::string &errorMessage, bool updateIndexes)
+{
+    std::vector<std::string_view> values;
+    splitValues(valueList, values);
+    return appendValues(values, errorMessage, updateIndexes);
+}
+bool Table::appendValues(const std::vector<std::string_view> &values, std::string &errorMessage, bool updateIndexes)
+{
+    if (values.size() != columns.size())
+    {
+        errorMessage = "Error: Number of values does not match number of columns.";
+        return false;
+    }
+    for (size_t column = 0; column < values.size(); ++column)
+    {
+        if (!data[column].appendParsed(values[column]))
+        {
+            errorMessage = std::string("Error: Invalid value for ") + columnTypeName(columns[column].type) + " column.";
+            // 回滚已经追加的值，保证行的原子性
+            for (size_t i = 0; i < column; ++i)
+            {
+                data[i].popBack();
+            }
+            return false;
+        }
+    }
+    rowCount++;
+    if (updateIndexes)
+    {
+        indexRowsFrom(rowCount - 1);
+    }
+    return true;
+}
+// 函数 reserveRows 用于批量追加前为各列预留空间
+void Table::reserveRows(size_t rows, size_t textBytesPerColumn)
+{
+    for (auto &column : data)
+    {
+        column.reserve(rows, textBytesPerColumn);
+    }
+}
+void Table::truncateRows(size_t rows)
+{
+    for (auto &column : data)
+    {
+        column.truncate(rows);
+    }
+    rowCount = std::min(rowCount, rows);
+}
+void Table::indexRowsFrom(size_t firstRow)
+{
+    // 追加的行不少于原有行数时，整体重建比逐行插入更快
+    if (firstRow > 0 && rowCount - firstRow >= firstRow)
+    {
+        rebuildIndexes();
+        return;
+    }
+    for (size_t row = firstRow; row < rowCount; ++row)
+    {
+        for (auto &index : indexes)
+        {
+            index.insertRow(data[index.column], row);
+        }
+        for (auto &index : orderedIndexes)
+        {
+            index.insertRow(data[index.column], row);
+        }
+    }
+}
+// 函数 eraseRows 用于一次性删除 erased 中标记的所有行
+void Table::eraseRows(const std::vector<char> &erased)
+{
+    size_t remaining = 0;
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        if (!erased[row])
+        {
+            remaining++;
+        }
+    }
+    if (remaining == rowCount)
+    {
+        return;
+    }
+    for (auto &column : data)
+    {
+        column.eraseRows(erased);
+    }
+    rowCount = remaining;
+    // 删除后行号整体前移，索引随之重建
+    rebuildIndexes();
+}
+// 函数 vacuum 用于按删除位图压缩各列，只遍历一次
+void Table::vacuum()
+{
+    if (!deleted.any())
+    {
+        return;
+    }
+    std::vector<char> erased;
+    deleted.erasedRows(rowCount, erased);
+    deleted.clear();
+    eraseRows(erased);
+}
+// 函数 liveRows 用于列出未删除的行
+void Table::liveRows(std::vector<size_t> &rows) const
+{
+    rows.clear();
+    rows.reserve(rowCount - deleted.count());
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        if (!deleted.contains(row))
+        {
+            rows.push_back(row);
+        }
+    }
+}
+// 函数 findIndexOn 用于查找建立在某一列上的索引
+const HashIndex *Table::findIndexOn(size_t column) const
+{
+    for (const auto &index : indexes)
+    {
+        if (index.column == column)
+        {
+            return &index;
+        }
+    }
+    return nullptr;
+}
+const OrderedIndex *Table::findOrderedIndexOn(size_t column) const
+{
+    for (const auto &index : orderedIndexes)
+    {
+        if (index.column == column)
+        {
+            return &index;
+        }
+    }
+    return nullptr;
+}
+bool Table::materialize(std::string &errorMessage)
+{
+    if (!source)
+        return true;
+    std::string_view bytes;
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        if (!source->file->readSegment(source->columns[i], bytes, errorMessage))
+            return false;
+        if (!data[i].deserialize(bytes, rowCount, source->encodings[i]))
+        {
+            errorMessage = "Invalid data for column " + columns[i].name + " in table " + name + ".";
+            return false;
+        }
+    }
+    for (auto &index : indexes)
+    {
+        index.build(data[index.column], rowCount);
+    }
+    for (size_t i = 0; i < orderedIndexes.size(); ++i)
+    {
+        OrderedIndex &index = orderedIndexes[i];
+        if (!source->file->readSegment(source->orderedIndexes[i], bytes, errorMessage) || !index.load(bytes, rowCount))
+        {
+            // 索引段损坏不影响表数据，直接重建
+            index.build(data[index.column], rowCount);
+        }
+    }
+    source.reset();
+    return true;
+}
+// 函数 snapshot 用于发布版本：复制 ColumnData 和 Tombstones 只复制段指针
+Table Table::snapshot() const
+{
+    Table copy(name);
+    copy.columns = columns;
+    copy.data = data;
+    copy.rowCount = rowCount;
+    copy.deleted = deleted;
+    return copy;
+}
+void Table::rebuildIndexes()
+{
+    for (auto &index : indexes)
+    {
+        index.build(data[index.column], rowCount);
+    }
+    for (auto &index : orderedIndexes)
+    {
+        index.build(data[index.column], rowCount);
+    }
+}
 // 函数 addTable 用于向数据库中添加表
 void Database::addTable(const std::string &tableName)
 {
@@ -50,32 +251,44 @@ void MiniDB::useDatabase(const std::string &DBname)
     std::string dbName = DBname;
     if (databases.find(dbName) != databases.end())
     {
+        // 已打开的数据库与磁盘上的文件和日志一致，不需要重新读取
+        if (currentDatabase != &databases[dbName])
+        {
+            planCache.invalidate();
+        }
+        currentDatabase = &databases[dbName];
+        return;
+    }
+    if (std::ifstream(databaseFileName(dbName)).is_open() || std::ifstream(dbName + ".txt").is_open())
+    {
+        planCache.invalidate();
         currentDatabase = &databases[dbName];
+        currentDatabase->name = dbName;
 
         loadDatabase(dbName);
     }
 }
-// 函数 createTable 用于创建表
-void MiniDB::createTable(const std::string &command)
+// 函数 switchDatabase 换入一个会话的数据库，会话自己的 USE DATABASE 之后按它的上一次选择判断是否重复
+void MiniDB::switchDatabase(const std::string &DBname)
 {
-
-    const std::string keyword = "CREATE TABLE";
-    if (command.find(keyword) != 0)
+    lastUsedDatabase = DBname;
+    if (DBname.empty())
     {
-        std::cout << "Invalid command. Expected 'CREATE TABLE'." << std::endl;
+        if (currentDatabase)
+        {
+            planCache.invalidate();
+        }
+        currentDatabase = nullptr;
         return;
     }
-
-    size_t start = keyword.length();
-    size_t end = command.find('(', start); // 找到左括号
-
-    // 提取表名
-    std::string tableName = command.substr(start, end - start);
-    tableName = trim(tableName);
-
-    if (tableName.empty())
+    useDatabase(DBname);
+}
+// 函数 createTable 用于创建表
+void MiniDB::createTable(const std::string &tableName, const std::vector<std::pair<std::string, ColumnType>> &columns)
+{
+    if (!currentDatabase)
     {
-        std::cout << "Invalid command. Table name is empty." << std::endl;
+        std::cout << "No database selected." << std::endl;
         return;
     }
 
@@ -87,50 +300,23 @@ void MiniDB::createTable(const std::string &command)
     }
 
     Table newTable(tableName);
-    size_t columnStart = end + 1;
-
-    // 找到列定义的结束位置
-    size_t columnEnd = command.find(')', columnStart);
-    if (columnEnd == std::string::npos)
-    {
-        std::cout << "Invalid command. Missing ')' at the end of column definitions." << std::endl;
-        return;
-    }
-
-    // 提取列定义
-    std::string columns = command.substr(columnStart, columnEnd - columnStart);
-    columns = trim(columns);
-
-    // 用逗号分隔列定义，处理每一列
-    std::istringstream iss(columns);
-    std::string columnDef;
-
-    while (getline(iss, columnDef, ','))
+    for (const auto &column : columns)
     {
-        columnDef = trim(columnDef);
-
-        if (columnDef.empty())
-            continue; // 跳过空列定义
-
-        // 提取列名和类型
-        std::istringstream colStream(columnDef);
-        std::string columnName, columnType;
-        colStream >> columnName >> columnType;
-
-        // 检查列类型是否有效
-        if (columnType != "INTEGER" && columnType != "TEXT" && columnType != "FLOAT")
-        {
-            std::cout << "Invalid column type: " << columnType << std::endl;
-            return;
-        }
-
-        // 添加列到表中
-        newTable.addColumns(columnName, columnType);
+        newTable.addColumns(column.first, column.second);
     }
 
     // 添加表到当前数据库
     currentDatabase->tables[tableName] = newTable;
-    saveDatabase(currentDatabase->name);
+    planCache.invalidate();
+    LogRecord record;
+    record.type = LogRecordType::CREATE_TABLE;
+    record.table = tableName;
+    for (const Column &column : newTable.columns)
+    {
+        record.columns.emplace_back(column.name, column.type);
+    }
+    addUndo(LogRecordType::CREATE_TABLE, tableName);
+    logChange(std::move(record));
 }
 // 函数 dropTable 用于删除表
 void MiniDB::dropTable(const std::string &tableName)
@@ -141,675 +327,1726 @@ void MiniDB::dropTable(const std::string &tableName)
         return;
     }
 
-    if (currentDatabase->tables.erase(tableName) == 0)
+    auto it = currentDatabase->tables.find(tableName);
+    if (it == currentDatabase->tables.end())
     {
         std::cout << "Table [" << tableName << "] does not exist." << std::endl;
         return;
     }
+    // 事务中被删除的表移入撤销记录，回滚时原样放回
+    if (UndoRecord *undo = addUndo(LogRecordType::DROP_TABLE, tableName))
+    {
+        undo->dropped = std::make_unique<Table>(std::move(it->second));
+    }
+    currentDatabase->tables.erase(it);
+    planCache.invalidate();
 
-    saveDatabase(currentDatabase->name);
+    LogRecord record;
+    record.type = LogRecordType::DROP_TABLE;
+    record.table = tableName;
+    logChange(std::move(record));
 }
-// 函数 loadDatabase 用于加载数据库
-void MiniDB::loadDatabase(const std::string &DBname)
+// 函数 loadTextDatabase 用于读取旧版本的文本格式（<库名>.txt），只在转换为二进制格式时使用
+static bool loadTextDatabase(const std::string &DBname, Database &db)
 {
     std::ifstream dbFile(DBname + ".txt");
     if (!dbFile.is_open())
     {
-        error("Failed to open file for loading.");
-        return;
+        return false;
     }
 
-    Database loadedDb(DBname);
     std::string line;
+    std::string message;
     Table *currentTable = nullptr;
+    bool readingColumns = false;
     while (getline(dbFile, line))
     {
-        line = trim(line);
-        if (line.empty())
+        std::string_view text = trimView(line);
+        if (text.empty() || text.rfind("CREATE DATABASE", 0) == 0)
             continue;
 
-        if (line.rfind("TABLE", 0) == 0)
+        if (text.rfind("CREATE INDEX", 0) == 0)
+        {
+            Statement statement;
+            if (text.back() == ';')
+                text.remove_suffix(1);
+            if (!parseStatement(text, statement, message))
+                continue;
+            const std::string &indexName = statement.name;
+            const std::string &columnName = statement.indexColumn;
+            bool ordered = statement.ordered;
+            auto tableIt = db.tables.find(statement.table);
+            int column = tableIt == db.tables.end() ? -1 : tableIt->second.findColumn(columnName);
+            if (column < 0)
+                continue;
+            Table &indexedTable = tableIt->second;
+            if (!ordered)
+            {
+                indexedTable.indexes.emplace_back(indexName, columnName, static_cast<size_t>(column));
+                indexedTable.indexes.back().build(indexedTable.data[column], indexedTable.rowCount);
+            }
+            else if (OrderedIndex::supports(indexedTable.columns[column].type))
+            {
+                indexedTable.orderedIndexes.emplace_back(indexName, columnName, static_cast<size_t>(column), indexedTable.columns[column].type);
+                indexedTable.orderedIndexes.back().build(indexedTable.data[column], indexedTable.rowCount);
+            }
+        }
+        else if (text.rfind("CREATE TABLE", 0) == 0)
+        {
+            std::string tableName(trimView(text.substr(12, text.find(';') - 12)));
+            db.tables[tableName] = Table(tableName);
+            currentTable = &db.tables[tableName];
+            readingColumns = true;
+        }
+        else if (text == ");")
+        {
+            readingColumns = false;
+        }
+        else if (currentTable && text.rfind("INSERT INTO", 0) == 0)
         {
-            std::string tableName = trim(line.substr(6));
-            loadedDb.tables[tableName] = Table(tableName);
-            currentTable = &loadedDb.tables[tableName];
+            size_t valuesStart = text.find("VALUES (");
+            if (valuesStart == std::string_view::npos ||
+                !currentTable->appendRow(text.substr(valuesStart + 8), message))
+                std::cerr << "Warning: Skipping invalid row in table '" << currentTable->name << "'." << std::endl;
         }
-        else if (currentTable && line.find(')') == std::string::npos)
+        else if (currentTable && readingColumns)
         {
-            std::istringstream iss(line);
+            if (text.back() == ',')
+                text.remove_suffix(1);
+            std::istringstream iss{std::string(text)};
             std::string columnName, columnType;
             iss >> columnName >> columnType;
-            if (isValidColumnType(columnType))
-                currentTable->addColumns(columnName, columnType);
+            ColumnType type;
+            if (parseColumnType(columnType, type))
+                currentTable->addColumns(columnName, type);
             else
                 std::cerr << "Warning: Invalid column type '" << columnType << "' in table '" << currentTable->name << "'. Skipping column." << std::endl;
         }
-        else if (currentTable && line.rfind("INSERT INTO", 0) == 0)
-        {
-            std::istringstream iss(line.substr(11));
-            Record record;
-            std::string value;
-            while (getline(iss, value, ','))
-                record.localValues.push_back(trim(value));
-            currentTable->records.push_back(record);
-        }
     }
-    dbFile.close();
-    databases[DBname] = loadedDb;
-}
-
-bool isValidColumnType(const std::string &type)
-{
-    return type == "INTEGER" || type == "TEXT" || type == "FLOAT";
+    return true;
 }
-
-// 函数 saveDatabase 用于保存数据库
-void MiniDB::saveDatabase(const std::string &DBname)
+// 函数 loadDatabase 用于加载数据库，只有旧的文本文件时先转换为二进制格式
+void MiniDB::loadDatabase(const std::string &DBname)
 {
-    std::ofstream dbFile(DBname + ".txt");
-    if (!dbFile.is_open())
+    Database loadedDb(DBname);
+    std::string message;
+    if (!std::ifstream(databaseFileName(DBname)).is_open() && std::ifstream(DBname + ".txt").is_open())
+    {
+        convertDatabase(DBname);
+        return;
+    }
+    if (!readDatabaseFile(DBname, loadedDb, message))
     {
-        error("Failed to open file for saving.");
+        error(message);
         return;
     }
 
-    auto &db = databases[DBname];
-    dbFile << "CREATE DATABASE " << DBname << ";" << std::endl;
-    //遍历表
-    for (const auto &tablePair : db.tables)
+    // 重放检查点之后的日志，恢复上次退出（或崩溃）前已提交的修改
+    logs.erase(DBname);
+    uint64_t lastLsn = loadedDb.checkpointLsn;
+    size_t replayed = 0;
+    bool logOk = WriteAheadLog::replay(logFileName(DBname), loadedDb.checkpointLsn, [&](const LogRecord &record)
+                                       {
+        if (!applyLogRecord(loadedDb, record))
+            std::cerr << "Warning: Skipping log record for table '" << record.table << "'." << std::endl;
+        replayed++; }, lastLsn);
+    if (!logOk)
+    {
+        error("Failed to truncate log " + logFileName(DBname) + ".");
+    }
+    if (replayed > 0)
     {
-        const Table &table = tablePair.second;
-        dbFile << "CREATE TABLE " << table.name << ";" << std::endl;
-        for (size_t i = 0; i < table.columns.size(); ++i)
+        for (auto &tablePair : loadedDb.tables)
         {
-            const Column &col = table.columns[i];
-            dbFile << "    " << col.name << " " << col.type;
-            if (i < table.columns.size() - 1)
+            if (!tablePair.second.source)
             {
-                dbFile << ",";
+                tablePair.second.rebuildIndexes();
             }
-            dbFile << "\n";
         }
-        dbFile << ");" << std::endl;
-        for (const auto &record : table.records)
-        {
-            dbFile << "INSERT INTO " << table.name << " VALUES (";
-            dbFile << join(record.localValues, ",") << std::endl;
-        }
-        dbFile << ");" << std::endl;
     }
-
-    dbFile.close();
+    databases[DBname] = std::move(loadedDb);
+    WriteAheadLog &log = logs[DBname];
+    log.setSyncMode(walSyncMode, walGroupSize);
+    if (!log.open(logFileName(DBname), lastLsn))
+    {
+        error("Failed to open log " + logFileName(DBname) + ".");
+    }
 }
-// 函数 insertIntoTable 用于向表中插入记录
-void MiniDB::insertIntoTable(const std::string &command, const std::string &tableName, const std::vector<std::string> &values)
+// 函数 convertDatabase 用于把文本格式的数据库一次性转换为二进制页式文件
+bool MiniDB::convertDatabase(const std::string &DBname)
 {
-    if (!currentDatabase)
+    Database loadedDb(DBname);
+    if (!loadTextDatabase(DBname, loadedDb))
     {
-        std::cerr << "No database selected." << std::endl;
-        return;
+        error("Failed to open file for loading.");
+        return false;
     }
-
-    if (currentDatabase->tables.find(tableName) == currentDatabase->tables.end())
+    std::string message;
+    if (!writeDatabaseFile(loadedDb, message))
     {
-        std::cerr << "Table " << tableName << " does not exist." << std::endl;
-        return;
+        error(message);
+        return false;
     }
+    // 旧格式没有日志，残留的日志文件不属于转换后的数据库
+    logs.erase(DBname);
+    std::remove(logFileName(DBname).c_str());
+    databases[DBname] = std::move(loadedDb);
+    return true;
+}
 
-    size_t valuesStart = command.find("VALUES") + 6;
-    size_t valuesEnd = command.find(';', valuesStart);
-    if (valuesStart == std::string::npos || valuesEnd == std::string::npos)
+// 函数 loadTable 用于在第一次访问表时读入它的数据，失败时打印原因
+bool MiniDB::loadTable(Table &table)
+{
+    std::string message;
+    if (!table.materialize(message))
     {
-        std::cerr << "Invalid command." << std::endl;
-        return;
+        error(message);
+        return false;
+    }
+    return true;
+}
+// 函数 logFor 返回数据库的日志，第一次使用时打开
+WriteAheadLog &MiniDB::logFor(const std::string &DBname)
+{
+    WriteAheadLog &log = logs[DBname];
+    if (!log.isOpen())
+    {
+        log.setSyncMode(walSyncMode, walGroupSize);
+        log.open(logFileName(DBname), databases[DBname].checkpointLsn);
     }
-    
-    std::string valuepart = command.substr(valuesStart, valuesEnd - valuesStart);
-    valuepart = trim(valuepart);
-    if (valuepart.front() != '(' || valuepart.back() != ')')
+    return log;
+}
+// 函数 logChange 把当前数据库的一次修改追加到日志，日志过大时做检查点
+void MiniDB::logChange(LogRecord &&record)
+{
+    if (transaction.active)
     {
-        std::cerr << "Invalid command." << std::endl;
+        transaction.redo.push_back(std::move(record));
         return;
     }
-    valuepart = valuepart.substr(1, valuepart.size() - 2);
-
-    std::vector<std::string> localValues;
-    size_t start = 0, end;
-    while ((end = valuepart.find(',', start)) != std::string::npos)
+    const std::string &DBname = currentDatabase->name;
+    WriteAheadLog &log = logFor(DBname);
+    if (!log.append(record))
     {
-        localValues.push_back(trim(valuepart.substr(start, end - start)));
-        start = end + 1;
+        // 日志写入失败时退回到整库保存，保证修改不丢失
+        error("Failed to write log " + logFileName(DBname) + ".");
+        saveDatabase(DBname);
+        return;
     }
-    localValues.push_back(trim(valuepart.substr(start)));
-
-    auto &table = currentDatabase->tables[tableName];
-    if (localValues.size() != table.columns.size())
+    if (log.getSize() > checkpointBytes)
     {
-        std::cerr << "Error: Number of values does not match number of columns." << std::endl;
-        return;
+        saveDatabase(DBname);
     }
-
-    Record newRecord;
-    bool valid = true;
-    for (size_t i = 0; i < table.columns.size(); i++)
+}
+// 函数 saveDatabase 用于保存数据库：把内存中的数据写成新的数据库文件（检查点），然后清空日志
+void MiniDB::saveDatabase(const std::string &DBname)
+{
+    WriteAheadLog &log = logFor(DBname);
+    Database &db = databases[DBname];
+    // 数据库文件不保存删除位图，写出之前先压缩带删除标记的表
+    for (auto &tablePair : db.tables)
     {
-        const Column &column = table.columns[i];
-        const std::string &value = localValues[i];
-
-        if ((column.type == "INTEGER" && !isInteger(value)) ||
-            (column.type == "FLOAT" && !isFloat(value)))
-        {
-            std::cerr << "Error: Invalid value for " << column.type << " column." << std::endl;
-            valid = false;
-            break;
-        }
-        newRecord.localValues.push_back(value);
+        vacuumTable(DBname, tablePair.second);
     }
-
-    if (valid)
+    log.sync();
+    db.checkpointLsn = log.getLastLsn();
+    std::string message;
+    if (!writeDatabaseFile(db, message))
     {
-        table.records.push_back(newRecord);
+        error(message);
+        return;
     }
+    log.reset();
 }
-
-bool MiniDB::isInteger(const std::string &value)
+// 函数 vacuumTable 用于压缩表中已删除的行。压缩改变了之后各行的行号，因此先记入日志，重放时在同一位置压缩
+void MiniDB::vacuumTable(const std::string &DBname, Table &table)
 {
-    try
+    if (!table.deleted.any())
     {
-        std::stoi(value);
-        return true;
+        return;
     }
-    catch (const std::invalid_argument &)
+    LogRecord record;
+    record.type = LogRecordType::VACUUM;
+    record.table = table.name;
+    if (!logFor(DBname).append(record))
     {
-        return false;
+        error("Failed to write log " + logFileName(DBname) + ".");
     }
+    table.vacuum();
 }
-
-bool MiniDB::isFloat(const std::string &value)
+// 函数 vacuum 用于处理 VACUUM 语句：压缩指定的表，表名为空时压缩当前数据库的所有表
+void MiniDB::vacuum(const std::string &tableName)
 {
-    try
+    if (!currentDatabase)
     {
-        std::stof(value);
-        return true;
+        std::cerr << "No database selected." << std::endl;
+        return;
     }
-    catch (const std::invalid_argument &)
+    if (tableName.empty())
     {
-        return false;
+        for (auto &tablePair : currentDatabase->tables)
+        {
+            vacuumTable(currentDatabase->name, tablePair.second);
+        }
+        return;
+    }
+    auto it = currentDatabase->tables.find(tableName);
+    if (it == currentDatabase->tables.end())
+    {
+        std::cerr << "Table [" << tableName << "] does not exist." << std::endl;
+        return;
     }
+    vacuumTable(currentDatabase->name, it->second);
 }
-
-// 函数 select 用于查询表中的记录
-void MiniDB::select(const std::string &tableName, std::vector<std::string> &columns, const std::string &whereClause)
+// 函数 checkpoint 用于立即把当前数据库的日志并入数据库文件
+void MiniDB::checkpoint()
 {
-    if (currentDatabase == nullptr)
+    if (!currentDatabase)
     {
-        std::cout << "No database selected." << std::endl;
+        std::cerr << "No database selected." << std::endl;
         return;
     }
-    auto &db = *currentDatabase;
-    if (db.tables.find(tableName) != db.tables.end())
+    saveDatabase(currentDatabase->name);
+}
+// 函数 setOption 用于处理 SET 语句：WAL_SYNC（FULL/GROUP/OFF）、WAL_GROUP_SIZE、CHECKPOINT_SIZE、OUTPUT_FORMAT（CSV/TSV/BINARY）、THREADS、
+// VACUUM_THRESHOLD（0 到 100 的百分比）
+void MiniDB::setOption(const std::string &name, const std::string &value)
+{
+    if (name == "WAL_SYNC")
     {
-        Table &table = db.tables[tableName];
-        if (columns[0] == "*")
+        if (value == "FULL")
+            walSyncMode = WalSyncMode::FULL;
+        else if (value == "GROUP")
+            walSyncMode = WalSyncMode::GROUP;
+        else if (value == "OFF")
+            walSyncMode = WalSyncMode::OFF;
+        else
         {
-            for (size_t i = 0; i < table.columns.size(); ++i)
-            {
-                std::cout << table.columns[i].name;
-                columns.push_back(table.columns[i].name);
-                if (i < table.columns.size() - 1)
-                {
-                    std::cout << ",";
-                }
-            }
-            std::cout << std::endl; 
+            std::cerr << "Invalid value for WAL_SYNC: " << value << std::endl;
+            return;
         }
-        std::vector<std::pair<std::string, std::pair<std::string, std::string>>> conditions;
-        std::string logicalOperator = "AND"; 
-        if (!whereClause.empty())
+    }
+    else if (name == "WAL_GROUP_SIZE" || name == "CHECKPOINT_SIZE")
+    {
+        int64_t number;
+        if (!parseInteger(value, number) || number <= 0)
         {
-            std::string whereClause1, whereClause2;
-            std::vector<std::string> whereclauses;
-            if (whereClause.find("AND") != std::string::npos)
-            {
-                whereClause1 = whereClause.substr(0, whereClause.find("AND") - 1);
-                whereClause2 = whereClause.substr(whereClause.find("AND") + 4);
-                logicalOperator = "AND";
-                whereclauses.push_back(whereClause1);
-                whereclauses.push_back(whereClause2);
-            }
-            else if (whereClause.find("OR") != std::string::npos)
-            {
-                whereClause1 = whereClause.substr(0, whereClause.find("OR") - 1);
-                whereClause2 = whereClause.substr(whereClause.find("OR") + 3);
-                logicalOperator = "OR";
-                whereclauses.push_back(whereClause1);
-                whereclauses.push_back(whereClause2);
-            }
-            else
-            {
-                whereClause1 = whereClause;
-                whereclauses.push_back(whereClause1);
-            }
-            for (auto &where : whereclauses)
-            {
-                std::istringstream iss(where);
-                std::string token, columnName, op, value;
-                while (iss >> token)
-                {
-                   
-                    columnName = token;
-                    iss >> op;
-                    getline(iss, value);
-                    if (value.front() == ' ')
-                        value = value.substr(1);
-                    if (value.front() == '\'' && value.back() == '\'')
-                    {
-                        value = value.substr(1, value.length() - 2);
-                    }
-                    conditions.emplace_back(columnName, make_pair(op, value));
-                }
-            }
+            std::cerr << "Invalid value for " << name << ": " << value << std::endl;
+            return;
         }
-
-        for (auto &record : table.records)
+        if (name == "WAL_GROUP_SIZE")
+            walGroupSize = static_cast<size_t>(number);
+        else
+            checkpointBytes = static_cast<uint64_t>(number);
+    }
+    else if (name == "THREADS")
+    {
+        int64_t number;
+        if (!parseInteger(value, number) || number <= 0)
         {
-
-            //检查记录是否满足WHERE子句
-            if (evaluateCondition(tableName, record, conditions, logicalOperator))
-            {
-                for (size_t i = 0; i < columns.size(); ++i)
-                {
-
-                    auto it = find_if(table.columns.begin(), table.columns.end(), [&columns, i](const Column &c)
-                                      { return c.name == columns[i]; });
-                    if (it != table.columns.end())
-                    {
-                        //找到记录中列的索引并打印其值
-                        size_t columnIndex = distance(table.columns.begin(), it);
-                        if (table.columns[columnIndex].type == "FLOAT")
-                        {
-                            std::cout << std::fixed << std::setprecision(2) << stof(record.localValues[columnIndex]);
-                        }
-                        else
-                        {
-                            std::cout << record.localValues[columnIndex];
-                        }
-                        if (i < columns.size() - 1)
-                        {
-                            std::cout << ",";
-                        }
-                    }
-                }
-                std::cout << std::endl; 
-            }
+            std::cerr << "Invalid value for THREADS: " << value << std::endl;
+            return;
         }
+        scanThreads.setThreads(static_cast<size_t>(number));
+        return;
     }
-    std::cout << "---" << std::endl;
-}
-// 函数 innerJoin 用于内连接两个表
-void MiniDB::innerJoin(const std::string &tableName1, const std::string &tableName2, const std::string &base1, const std::string &base2, const std::string &column1, const std::string &column2, const std::string &whereClause)
-{
-    if (currentDatabase == nullptr)
+    else if (name == "VACUUM_THRESHOLD")
     {
-        std::cout << "No database selected." << std::endl;
+        int64_t number;
+        if (!parseInteger(value, number) || number < 0 || number > 100)
+        {
+            std::cerr << "Invalid value for VACUUM_THRESHOLD: " << value << std::endl;
+            return;
+        }
+        vacuumThreshold = static_cast<size_t>(number);
         return;
     }
-    auto &db = *currentDatabase;
-
-    Table &table1 = db.tables[tableName1];
-    Table &table2 = db.tables[tableName2];
-    auto it1 = find_if(table1.columns.begin(), table1.columns.end(), [&base1](const Column &c)
-                       { return c.name == base1; });
-    auto it2 = find_if(table2.columns.begin(), table2.columns.end(), [&base2](const Column &c)
-                       { return c.name == base2; });
-    auto it3 = find_if(table1.columns.begin(), table1.columns.end(), [&column1](const Column &c)
-                       { return c.name == column1; });
-    auto it4 = find_if(table2.columns.begin(), table2.columns.end(), [&column2](const Column &c)
-                       { return c.name == column2; });
-    if (it1 == table1.columns.end() || it2 == table2.columns.end())
+    else if (name == "SORT_MEMORY")
     {
-        std::cout << "Column does not exist." << std::endl;
+        int64_t number;
+        if (!parseInteger(value, number) || number <= 0)
+        {
+            std::cerr << "Invalid value for SORT_MEMORY: " << value << std::endl;
+            return;
+        }
+        sortMemoryBudget = static_cast<size_t>(number);
         return;
     }
-    size_t index1 = distance(table1.columns.begin(), it1);
-    size_t index2 = distance(table2.columns.begin(), it2);
-    size_t index3 = distance(table1.columns.begin(), it3);
-    size_t index4 = distance(table2.columns.begin(), it4);
-    std::string tableName;
-    if (whereClause.empty())
+    else if (name == "OUTPUT_FORMAT")
     {
-        std::cout << tableName1 << "." << column1 << "," << tableName2 << "." << column2 << std::endl;
-        for (const auto &record1 : table1.records)
+        ResultFormat format;
+        if (!parseResultFormat(value, format))
         {
-            for (const auto &record2 : table2.records)
-            {
-                if (record1.localValues[index1] == record2.localValues[index2])
-                {
-                    std::cout << record1.localValues[index3] << "," << record2.localValues[index4] << std::endl;
-                }
-            }
+            std::cerr << "Invalid value for OUTPUT_FORMAT: " << value << std::endl;
+            return;
         }
+        results.setFormat(format);
+        return;
     }
-
     else
     {
-        std::vector<std::pair<std::string, std::pair<std::string, std::string>>> conditions;
-        std::string logicalOperator = "AND";
-        if (!whereClause.empty())
-        {
-
-            std::string columnName, op, value;
-            tableName = whereClause.substr(0, whereClause.find("."));
-            columnName = whereClause.substr(whereClause.find(".") + 1, whereClause.find("=") - whereClause.find(".") - 1);
-            columnName = columnName.erase(0, columnName.find_first_not_of(" \t\n;"));
-            columnName = columnName.erase(columnName.find_last_not_of(" \t\n;") + 1);
-
-            if (whereClause.find("=") != std::string::npos)
-            {
-                op = "=";
-            }
-            else if (whereClause.find(">") != std::string::npos)
-            {
-                op = ">";
-            }
-            else if (whereClause.find("<") != std::string::npos)
-            {
-                op = "<";
-            }
-            value = whereClause.substr(whereClause.find(op) + 1);
-            value = trim(value);
-
-            conditions.emplace_back(columnName, make_pair(op, value));
-        }
-        std::cout << tableName1 << "." << column1 << "," << tableName2 << "." << column2 << std::endl;
-        for (const auto &record1 : table1.records)
-        {
-            for (const auto &record2 : table2.records)
-            {
-                if (record1.localValues[index1] == record2.localValues[index2] && evaluateCondition(tableName, record1, conditions, logicalOperator))
-                {
-                    std::cout << record1.localValues[index3] << "," << record2.localValues[index4] << std::endl;
-                }
-            }
-        }
+        std::cerr << "Unknown setting: " << name << std::endl;
+        return;
+    }
+    for (auto &logPair : logs)
+    {
+        logPair.second.sync();
+        logPair.second.setSyncMode(walSyncMode, walGroupSize);
     }
-    std::cout << "---" << std::endl;
 }
-// 函数 evaluateCondition 用于评估条件
-void MiniDB::update(const std::string &tableName, const std::string &setclause, const std::string &whereClause)
+// 函数 insertIntoTable 用于向表中插入记录。多行 INSERT 整批追加后统一维护索引，任何一行出错都回滚整批
+void MiniDB::insertIntoTable(const std::string &tableName, const std::vector<std::vector<std::string>> &rows)
 {
-    if (currentDatabase == nullptr)
+    if (!currentDatabase)
     {
-        std::cout << "No database selected." << std::endl;
+        std::cerr << "No database selected." << std::endl;
         return;
     }
-    auto &db = *currentDatabase;
-    if (db.tables.find(tableName) == db.tables.end())
+
+    auto tableIt = currentDatabase->tables.find(tableName);
+    if (tableIt == currentDatabase->tables.end())
     {
-        std::cout << "Table does not exist." << std::endl;
+        std::cerr << "Table " << tableName << " does not exist." << std::endl;
         return;
     }
-    Table &table = db.tables[tableName];
-    std::istringstream iss(setclause);
-    std::string ope, change_columnName, content;
-    iss >> change_columnName >> ope;
-    content = setclause.substr(setclause.find(ope) + 1);
-    std::vector<std::pair<std::string, std::pair<std::string, std::string>>> conditions;
-    std::string logicalOperator = "AND";
-    if (!whereClause.empty())
+    Table &table = tableIt->second;
+    if (!loadTable(table))
     {
-        std::istringstream iss(whereClause);
-        std::string token, columnName, op, value;
-        while (iss >> token)
-        {
-            if (token == "AND" || token == "OR")
-            {
-                logicalOperator = token;
-            }
-            else
-            {
-                columnName = token;
-                iss >> op;
-                getline(iss, value);
-                if (value.front() == ' ')
-                    value = value.substr(1);
-                if (value.front() == '\'' && value.back() == '\'')
-                {
-                    value = value.substr(1, value.length() - 2);
-                }
-                conditions.emplace_back(columnName, make_pair(op, value));
-            }
-        }
+        return;
     }
 
-    for (auto &record : table.records)
+    LogRecord record;
+    record.type = LogRecordType::INSERT;
+    record.table = tableName;
+    std::string message;
+    std::vector<std::string_view> values;
+    size_t firstRow = table.rowCount;
+    if (rows.size() > 1)
+    {
+        table.reserveRows(firstRow + rows.size(), 0);
+    }
+    // 每个值只解析和校验一次，直接写入对应的类型化列
+    for (const auto &row : rows)
     {
-        if (evaluateCondition(tableName, record, conditions, logicalOperator))
+        values.assign(row.begin(), row.end());
+        if (!table.appendValues(values, message, false))
         {
-            auto it = find_if(table.columns.begin(), table.columns.end(), [&change_columnName](const Column &c)
-                              { return c.name == change_columnName; });
-            if (it != table.columns.end())
+            table.truncateRows(firstRow);
+            std::cerr << message << std::endl;
+            return;
+        }
+        record.newValues.emplace_back();
+        for (size_t i = 0; i < row.size(); ++i)
+        {
+            if (i > 0)
             {
-                size_t columnIndex = distance(table.columns.begin(), it);
-                if (content.find("+") != std::string::npos || content.find("-") != std::string::npos || content.find("*") != std::string::npos || content.find("/") != std::string::npos)
-                {
-                    if (table.columns[columnIndex].type == "INTEGER")
-                    {
-                        int currentVal = stoi(record.localValues[columnIndex]);
-                        int newVal = stoi(content.substr(content.length() - 1));
-                        if (content.find("+") != std::string::npos)
-                        {
-                            record.localValues[columnIndex] = std::to_string(currentVal + newVal);
-                        }
-                        else if (content.find("-") != std::string::npos)
-                        {
-                            record.localValues[columnIndex] = std::to_string(currentVal - newVal);
-                        }
-                        else if (content.find("*") != std::string::npos)
-                        {
-                            record.localValues[columnIndex] = std::to_string(currentVal * newVal);
-                        }
-                        else if (content.find("/") != std::string::npos)
-                        {
-                            record.localValues[columnIndex] = std::to_string(currentVal / newVal);
-                        }
-                    }
-                    else if (table.columns[columnIndex].type == "FLOAT")
-                    {
-                        float currentVal = stof(record.localValues[columnIndex]);
-                        float newVal = stof(content.substr(content.find_last_of("+-") + 1));
-                        float result;
-                        if (content.find("+") != std::string::npos)
-                        {
-                            result = currentVal + newVal;
-                        }
-                        else if (content.find("-") != std::string::npos)
-                        {
-                            result = currentVal - newVal;
-                        }
-                        else if (content.find("*") != std::string::npos)
-                        {
-                            result = currentVal * newVal;
-                        }
-                        else if (content.find("/") != std::string::npos)
-                        {
-                            result = currentVal / newVal;
-                        }
-                        // 使用 stringstream 来格式化浮点数
-                        std::ostringstream out;
-                        out << std::fixed << std::setprecision(2) << result;
-                        record.localValues[columnIndex] = out.str();
-                    }
-                }
-                else
-                {
-                    record.localValues[columnIndex] = content;
-                }
+                record.newValues.back() += ',';
             }
+            record.newValues.back() += row[i];
         }
     }
-    saveDatabase(currentDatabase->name);
+    table.indexRowsFrom(firstRow);
+    if (UndoRecord *undo = addUndo(LogRecordType::INSERT, tableName))
+    {
+        undo->firstRow = firstRow;
+    }
+    logChange(std::move(record));
 }
-// 函数 deleteRecord 用于删除记录
-void MiniDB::deleteRecord(const std::string &tableName, const std::string &whereClause)
+
+// 函数 copyFrom 用于把 CSV 文件整批导入表中：每行一条记录，值的写法与 VALUES 相同。
+// 按大块读取文件，直接解析进列存储，全部导入后一次性建立索引并做检查点，而不是逐行写日志；
+// 任何一行出错时整批回滚
+void MiniDB::copyFrom(const std::string &tableName, const std::string &path, bool header)
 {
     if (!currentDatabase)
     {
         std::cerr << "No database selected." << std::endl;
         return;
     }
-
-    auto it = currentDatabase->tables.find(tableName);
-    if (it == currentDatabase->tables.end())
+    auto tableIt = currentDatabase->tables.find(tableName);
+    if (tableIt == currentDatabase->tables.end())
     {
-        std::cerr << "Table [" << tableName << "] does not exist." << std::endl;
+        std::cerr << "Table " << tableName << " does not exist." << std::endl;
+        return;
+    }
+    Table &table = tableIt->second;
+    if (!loadTable(table))
+    {
+        return;
+    }
+    ChunkedLineReader reader;
+    if (!reader.open(path))
+    {
+        std::cerr << "Failed to open file " << path << "." << std::endl;
         return;
     }
 
-    Table &table = it->second;
-
-    std::vector<std::pair<std::string, std::pair<std::string, std::string>>> conditions;
-    std::string logicalOperator = "AND";
-    parseWhereClause(whereClause, conditions, logicalOperator);
+    // 按每个值约 8 字节估计行数，预先为各列分配空间
+    size_t estimatedRows = reader.fileSize() / (table.columns.size() * 8 + 1);
+    table.reserveRows(table.rowCount + estimatedRows, reader.fileSize() / std::max<size_t>(table.columns.size(), 1));
 
-    auto recordIt = table.records.begin();
-    while (recordIt != table.records.end())
+    size_t firstRow = table.rowCount;
+    size_t lineNumber = 0;
+    std::string message;
+    std::string_view line;
+    std::vector<std::string_view> values;
+    while (reader.nextLine(line))
     {
-        if (evaluateCondition(tableName, *recordIt, conditions, logicalOperator))
+        lineNumber++;
+        if ((header && lineNumber == 1) || trimView(line).empty())
         {
-            recordIt = table.records.erase(recordIt);
+            continue;
         }
-        else
+        splitValues(line, values);
+        if (!table.appendValues(values, message, false))
         {
-            ++recordIt;
+            table.truncateRows(firstRow);
+            std::cerr << message << " (line " << lineNumber << ")" << std::endl;
+            return;
         }
     }
-
+    table.indexRowsFrom(firstRow);
+    // 事务中的 COPY 到提交时才做检查点
+    if (UndoRecord *undo = addUndo(LogRecordType::INSERT, tableName))
+    {
+        undo->firstRow = firstRow;
+        transaction.checkpoint = true;
+        return;
+    }
     saveDatabase(currentDatabase->name);
 }
-// 函数 parseWhereClause 用于解析 WHERE 子句
-void MiniDB::parseWhereClause(const std::string &whereClause, std::vector<std::pair<std::string, std::pair<std::string, std::string>>> &conditions, std::string &logicalOperator)
+
+bool MiniDB::isInteger(const std::string &value)
+{
+    int64_t parsed;
+    return parseInteger(value, parsed);
+}
+
+bool MiniDB::isFloat(const std::string &value)
+{
+    double parsed;
+    return parseFloat(value, parsed);
+}
+// 函数 bindScan 为单表语句准备扫描计划：已绑定时只换入新的常量，否则编译 WHERE 子句并在成功时记下绑定
+static void bindScan(Table &table, const WhereClause &where, ScanPlan &plan, BoundStatement *binding)
 {
-    if (whereClause.empty())
+    if (binding && binding->table)
+    {
+        replanScan(table, where.conditions, plan);
         return;
+    }
+    planScan(table, where.conditions, where.logicalOperator, plan);
+    if (binding && !plan.predicate.isAlwaysFalse())
+    {
+        binding->table = &table;
+    }
+}
+// 函数 sortLimit 返回 ORDER BY 需要排出的行数：OFFSET + LIMIT，没有 LIMIT 时为最大值
+static uint64_t sortLimit(const OrderClause &order)
+{
+    return order.limit > UINT64_MAX - order.offset ? UINT64_MAX : order.offset + order.limit;
+}
+// 函数 openSelect 为单表查询打开游标：解析输出列并准备扫描计划，满足条件的行在游标取数时才扫描出来；
+// 带 ORDER BY 时打开游标就完成扫描和排序
+bool MiniDB::openSelect(const std::string &tableName, std::vector<std::string> &columns, const WhereClause &where, const OrderClause &order, BoundStatement *binding, ResultCursor &cursor)
+{
+    cursor.reset();
+    if (currentDatabase == nullptr)
+    {
+        cursor.fail("No database selected.");
+        return false;
+    }
+    Table *bound = binding ? binding->table : nullptr;
+    Table *table = bound;
+    if (!table)
+    {
+        auto tableIt = currentDatabase->tables.find(tableName);
+        if (tableIt == currentDatabase->tables.end())
+        {
+            cursor.fail("Table " + tableName + " does not exist.");
+            return false;
+        }
+        table = &tableIt->second;
+    }
+    std::string message;
+    if (!table->materialize(message))
+    {
+        cursor.fail(message);
+        return false;
+    }
+    if (columns[0] == "*")
+    {
+        for (const auto &column : table->columns)
+        {
+            columns.push_back(column.name);
+        }
+    }
 
-    std::istringstream iss(whereClause);
-    std::string token, columnName, op, value;
-    while (iss >> token)
+    // WHERE 子句只编译一次，逐行求值时不再查表、查列或解析常量；等值条件命中索引时只访问候选行
+    std::vector<size_t> localColumns;
+    ScanPlan &plan = binding ? binding->scan : cursor.ownedPlan;
+    std::vector<size_t> &columnIndexes = binding ? binding->outputColumns : localColumns;
+    if (!bound)
     {
-        if (token == "AND" || token == "OR")
+        // 先解析出要输出的列下标，扫描时直接读取类型化的列
+        columnIndexes.clear();
+        for (const auto &columnName : columns)
         {
-            logicalOperator = token;
+            int index = table->findColumn(columnName);
+            if (index >= 0)
+            {
+                columnIndexes.push_back(static_cast<size_t>(index));
+            }
         }
-        else
+    }
+    bindScan(*table, where, plan, binding);
+    for (size_t index : columnIndexes)
+    {
+        cursor.columns.push_back({table->columns[index].name, &table->data[index], 0});
+    }
+    cursor.borrowedPlan = binding ? &binding->scan : nullptr;
+    cursor.rowCount = table->rowCount;
+    cursor.pool = plan.useParallelScan(table->rowCount, scanThreads) ? &scanThreads : nullptr;
+    cursor.kind = ResultCursor::Kind::SCAN;
+    cursor.skip = order.offset;
+    cursor.remaining = order.limit;
+    if (!order.items.empty())
+    {
+        std::vector<SortKey> keys;
+        for (const auto &item : order.items)
+        {
+            int index = table->findColumn(item.name.column);
+            if (index < 0)
+            {
+                cursor.fail("Column " + item.name.column + " does not exist.");
+                return false;
+            }
+            keys.push_back({&table->data[index], nullptr, item.descending});
+        }
+        // 有 LIMIT 时只保留前 OFFSET + LIMIT 行；扫描照常并行过滤，满足条件的行依次交给排序
+        cursor.sorter.setup(keys, sortMemoryBudget, sortLimit(order));
+        if (cursor.pool)
         {
-            columnName = token;
-            iss >> op;
-            getline(iss, value);
-            value = trim(value);
-            if (!value.empty() && value.front() == '\'' && value.back() == '\'')
+            std::vector<size_t> rows;
+            for (size_t begin = 0; begin < table->rowCount;)
             {
-                value = value.substr(1, value.length() - 2);
+                size_t end = std::min(table->rowCount, begin + scanThreads.threads() * MORSEL_ROWS);
+                rows.clear();
+                plan.parallelMatches(begin, end, scanThreads, rows);
+                for (size_t row : rows)
+                {
+                    cursor.sorter.add(row);
+                }
+                begin = end;
             }
-            conditions.emplace_back(columnName, std::make_pair(op, value));
         }
+        else
+        {
+            plan.forEachMatch(table->rowCount, [&](size_t row)
+                              { cursor.sorter.add(row); });
+        }
+        cursor.sorter.finish();
+        cursor.sorted = true;
     }
+    return true;
 }
-
-// 函数 evaluateCondition 用于评估条件
-bool MiniDB::evaluateCondition(const std::string &tableName, const Record &record, const std::vector<std::pair<std::string, std::pair<std::string, std::string>>> &conditions, const std::string &logicalOperator)
+// 函数 openJoin 为内连接打开游标：单表条件下推到对应的输入，完成连接后由游标分批交出行对
+bool MiniDB::openJoin(const std::string &tableName1, const std::string &tableName2, const std::string &base1, const std::string &base2, const std::string &column1, const std::string &column2, const WhereClause &where, ResultCursor &cursor)
 {
-    auto &table = currentDatabase->tables[tableName];
-    bool result = true; 
+    cursor.reset();
+    if (currentDatabase == nullptr)
+    {
+        cursor.fail("No database selected.");
+        return false;
+    }
+    auto &tables = currentDatabase->tables;
+    auto tableIt1 = tables.find(tableName1);
+    auto tableIt2 = tables.find(tableName2);
+    if (tableIt1 == tables.end() || tableIt2 == tables.end())
+    {
+        cursor.fail("Table " + (tableIt1 == tables.end() ? tableName1 : tableName2) + " does not exist.");
+        return false;
+    }
+    Table &table1 = tableIt1->second;
+    Table &table2 = tableIt2->second;
+    std::string message;
+    if (!table1.materialize(message) || !table2.materialize(message))
+    {
+        cursor.fail(message);
+        return false;
+    }
+    int index1 = table1.findColumn(base1);
+    int index2 = table2.findColumn(base2);
+    int index3 = table1.findColumn(column1);
+    int index4 = table2.findColumn(column2);
+    if (index1 < 0 || index2 < 0 || index3 < 0 || index4 < 0)
+    {
+        cursor.fail("Column does not exist.");
+        return false;
+    }
+    // 逻辑计划：单表条件下推到对应的输入，先过滤再连接
+    JoinPlan &plan = cursor.joinPlan;
+    planJoin(table1, table2, where.conditions, where.logicalOperator, plan);
+    JoinInput input1{&table1.data[index1], table1.rowCount, nullptr, table1.findIndexOn(index1), table1.findOrderedIndexOn(index1)};
+    JoinInput input2{&table2.data[index2], table2.rowCount, nullptr, table2.findIndexOn(index2), table2.findOrderedIndexOn(index2)};
+    std::vector<size_t> rows1, rows2;
+    // 条件能下推时先过滤；不能下推或没有条件时，表中有已删除的行也要先去掉
+    if (!plan.residualOr && !plan.leftFilter.empty())
+    {
+        plan.leftFilter.filter(table1.rowCount, rows1);
+        input1.rows = &rows1;
+    }
+    else if (table1.deleted.any())
+    {
+        table1.liveRows(rows1);
+        input1.rows = &rows1;
+    }
+    if (!plan.residualOr && !plan.rightFilter.empty())
+    {
+        plan.rightFilter.filter(table2.rowCount, rows2);
+        input2.rows = &rows2;
+    }
+    else if (table2.deleted.any())
+    {
+        table2.liveRows(rows2);
+        input2.rows = &rows2;
+    }
 
-    for (size_t i = 0; i < conditions.size(); ++i)
+    // 用哈希连接代替嵌套循环，连接键为 INTEGER 时按原生整数比较
+    cursor.pairs.clear();
+    hashJoin(input1, input2, joinMemoryBudget, cursor.pairs);
+    cursor.columns = {{tableName1 + "." + column1, &table1.data[index3], 0}, {tableName2 + "." + column2, &table2.data[index4], 1}};
+    cursor.kind = ResultCursor::Kind::JOIN;
+    return true;
+}
+// 函数 isAggregateQuery 判断单表查询是否带聚合函数或 GROUP BY
+static bool isAggregateQuery(const Statement &statement)
+{
+    if (!statement.groupBy.empty())
+        return true;
+    for (const auto &item : statement.selectList)
+    {
+        if (item.aggregate != AggregateFunction::NONE)
+            return true;
+    }
+    for (const auto &item : statement.order.items)
+    {
+        if (item.name.aggregate != AggregateFunction::NONE)
+            return true;
+    }
+    return false;
+}
+// 函数 openAggregate 为带聚合函数或 GROUP BY 的单表查询打开游标：满足条件的行在打开时逐行累加到哈希聚合器，
+// 不物化中间结果；大表按 morsel 并行聚合后再按 morsel 顺序合并
+bool MiniDB::openAggregate(const Statement &statement, BoundStatement *binding, ResultCursor &cursor)
+{
+    cursor.reset();
+    if (currentDatabase == nullptr)
+    {
+        cursor.fail("No database selected.");
+        return false;
+    }
+    Table *table = binding ? binding->table : nullptr;
+    if (!table)
     {
-        const auto &cond = conditions[i];
-        std::string columnName = cond.first;
-        std::string op = cond.second.first;
-        std::string value = cond.second.second;
-        if (value.front() == '\'' && value.back() == '\'')
+        auto tableIt = currentDatabase->tables.find(statement.table);
+        if (tableIt == currentDatabase->tables.end())
         {
-            value = value.substr(1, value.length() - 2);
+            cursor.fail("Table " + statement.table + " does not exist.");
+            return false;
         }
+        table = &tableIt->second;
+    }
+    std::string message;
+    if (!table->materialize(message))
+    {
+        cursor.fail(message);
+        return false;
+    }
+    if (statement.selectAll)
+    {
+        cursor.fail("SELECT * cannot be used with GROUP BY.");
+        return false;
+    }
 
-      
-        auto colIt = find_if(table.columns.begin(), table.columns.end(),
-                             [&columnName](const Column &col)
-                             { return col.name == columnName; });
-
-        if (colIt == table.columns.end())
+    std::vector<int> groupIndexes;
+    std::vector<const ColumnData *> groupColumns;
+    for (const auto &name : statement.groupBy)
+    {
+        int index = table->findColumn(name.column);
+        if (index < 0)
         {
-            std::cerr << "Column not found: " << columnName << std::endl;
+            cursor.fail("Column " + name.column + " does not exist.");
             return false;
         }
-
-        size_t columnIndex = distance(table.columns.begin(), colIt);
-
-        const Column &column = table.columns[columnIndex];
-        bool conditionResult = false;
-
-        if (column.type == "TEXT")
+        groupIndexes.push_back(index);
+        groupColumns.push_back(&table->data[index]);
+    }
+    // 输出列依次为分组列（取自代表行）或聚合结果（取自第 i 个聚合函数），相同的聚合函数只计算一次
+    std::vector<AggregateSpec> specs;
+    bool countOnly = true;
+    auto resolve = [&](const QualifiedName &item, int &index) -> bool
+    {
+        index = item.column == "*" ? -1 : table->findColumn(item.column);
+        if (item.column != "*" && index < 0)
         {
-            std::string tempValue = record.localValues[columnIndex];
-            if (tempValue.front() == '\'' && tempValue.back() == '\'')
-            {
-                tempValue = tempValue.substr(1, tempValue.length() - 2); 
-            }
-
-            if (op == "=")
-            {
-                conditionResult = (tempValue == value);
-            }
+            cursor.fail("Column " + item.column + " does not exist.");
+            return false;
         }
-        else if (column.type == "INTEGER")
+        if (item.aggregate == AggregateFunction::NONE)
         {
-            int recordValue = stoi(record.localValues[columnIndex]);
-            int targetValue = stoi(value);
-            if (op == "=")
-            {
-                conditionResult = (recordValue == targetValue);
-            }
-            else if (op == ">")
-            {
-                conditionResult = (recordValue > targetValue);
-            }
-            else if (op == "<")
+            if (std::find(groupIndexes.begin(), groupIndexes.end(), index) == groupIndexes.end())
             {
-                conditionResult = (recordValue < targetValue);
+                cursor.fail("Column " + item.column + " must appear in GROUP BY or be used in an aggregate function.");
+                return false;
             }
+            return true;
         }
-        else if (column.type == "FLOAT")
+        const ColumnData *column = index < 0 ? nullptr : &table->data[index];
+        if ((item.aggregate == AggregateFunction::SUM || item.aggregate == AggregateFunction::AVG) && column->getType() == ColumnType::TEXT)
         {
-            float recordValue = stof(record.localValues[columnIndex]);
-            float targetValue = stof(value);
-            if (op == "=")
-            {
-                conditionResult = (recordValue == targetValue);
-            }
-            else if (op == ">")
-            {
-                conditionResult = (recordValue > targetValue);
-            }
-            else if (op == "<")
-            {
-                conditionResult = (recordValue < targetValue);
-            }
+            cursor.fail(aggregateName(item.aggregate, item.column) + " requires a numeric column.");
+            return false;
         }
+        size_t spec = 0;
+        while (spec < specs.size() && !(specs[spec].function == item.aggregate && specs[spec].column == column))
+            spec++;
+        if (spec == specs.size())
+        {
+            countOnly = countOnly && item.aggregate == AggregateFunction::COUNT;
+            specs.push_back({item.aggregate, column});
+        }
+        index = -1 - static_cast<int>(spec);
+        return true;
+    };
+    std::vector<int> outputIndexes(statement.selectList.size());
+    for (size_t i = 0; i < statement.selectList.size(); ++i)
+    {
+        if (!resolve(statement.selectList[i], outputIndexes[i]))
+            return false;
+    }
+    // ORDER BY 中不在输出列里的聚合函数也一并计算
+    std::vector<int> orderIndexes(statement.order.items.size());
+    for (size_t i = 0; i < statement.order.items.size(); ++i)
+    {
+        if (!resolve(statement.order.items[i].name, orderIndexes[i]))
+            return false;
+    }
 
-        if (i == 0)
+    HashAggregator aggregator;
+    aggregator.setup(groupColumns, specs);
+    if (countOnly && groupColumns.empty() && statement.where.conditions.empty())
+    {
+        // 不带条件的 COUNT 直接由行数得出，不扫描
+        cursor.aggregateValues.assign(specs.size(), ColumnData(ColumnType::INTEGER));
+        for (auto &values : cursor.aggregateValues)
         {
-            result = conditionResult;
+            values.appendInt(static_cast<int64_t>(table->rowCount - table->deleted.count()));
         }
-        else if (logicalOperator == "AND")
+    }
+    else
+    {
+        ScanPlan &plan = binding ? binding->scan : cursor.ownedPlan;
+        bindScan(*table, statement.where, plan, binding);
+        if (plan.useParallelScan(table->rowCount, scanThreads))
         {
-            result = result && conditionResult;
+            // 每个 morsel 聚合到自己的局部聚合器，按 morsel 顺序合并后分组顺序与单线程扫描相同
+            size_t morsels = (table->rowCount + MORSEL_ROWS - 1) / MORSEL_ROWS;
+            std::vector<HashAggregator> parts(morsels, aggregator);
+            scanThreads.run(morsels, [&](size_t morsel)
+                            {
+                size_t from = morsel * MORSEL_ROWS;
+                size_t to = std::min(table->rowCount, from + MORSEL_ROWS);
+                HashAggregator &part = parts[morsel];
+                plan.predicate.forEachMatch(from, to, [&](size_t row)
+                                            { part.add(row); }); });
+            for (const auto &part : parts)
+            {
+                aggregator.merge(part);
+            }
         }
-        else if (logicalOperator == "OR")
+        else
         {
-            result = result || conditionResult;
+            plan.forEachMatch(table->rowCount, [&](size_t row)
+                              { aggregator.add(row); });
         }
+        cursor.aggregateValues.resize(specs.size());
+        for (size_t i = 0; i < specs.size(); ++i)
+        {
+            aggregator.result(i, cursor.aggregateValues[i]);
+        }
+        cursor.groupRows = aggregator.getGroupRows();
+    }
+
+    for (size_t i = 0; i < outputIndexes.size(); ++i)
+    {
+        const QualifiedName &item = statement.selectList[i];
+        int index = outputIndexes[i];
+        if (index >= 0)
+            cursor.columns.push_back({table->columns[index].name, &table->data[index], 1});
+        else
+            cursor.columns.push_back({aggregateName(item.aggregate, item.column), &cursor.aggregateValues[-1 - index], 0});
+    }
+    cursor.rowCount = cursor.aggregateValues.empty() ? cursor.groupRows.size() : cursor.aggregateValues[0].size();
+    cursor.kind = ResultCursor::Kind::AGGREGATE;
+    cursor.skip = statement.order.offset;
+    cursor.remaining = statement.order.limit;
+    if (!orderIndexes.empty())
+    {
+        // 结果行按分组列（经代表行）或聚合结果排序，排好的顺序记在 order 中
+        std::vector<SortKey> keys;
+        for (size_t i = 0; i < orderIndexes.size(); ++i)
+        {
+            int index = orderIndexes[i];
+            bool descending = statement.order.items[i].descending;
+            if (index >= 0)
+                keys.push_back({&table->data[index], &cursor.groupRows, descending});
+            else
+                keys.push_back({&cursor.aggregateValues[-1 - index], nullptr, descending});
+        }
+        RowSorter &sorter = cursor.sorter;
+        sorter.setup(keys, sortMemoryBudget, sortLimit(statement.order));
+        for (size_t row = 0; row < cursor.rowCount; ++row)
+        {
+            sorter.add(row);
+        }
+        sorter.finish();
+        while (sorter.next(cursor.order, ResultCursor::BATCH_ROWS))
+        {
+        }
+        sorter.clear();
+        cursor.rowCount = cursor.order.size();
+    }
+    return true;
+}
+// 函数 writeResult 取完游标中的结果并写入输出；storedFormat 为 true 时数值按存储格式输出
+void MiniDB::writeResult(ResultCursor &cursor, bool header, bool storedFormat)
+{
+    if (header)
+    {
+        std::vector<std::string> names;
+        for (size_t i = 0; i < cursor.columnCount(); ++i)
+        {
+            names.push_back(cursor.columnName(i));
+        }
+        results.header(names);
+    }
+    ResultBatch &batch = outputBatch;
+    while (cursor.next(batch))
+    {
+        for (size_t row = 0; row < batch.size(); ++row)
+        {
+            results.beginRow();
+            for (size_t column = 0; column < batch.columnCount(); ++column)
+            {
+                if (storedFormat)
+                    results.addStoredValue(batch.column(column), batch.rowAt(row, column));
+                else
+                    results.addValue(batch.column(column), batch.rowAt(row, column));
+            }
+            results.endRow();
+        }
+    }
+    results.endResult();
+}
+// 函数 select 用于查询表中的记录，结果经游标写入输出
+void MiniDB::select(const std::string &tableName, std::vector<std::string> &columns, const WhereClause &where, const OrderClause &order, BoundStatement *binding)
+{
+    if (currentDatabase == nullptr)
+    {
+        std::cout << "No database selected." << std::endl;
+        return;
+    }
+    // 表不存在时输出空结果
+    if (!(binding && binding->table) && currentDatabase->tables.find(tableName) == currentDatabase->tables.end())
+    {
+        results.endResult();
+        return;
+    }
+    ResultCursor &cursor = outputCursor;
+    if (!openSelect(tableName, columns, where, order, binding, cursor))
+    {
+        error(cursor.error());
+        return;
+    }
+    //只输出满足WHERE子句的记录，SELECT * 时先输出列名
+    writeResult(cursor, columns[0] == "*", false);
+}
+// 函数 aggregate 用于带聚合函数或 GROUP BY 的查询，每个分组输出一行
+void MiniDB::aggregate(const Statement &statement, BoundStatement *binding)
+{
+    ResultCursor &cursor = outputCursor;
+    if (!openAggregate(statement, binding, cursor))
+    {
+        error(cursor.error());
+        return;
+    }
+    writeResult(cursor, false, false);
+}
+// 函数 innerJoin 用于内连接两个表
+void MiniDB::innerJoin(const std::string &tableName1, const std::string &tableName2, const std::string &base1, const std::string &base2, const std::string &column1, const std::string &column2, const WhereClause &where)
+{
+    if (currentDatabase == nullptr)
+    {
+        std::cout << "No database selected." << std::endl;
+        return;
+    }
+    auto &tables = currentDatabase->tables;
+    auto tableIt1 = tables.find(tableName1);
+    auto tableIt2 = tables.find(tableName2);
+    if (tableIt1 == tables.end() || tableIt2 == tables.end())
+    {
+        std::cout << "Column does not exist." << std::endl;
+        return;
+    }
+    if (!loadTable(tableIt1->second) || !loadTable(tableIt2->second))
+    {
+        return;
+    }
+    ResultCursor &cursor = outputCursor;
+    if (!openJoin(tableName1, tableName2, base1, base2, column1, column2, where, cursor))
+    {
+        std::cout << cursor.error() << std::endl;
+        return;
+    }
+    writeResult(cursor, true, true);
+}
+// 函数 update 用于更新满足条件的记录
+void MiniDB::update(const std::string &tableName, const SetClause &set, const WhereClause &where, BoundStatement *binding)
+{
+    if (currentDatabase == nullptr)
+    {
+        std::cout << "No database selected." << std::endl;
+        return;
+    }
+    auto &db = *currentDatabase;
+    Table *bound = binding ? binding->table : nullptr;
+    if (!bound && db.tables.find(tableName) == db.tables.end())
+    {
+        std::cout << "Table does not exist." << std::endl;
+        return;
+    }
+    Table &table = bound ? *bound : db.tables[tableName];
+    if (!loadTable(table))
+    {
+        return;
+    }
+    ScanPlan localPlan;
+    ScanPlan &plan = binding ? binding->scan : localPlan;
+    bindScan(table, where, plan, binding);
+
+    int columnIndex = table.findColumn(set.column);
+    if (columnIndex < 0)
+    {
+        return;
+    }
+    ColumnData &target = table.data[columnIndex];
+    ColumnType type = target.getType();
+
+    // SET 的右侧形如 "列 运算符 常量" 时为算术更新，否则为常量赋值；常量只解析一次
+    std::string_view expression = set.expression;
+    char arithmetic = 0;
+    int sourceIndex = -1;
+    if (type != ColumnType::TEXT && set.op)
+    {
+        sourceIndex = table.findColumn(set.source);
+        if (sourceIndex >= 0 && table.columns[sourceIndex].type != ColumnType::TEXT)
+        {
+            arithmetic = set.op;
+            expression = set.operand;
+        }
+    }
+    int64_t intOperand = 0;
+    double floatOperand = 0;
+    bool isIntegerOperand = parseInteger(expression, intOperand);
+    if (type != ColumnType::TEXT && !parseFloat(expression, floatOperand))
+    {
+        std::cerr << "Error: Invalid value for " << columnTypeName(type) << " column." << std::endl;
+        return;
+    }
+    if (type == ColumnType::INTEGER && !arithmetic && !isIntegerOperand)
+    {
+        std::cerr << "Error: Invalid value for INTEGER column." << std::endl;
+        return;
+    }
+    if (arithmetic == '/' && floatOperand == 0)
+    {
+        std::cerr << "Error: Division by zero." << std::endl;
+        return;
+    }
+
+    // 计算某一行的新值并写入目标列
+    auto assign = [&](size_t row)
+    {
+        if (!arithmetic)
+        {
+            if (type == ColumnType::INTEGER)
+                target.setInt(row, intOperand);
+            else if (type == ColumnType::FLOAT)
+                target.setFloat(row, floatOperand);
+            else
+                target.setText(row, expression);
+            return;
+        }
+        const ColumnData &source = table.data[sourceIndex];
+        if (type == ColumnType::INTEGER && source.getType() == ColumnType::INTEGER && isIntegerOperand)
+        {
+            int64_t currentVal = source.intAt(row);
+            switch (arithmetic)
+            {
+            case '+':
+                target.setInt(row, currentVal + intOperand);
+                break;
+            case '-':
+                target.setInt(row, currentVal - intOperand);
+                break;
+            case '*':
+                target.setInt(row, currentVal * intOperand);
+                break;
+            default:
+                target.setInt(row, currentVal / intOperand);
+                break;
+            }
+            return;
+        }
+        double currentVal = source.getType() == ColumnType::INTEGER ? static_cast<double>(source.intAt(row)) : source.floatAt(row);
+        double result;
+        switch (arithmetic)
+        {
+        case '+':
+            result = currentVal + floatOperand;
+            break;
+        case '-':
+            result = currentVal - floatOperand;
+            break;
+        case '*':
+            result = currentVal * floatOperand;
+            break;
+        default:
+            result = currentVal / floatOperand;
+            break;
+        }
+        if (type == ColumnType::INTEGER)
+        {
+            target.setInt(row, static_cast<int64_t>(result));
+        }
+        else
+        {
+            // 运算结果保留两位小数
+            target.setFloat(row, std::round(result * 100) / 100);
+        }
+    };
+    // 目标列上的索引在修改前后分别删除、插入该行
+    std::vector<HashIndex *> affectedIndexes;
+    std::vector<OrderedIndex *> affectedOrdered;
+    for (auto &index : table.indexes)
+    {
+        if (index.column == static_cast<size_t>(columnIndex))
+        {
+            affectedIndexes.push_back(&index);
+        }
+    }
+    for (auto &index : table.orderedIndexes)
+    {
+        if (index.column == static_cast<size_t>(columnIndex))
+        {
+            affectedOrdered.push_back(&index);
+        }
+    }
+    // 日志只记录被修改的行和它们的新值
+    LogRecord record;
+    record.type = LogRecordType::UPDATE;
+    record.table = tableName;
+    record.column = static_cast<uint32_t>(columnIndex);
+    std::vector<size_t> &rows = record.rows;
+    plan.collectMatches(table.rowCount, scanThreads, rows);
+    record.newValues.resize(rows.size());
+    // 事务中先按行记下旧值
+    if (UndoRecord *undo = rows.empty() ? nullptr : addUndo(LogRecordType::UPDATE, tableName))
+    {
+        undo->column = record.column;
+        undo->rows.assign(rows.begin(), rows.end());
+        undo->oldValues = ColumnData(type);
+        undo->oldValues.reserve(rows.size());
+        for (size_t row : rows)
+        {
+            if (type == ColumnType::INTEGER)
+                undo->oldValues.appendInt(target.intAt(row));
+            else if (type == ColumnType::FLOAT)
+                undo->oldValues.appendFloat(target.floatAt(row));
+            else
+                undo->oldValues.appendText(target.textAt(row));
+        }
+    }
+    // 数值列上没有索引要维护时，各线程按 morsel 修改互不重叠的行；TEXT 列的字节区和索引只能单线程修改
+    if (affectedIndexes.empty() && affectedOrdered.empty() && type != ColumnType::TEXT && scanThreads.threads() > 1 && rows.size() >= 2 * MORSEL_ROWS)
+    {
+        // morsel 按匹配行划分，两个 morsel 的行可能落在同一段；段被快照共享时先在这里逐段复制，线程中不再复制
+        for (size_t i = 0; i < rows.size(); ++i)
+        {
+            if (i == 0 || (rows[i] >> COLUMN_SEGMENT_BITS) != (rows[i - 1] >> COLUMN_SEGMENT_BITS))
+                target.detachRow(rows[i]);
+        }
+        scanThreads.run((rows.size() + MORSEL_ROWS - 1) / MORSEL_ROWS, [&](size_t morsel)
+                        {
+            size_t end = std::min(rows.size(), (morsel + 1) * MORSEL_ROWS);
+            for (size_t i = morsel * MORSEL_ROWS; i < end; ++i)
+            {
+                assign(rows[i]);
+                target.appendValue(record.newValues[i], rows[i]);
+            } });
+    }
+    else
+    {
+        for (size_t i = 0; i < rows.size(); ++i)
+        {
+            size_t row = rows[i];
+            for (HashIndex *index : affectedIndexes)
+            {
+                index->eraseRow(target, row);
+            }
+            for (OrderedIndex *index : affectedOrdered)
+            {
+                index->eraseRow(target, row);
+            }
+            assign(row);
+            for (HashIndex *index : affectedIndexes)
+            {
+                index->insertRow(target, row);
+            }
+            for (OrderedIndex *index : affectedOrdered)
+            {
+                index->insertRow(target, row);
+            }
+            target.appendValue(record.newValues[i], row);
+        }
+    }
+    if (!record.rows.empty())
+    {
+        logChange(std::move(record));
+    }
+}
+// 函数 deleteRecord 用于删除记录
+void MiniDB::deleteRecord(const std::string &tableName, const WhereClause &where, BoundStatement *binding)
+{
+    if (!currentDatabase)
+    {
+        std::cerr << "No database selected." << std::endl;
+        return;
     }
 
-    return result;
-}
\ No newline at end of file
+    Table *bound = binding ? binding->table : nullptr;
+    if (!bound)
+    {
+        auto it = currentDatabase->tables.find(tableName);
+        if (it == currentDatabase->tables.end())
+        {
+            std::cerr << "Table [" << tableName << "] does not exist." << std::endl;
+            return;
+        }
+        bound = &it->second;
+    }
+
+    Table &table = *bound;
+    if (!loadTable(table))
+    {
+        return;
+    }
+
+    ScanPlan localPlan;
+    ScanPlan &plan = binding ? binding->scan : localPlan;
+    bindScan(table, where, plan, binding);
+
+    // 只在删除位图中标记要删除的行，不移动数据；已删除的行达到阈值时再一次性压缩
+    LogRecord record;
+    record.type = LogRecordType::TOMBSTONE;
+    record.table = tableName;
+    plan.collectMatches(table.rowCount, scanThreads, record.rows);
+    if (record.rows.empty())
+    {
+        return;
+    }
+    for (size_t row : record.rows)
+    {
+        table.deleted.mark(row);
+    }
+    if (UndoRecord *undo = addUndo(LogRecordType::TOMBSTONE, tableName))
+    {
+        undo->rows.assign(record.rows.begin(), record.rows.end());
+    }
+    logChange(std::move(record));
+    // 压缩会改变行号，事务中推迟到提交之后
+    if (!transaction.active && vacuumThreshold > 0 && table.deleted.count() * 100 >= table.rowCount * vacuumThreshold)
+    {
+        vacuumTable(currentDatabase->name, table);
+    }
+}
+// 函数 createIndex 用于在表的某一列上建立哈希索引，ordered 为 true 时建立有序索引（B+ 树）
+void MiniDB::createIndex(const std::string &indexName, const std::string &tableName, const std::string &columnName, bool ordered)
+{
+    if (!currentDatabase)
+    {
+        std::cerr << "No database selected." << std::endl;
+        return;
+    }
+    for (const auto &tablePair : currentDatabase->tables)
+    {
+        const Table &existing = tablePair.second;
+        bool found = std::any_of(existing.indexes.begin(), existing.indexes.end(), [&](const HashIndex &index)
+                                 { return index.name == indexName; }) ||
+                     std::any_of(existing.orderedIndexes.begin(), existing.orderedIndexes.end(), [&](const OrderedIndex &index)
+                                 { return index.name == indexName; });
+        if (found)
+        {
+            std::cerr << "Index " << indexName << " already exists." << std::endl;
+            return;
+        }
+    }
+    auto it = currentDatabase->tables.find(tableName);
+    if (it == currentDatabase->tables.end())
+    {
+        std::cerr << "Table [" << tableName << "] does not exist." << std::endl;
+        return;
+    }
+    Table &table = it->second;
+    if (!loadTable(table))
+    {
+        return;
+    }
+    int column = table.findColumn(columnName);
+    if (column < 0)
+    {
+        std::cerr << "Column does not exist." << std::endl;
+        return;
+    }
+    if (ordered)
+    {
+        ColumnType type = table.columns[column].type;
+        if (!OrderedIndex::supports(type))
+        {
+            std::cerr << "Error: Ordered index requires an INTEGER or FLOAT column." << std::endl;
+            return;
+        }
+        table.orderedIndexes.emplace_back(indexName, columnName, static_cast<size_t>(column), type);
+        table.orderedIndexes.back().build(table.data[column], table.rowCount);
+    }
+    else
+    {
+        table.indexes.emplace_back(indexName, columnName, static_cast<size_t>(column));
+        table.indexes.back().build(table.data[column], table.rowCount);
+    }
+    planCache.invalidate();
+    saveDatabase(currentDatabase->name);
+}
+// 函数 dropIndex 用于删除索引
+void MiniDB::dropIndex(const std::string &indexName)
+{
+    if (!currentDatabase)
+    {
+        std::cerr << "No database selected." << std::endl;
+        return;
+    }
+    for (auto &tablePair : currentDatabase->tables)
+    {
+        auto &indexes = tablePair.second.indexes;
+        for (auto it = indexes.begin(); it != indexes.end(); ++it)
+        {
+            if (it->name == indexName)
+            {
+                indexes.erase(it);
+                planCache.invalidate();
+                saveDatabase(currentDatabase->name);
+                return;
+            }
+        }
+        auto &orderedIndexes = tablePair.second.orderedIndexes;
+        for (auto it = orderedIndexes.begin(); it != orderedIndexes.end(); ++it)
+        {
+            if (it->name == indexName)
+            {
+                // 未读入的表中有序索引与文件中的段一一对应，删除前先读入
+                if (!loadTable(tablePair.second))
+                {
+                    return;
+                }
+                orderedIndexes.erase(it);
+                planCache.invalidate();
+                saveDatabase(currentDatabase->name);
+                return;
+            }
+        }
+    }
+    std::cerr << "Index [" << indexName << "] does not exist." << std::endl;
+}
+// 函数 addUndo 在事务中为当前语句的修改追加一条撤销记录
+UndoRecord *MiniDB::addUndo(LogRecordType type, const std::string &tableName)
+{
+    if (!transaction.active)
+    {
+        return nullptr;
+    }
+    transaction.undo.emplace_back();
+    UndoRecord &undo = transaction.undo.back();
+    undo.type = type;
+    undo.table = tableName;
+    return &undo;
+}
+// 函数 beginTransaction 用于开始事务：之后的修改先只作用在内存中，COMMIT 时一次写入日志
+void MiniDB::beginTransaction()
+{
+    if (!currentDatabase)
+    {
+        std::cerr << "No database selected." << std::endl;
+        return;
+    }
+    if (transaction.active)
+    {
+        error("A transaction is already in progress.");
+        return;
+    }
+    transaction.active = true;
+    transaction.database = currentDatabase->name;
+}
+// 函数 commitTransaction 用于提交事务：全部日志记录作为一帧写入并只刷盘一次，事务中有 COPY 时改为做一次检查点；
+// 推迟的自动压缩在写入之后进行
+void MiniDB::commitTransaction()
+{
+    if (!transaction.active)
+    {
+        error("No transaction is in progress.");
+        return;
+    }
+    std::string DBname = transaction.database;
+    std::vector<LogRecord> redo = std::move(transaction.redo);
+    bool needsCheckpoint = transaction.checkpoint;
+    transaction = Transaction();
+    if (needsCheckpoint)
+    {
+        saveDatabase(DBname);
+    }
+    else if (!redo.empty())
+    {
+        WriteAheadLog &log = logFor(DBname);
+        if (!log.appendTransaction(redo))
+        {
+            error("Failed to write log " + logFileName(DBname) + ".");
+            saveDatabase(DBname);
+        }
+        else if (log.getSize() > checkpointBytes)
+        {
+            saveDatabase(DBname);
+        }
+    }
+    if (vacuumThreshold == 0)
+    {
+        return;
+    }
+    Database &db = databases[DBname];
+    for (const LogRecord &record : redo)
+    {
+        auto it = record.type == LogRecordType::TOMBSTONE ? db.tables.find(record.table) : db.tables.end();
+        if (it != db.tables.end() && it->second.deleted.count() * 100 >= it->second.rowCount * vacuumThreshold)
+        {
+            vacuumTable(DBname, it->second);
+        }
+    }
+}
+// 函数 rollbackTransaction 用于回滚事务：按相反的顺序撤销各次修改，日志中没有留下任何记录。
+// 撤销可能换掉或删除表，绑定在计划中的表随之失效
+void MiniDB::rollbackTransaction()
+{
+    if (!transaction.active)
+    {
+        error("No transaction is in progress.");
+        return;
+    }
+    Database &db = databases[transaction.database];
+    for (auto it = transaction.undo.rbegin(); it != transaction.undo.rend(); ++it)
+    {
+        undoChange(db, *it);
+    }
+    transaction = Transaction();
+    planCache.invalidate();
+}
+// 函数 execute 按语句类型调用对应的操作
+void MiniDB::execute(const Statement &statement, BoundStatement *binding, ResultCursor *cursor)
+{
+    bool readsOnly = statement.type == StatementType::SELECT || statement.type == StatementType::JOIN || statement.type == StatementType::SET ||
+                     statement.type == StatementType::PREPARE || statement.type == StatementType::EXECUTE;
+    if (readOnly && !readsOnly)
+    {
+        report(cursor, "Error: snapshot readers can only run queries.");
+        return;
+    }
+    // 检查点和压缩会把未提交的修改写入文件或改变行号，建立和删除索引时也会保存数据库；事务也不能跨越数据库
+    if (transaction.active && (statement.type == StatementType::USE_DATABASE || statement.type == StatementType::CREATE_DATABASE ||
+                               statement.type == StatementType::CHECKPOINT || statement.type == StatementType::VACUUM ||
+                               statement.type == StatementType::CREATE_INDEX || statement.type == StatementType::DROP_INDEX))
+    {
+        report(cursor, "Error: this statement cannot run inside a transaction.");
+        return;
+    }
+    switch (statement.type)
+    {
+    case StatementType::CREATE_DATABASE:
+        createDatabase(statement.name);
+        break;
+    case StatementType::USE_DATABASE:
+        // 连续重复的 USE DATABASE 直接跳过
+        if (statement.name != lastUsedDatabase)
+        {
+            lastUsedDatabase = statement.name;
+            useDatabase(statement.name);
+        }
+        break;
+    case StatementType::CREATE_TABLE:
+        createTable(statement.table, statement.columns);
+        break;
+    case StatementType::DROP_TABLE:
+        dropTable(statement.table);
+        break;
+    case StatementType::CREATE_INDEX:
+        createIndex(statement.name, statement.table, statement.indexColumn, statement.ordered);
+        break;
+    case StatementType::DROP_INDEX:
+        dropIndex(statement.name);
+        break;
+    case StatementType::INSERT:
+        insertIntoTable(statement.table, statement.rows);
+        break;
+    case StatementType::SELECT:
+    {
+        if (isAggregateQuery(statement))
+        {
+            if (cursor)
+                openAggregate(statement, binding, *cursor);
+            else
+                aggregate(statement, binding);
+            break;
+        }
+        std::vector<std::string> columns;
+        if (statement.selectAll)
+        {
+            columns.push_back("*");
+        }
+        for (const auto &column : statement.selectList)
+        {
+            columns.push_back(column.column);
+        }
+        if (cursor)
+            openSelect(statement.table, columns, statement.where, statement.order, binding, *cursor);
+        else
+            select(statement.table, columns, statement.where, statement.order, binding);
+        break;
+    }
+    case StatementType::JOIN:
+    {
+        // 输出的两列决定连接两侧的表，ON 两侧的列按限定的表名分配；未限定的列依次属于 FROM 和 JOIN 后的表
+        if (statement.selectList.size() != 2)
+        {
+            report(cursor, "Error: INNER JOIN must select exactly two columns.");
+            break;
+        }
+        if (isAggregateQuery(statement))
+        {
+            report(cursor, "Error: aggregate functions and GROUP BY are not supported with INNER JOIN.");
+            break;
+        }
+        if (!statement.order.items.empty() || statement.order.limit != UINT64_MAX || statement.order.offset != 0)
+        {
+            report(cursor, "Error: ORDER BY and LIMIT are not supported with INNER JOIN.");
+            break;
+        }
+        const QualifiedName &first = statement.selectList[0];
+        const QualifiedName &second = statement.selectList[1];
+        std::string table1 = first.table.empty() ? statement.table : first.table;
+        std::string table2 = second.table.empty() ? statement.joinTable : second.table;
+        const QualifiedName *key1 = &statement.joinLeft;
+        const QualifiedName *key2 = &statement.joinRight;
+        if (key1->table == table2 && key2->table == table1)
+        {
+            std::swap(key1, key2);
+        }
+        if (cursor)
+            openJoin(table1, table2, key1->column, key2->column, first.column, second.column, statement.where, *cursor);
+        else
+            innerJoin(table1, table2, key1->column, key2->column, first.column, second.column, statement.where);
+        break;
+    }
+    case StatementType::UPDATE:
+        update(statement.table, statement.set, statement.where, binding);
+        break;
+    case StatementType::DELETE:
+        deleteRecord(statement.table, statement.where, binding);
+        break;
+    case StatementType::COPY:
+        copyFrom(statement.table, statement.value, statement.header);
+        break;
+    case StatementType::SET:
+        setOption(statement.name, statement.value);
+        break;
+    case StatementType::CHECKPOINT:
+        checkpoint();
+        break;
+    case StatementType::VACUUM:
+        vacuum(statement.table);
+        break;
+    case StatementType::PREPARE:
+    {
+        Statement prepared;
+        std::string message;
+        if (!parseStatement(statement.value, prepared, message))
+        {
+            std::cerr << "Invalid command: " << message << std::endl;
+            break;
+        }
+        if (prepared.type == StatementType::PREPARE || prepared.type == StatementType::EXECUTE)
+        {
+            std::cerr << "Invalid command: PREPARE cannot contain " << (prepared.type == StatementType::PREPARE ? "PREPARE" : "EXECUTE") << std::endl;
+            break;
+        }
+        planCache.prepare(statement.name, prepared);
+        break;
+    }
+    case StatementType::EXECUTE:
+    {
+        CachedPlan *plan = planCache.findPrepared(statement.name);
+        if (!plan)
+        {
+            report(cursor, "Prepared statement " + statement.name + " does not exist.");
+            break;
+        }
+        std::vector<std::string_view> values(statement.rows[0].begin(), statement.rows[0].end());
+        std::string message;
+        if (!bindParameters(plan->statement, values, message))
+        {
+            report(cursor, "Error: " + message);
+            break;
+        }
+        execute(plan->statement, &plan->binding, cursor);
+        break;
+    }
+    case StatementType::BEGIN:
+        beginTransaction();
+        break;
+    case StatementType::COMMIT:
+        commitTransaction();
+        break;
+    case StatementType::ROLLBACK:
+        rollbackTransaction();
+        break;
+    }
+    // 修改了表数据的语句结束时向快照读者发布新版本；EXECUTE 在执行预备语句时已经发布。
+    // 事务中的修改对读者不可见，到 COMMIT 时才发布，ROLLBACK 之后读者看到的版本本来就是事务开始之前的
+    if (!readsOnly && !transaction.active && statement.type != StatementType::USE_DATABASE && statement.type != StatementType::CREATE_DATABASE &&
+        statement.type != StatementType::CREATE_INDEX && statement.type != StatementType::DROP_INDEX &&
+        statement.type != StatementType::BEGIN && statement.type != StatementType::ROLLBACK)
+    {
+        publishSnapshot();
+    }
+}
+// 函数 dispatch 解析并执行一条语句。常量先被换成参数，得到的规范化文本作为计划缓存的键：
+// 命中时把本次的常量填入缓存的语法树并复用已绑定的计划，跳过语法分析、查表和查列
+void MiniDB::dispatch(const std::string &text, ResultCursor *cursor)
+{
+    std::string message;
+    if (!tokenize(text, tokens, message))
+    {
+        report(cursor, "Invalid command: " + message);
+        return;
+    }
+    std::string key;
+    std::vector<std::string_view> literals;
+    normalizeTokens(tokens, key, literals);
+    if (CachedPlan *plan = planCache.find(key))
+    {
+        if (bindParameters(plan->statement, literals, message))
+        {
+            execute(plan->statement, &plan->binding, cursor);
+            return;
+        }
+    }
+
+    Statement statement;
+    if (!parseTokens(text, tokens, statement, message))
+    {
+        // 常量出现在必须是字符串的位置（例如 COPY 的文件名）等情况下，按原文重新解析
+        if (!parseStatement(text, statement, message))
+        {
+            report(cursor, "Invalid command: " + message);
+            return;
+        }
+        execute(statement, nullptr, cursor);
+        return;
+    }
+    bool cacheable = statement.type == StatementType::INSERT || statement.type == StatementType::SELECT ||
+                     statement.type == StatementType::JOIN || statement.type == StatementType::UPDATE ||
+                     statement.type == StatementType::DELETE;
+    if (cacheable && statement.parameters.size() == literals.size())
+    {
+        CachedPlan &plan = planCache.insert(key, statement);
+        execute(plan.statement, &plan.binding, cursor);
+        return;
+    }
+    execute(statement, nullptr, cursor);
+}
+// 函数 report 报告语句的错误：打开游标时记入游标，否则打印到标准错误
+void MiniDB::report(ResultCursor *cursor, const std::string &message)
+{
+    if (cursor)
+        cursor->fail(message);
+    else
+        std::cerr << message << std::endl;
+}
+// 函数 publishSnapshot 把当前数据库各表的快照作为新版本发布，尚未读入内存的表先读入
+void MiniDB::publishSnapshot()
+{
+    if (snapshots.empty() || !currentDatabase)
+        return;
+    auto it = snapshots.find(currentDatabase->name);
+    if (it == snapshots.end())
+        return;
+    auto version = std::make_unique<DatabaseVersion>();
+    version->timestamp = ++commitTimestamp;
+    for (auto &tablePair : currentDatabase->tables)
+    {
+        if (loadTable(tablePair.second))
+            version->tables.emplace(tablePair.first, tablePair.second.snapshot());
+    }
+    it->second->publish(std::move(version));
+}
+// 函数 openReader 第一次为数据库打开读者时发布它的当前版本，之后每条修改数据的语句结束时发布新版本
+std::unique_ptr<SnapshotReader> MiniDB::openReader()
+{
+    if (!currentDatabase)
+    {
+        std::cerr << "No database selected." << std::endl;
+        return nullptr;
+    }
+    std::shared_ptr<SnapshotSource> &source = snapshots[currentDatabase->name];
+    if (!source)
+    {
+        source = std::make_shared<SnapshotSource>();
+        publishSnapshot();
+    }
+    int slot = source->acquireSlot();
+    if (slot < 0)
+    {
+        error("Too many snapshot readers.");
+        return nullptr;
+    }
+    return std::make_unique<SnapshotReader>(source, slot, currentDatabase->name);
+}
+// 函数 run 解析并执行一条语句，查询结果写入输出
+void MiniDB::run(const std::string &text)
+{
+    dispatch(text, nullptr);
+}
+// 函数 query 解析并执行一条语句，查询结果留在游标中。计划缓存中的扫描计划会被之后的语句改写，返回前游标复制一份
+ResultCursor MiniDB::query(const std::string &text)
+{
+    ResultCursor cursor;
+    dispatch(text, &cursor);
+    cursor.ownPlan();
+    return cursor;
+}
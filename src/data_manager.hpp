@@ -9,30 +9,74 @@
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
+#include "column_store.hpp"
+#include "index.hpp"
+#include "wal.hpp"
+#include "storage.hpp"
+#include "parser.hpp"
+#include "plan_cache.hpp"
+#include "result_sink.hpp"
+#include "result_cursor.hpp"
+#include "transaction.hpp"
+#include <memory>
+class SnapshotSource;
+class SnapshotReader;
 struct Column
 {
     std::string name;
-    std::string type;
+    ColumnType type;
 };
-struct Record
+// 尚未读入内存的表数据在数据库文件映射中的位置
+struct TableSource
 {
-    std::vector<std::string> localValues;
+    std::shared_ptr<const PageReader> file;
+    std::vector<SegmentRef> columns;        // 与 Table::columns 一一对应
+    std::vector<TextEncoding> encodings;    // 各列段的 TEXT 编码
+    std::vector<SegmentRef> orderedIndexes; // 与 Table::orderedIndexes 一一对应
 };
 class Table
 {
 public:
     std::string name;
     std::vector<Column> columns;
-    std::vector<Record> records;
+    std::vector<ColumnData> data; // 列式存储，与 columns 一一对应
+    size_t rowCount = 0; // 包括已删除但尚未压缩的行
+    Tombstones deleted;  // DELETE 标记的行，VACUUM 时才真正移除
+    std::vector<HashIndex> indexes;
+    std::vector<OrderedIndex> orderedIndexes;
+    std::shared_ptr<const TableSource> source; // 非空时表数据还在文件中，只有表结构和行数可用
     Table() = default;
     Table(const std::string &tableName) : name(tableName) {}
-    void addColumns(const std::string &columnName, const std::string &columnType);
+    void addColumns(const std::string &columnName, ColumnType columnType);
+    int findColumn(const std::string &columnName) const;
+    // 函数 appendRow 解析一行值并追加到各列；updateIndexes 为 false 时由调用方在整批追加后调用 indexRowsFrom
+    bool appendRow(std::string_view valueList, std::string &errorMessage, bool updateIndexes = true);
+    // 函数 appendValues 把已经拆分好的一行值追加到各列，任何一个值无效时整行回滚
+    bool appendValues(const std::vector<std::string_view> &values, std::string &errorMessage, bool updateIndexes = true);
+    void reserveRows(size_t rows, size_t textBytesPerColumn);
+    // 函数 truncateRows 丢弃 rows 行之后追加的行，用于回滚一批失败的追加
+    void truncateRows(size_t rows);
+    // 函数 indexRowsFrom 把 firstRow 之后追加的行加入索引；新行较多时直接整体重建
+    void indexRowsFrom(size_t firstRow);
+    void eraseRows(const std::vector<char> &erased);
+    // 函数 vacuum 一次性移除所有已删除的行并清空删除位图，之后的行号前移
+    void vacuum();
+    // 函数 liveRows 按升序列出所有未删除的行
+    void liveRows(std::vector<size_t> &rows) const;
+    const HashIndex *findIndexOn(size_t column) const;
+    const OrderedIndex *findOrderedIndexOn(size_t column) const;
+    void rebuildIndexes();
+    // 函数 materialize 在第一次访问时从文件映射中读入列数据并建立索引
+    bool materialize(std::string &errorMessage);
+    // 函数 snapshot 返回已读入内存的表的只读副本：各列和删除位图与原表共享未被修改的段，不复制索引
+    Table snapshot() const;
 };
 class Database
 {
 public:
     std::string name;
     std::unordered_map<std::string, Table> tables;
+    uint64_t checkpointLsn = 0; // 已写入数据库文件的最后一条日志记录
     Database() = default;
     Database(const std::string &dbName) : name(dbName) {}
     void addTable(const std::string &tableName);
@@ -41,7 +85,44 @@ class MiniDB
 {
 private:
     std::unordered_map<std::string, Database> databases;
-    Database *currentDatabase;
+    Database *currentDatabase = nullptr;
+    size_t joinMemoryBudget = 256 * 1024 * 1024; // 哈希连接超过此内存时分区落盘
+    size_t sortMemoryBudget = 64 * 1024 * 1024;  // ORDER BY 的排序缓冲区超过此内存时把有序段写入临时文件
+    std::unordered_map<std::string, WriteAheadLog> logs;
+    WalSyncMode walSyncMode = WalSyncMode::FULL;
+    size_t walGroupSize = 32;
+    uint64_t checkpointBytes = 16 * 1024 * 1024; // 日志超过此大小时自动做检查点
+    size_t vacuumThreshold = 25;                 // 已删除的行达到表的这个百分比时 DELETE 之后自动压缩，0 表示不自动压缩
+    PlanCache planCache;
+    std::string lastUsedDatabase;
+    std::vector<Token> tokens; // run 的记号缓冲区，在语句之间复用
+    ResultSink results{std::cout}; // 查询结果的缓冲输出，语句结束时写入 std::cout
+    ThreadPool scanThreads;        // 并行扫描的线程池，并行度由 SET THREADS 设置
+    ResultCursor outputCursor;     // select 和 innerJoin 输出结果时复用的游标和批
+    ResultBatch outputBatch;
+    bool readOnly = false;         // 快照读者内部的 MiniDB 只执行查询
+    uint64_t commitTimestamp = 0;  // 最近一次发布的版本的提交时间戳
+    std::unordered_map<std::string, std::shared_ptr<SnapshotSource>> snapshots; // 打开过读者的数据库，修改后向读者发布新版本
+    Transaction transaction;       // BEGIN 之后尚未提交的修改
+
+    friend class SnapshotReader;
+
+    WriteAheadLog &logFor(const std::string &DBname);
+    bool loadTable(Table &table);
+    // 函数 logChange 把一次修改写入日志；在事务中时只暂存记录，提交时一起写入
+    void logChange(LogRecord &&record);
+    // 函数 addUndo 在事务中追加一条撤销记录并返回它，不在事务中时返回空指针
+    UndoRecord *addUndo(LogRecordType type, const std::string &tableName);
+    void vacuumTable(const std::string &DBname, Table &table);
+    bool openSelect(const std::string &tableName, std::vector<std::string> &columns, const WhereClause &where, const OrderClause &order, BoundStatement *binding, ResultCursor &cursor);
+    bool openJoin(const std::string &tableName1, const std::string &tableName2, const std::string &base1, const std::string &base2, const std::string &column1, const std::string &column2, const WhereClause &where, ResultCursor &cursor);
+    bool openAggregate(const Statement &statement, BoundStatement *binding, ResultCursor &cursor);
+    void writeResult(ResultCursor &cursor, bool header, bool storedFormat);
+    // 函数 dispatch 解析并执行一条语句文本；cursor 不为空时 SELECT 和连接查询打开游标而不输出结果，出错信息也记入游标
+    void dispatch(const std::string &text, ResultCursor *cursor);
+    void report(ResultCursor *cursor, const std::string &message);
+    // 函数 publishSnapshot 在当前数据库有读者时把它的各表作为新版本发布
+    void publishSnapshot();
 
 public:
     Database *getCurrentDatabase() const
@@ -52,22 +133,53 @@ public:
     {
         std::cerr << "Error: " << message << std::endl;
     }
-    MiniDB() {};
+    MiniDB() { scanThreads.setThreads(std::thread::hardware_concurrency()); };
+    void setJoinMemoryBudget(size_t bytes)
+    {
+        joinMemoryBudget = bytes;
+    }
+    void setSortMemoryBudget(size_t bytes)
+    {
+        sortMemoryBudget = bytes;
+    }
     void createDatabase(const std::string &DBname);
     void useDatabase(const std::string &DBname);
-    void createTable(const std::string &command);
+    // 函数 switchDatabase 在服务器的会话之间切换当前数据库，DBname 为空时不选择任何数据库
+    void switchDatabase(const std::string &DBname);
+    void createTable(const std::string &tableName, const std::vector<std::pair<std::string, ColumnType>> &columns);
     void dropTable(const std::string &tableName);
     void loadDatabase(const std::string &DBname);
     void saveDatabase(const std::string &DBname);
-    void insertIntoTable(const std::string &command, const std::string &tableName, const std::vector<std::string> &values);
-    void select(const std::string &tableName, std::vector<std::string> &columns, const std::string &whereClause);
-    void innerJoin(const std::string &tableName1, const std::string &tableName2, const std::string &base1, const std::string &base2, const std::string &column1, const std::string &column2, const std::string &whereClause);
-    void update(const std::string &tableName, const std::string &setclause, const std::string &whereClause);
-    void deleteRecord(const std::string &tableName, const std::string &whereClause);
-    void parseWhereClause(const std::string &whereClause, std::vector<std::pair<std::string, std::pair<std::string, std::string>>> &conditions, std::string &logicalOperator);
+    bool convertDatabase(const std::string &DBname);
+    void checkpoint();
+    void vacuum(const std::string &tableName);
+    void setOption(const std::string &name, const std::string &value);
+    void insertIntoTable(const std::string &tableName, const std::vector<std::vector<std::string>> &rows);
+    void copyFrom(const std::string &tableName, const std::string &path, bool header);
+    // select、update 和 deleteRecord 的 binding 来自计划缓存：为空时照常解析，尚未绑定时记下解析结果，已绑定时直接复用
+    void select(const std::string &tableName, std::vector<std::string> &columns, const WhereClause &where, const OrderClause &order = OrderClause(), BoundStatement *binding = nullptr);
+    void innerJoin(const std::string &tableName1, const std::string &tableName2, const std::string &base1, const std::string &base2, const std::string &column1, const std::string &column2, const WhereClause &where);
+    void aggregate(const Statement &statement, BoundStatement *binding = nullptr);
+    void update(const std::string &tableName, const SetClause &set, const WhereClause &where, BoundStatement *binding = nullptr);
+    void deleteRecord(const std::string &tableName, const WhereClause &where, BoundStatement *binding = nullptr);
+    void createIndex(const std::string &indexName, const std::string &tableName, const std::string &columnName, bool ordered = false);
+    void dropIndex(const std::string &indexName);
+    void beginTransaction();
+    void commitTransaction();
+    void rollbackTransaction();
+    bool inTransaction() const { return transaction.active; }
+    // 函数 execute 执行一条解析好的语句；cursor 不为空时查询结果留在游标中，由调用方取出
+    void execute(const Statement &statement, BoundStatement *binding = nullptr, ResultCursor *cursor = nullptr);
+    // 函数 run 解析并执行一条语句文本（结尾可以有一个分号，不能包含多条语句），重复出现的语句形状直接使用计划缓存
+    void run(const std::string &text);
+    // 函数 query 执行一条语句并返回结果游标，供把 MiniDB 作为库嵌入的程序按批读取类型化的结果行；
+    // 不是查询的语句照常执行，返回的游标没有结果集。出错时 ok() 为 false，error() 给出原因
+    ResultCursor query(const std::string &text);
+    // 函数 openReader 为当前数据库打开一个快照读者，可以交给其他线程在写入的同时执行查询；
+    // 没有选择数据库或读者过多时打印原因并返回空指针
+    std::unique_ptr<SnapshotReader> openReader();
 
     bool isInteger(const std::string &value);
     bool isFloat(const std::string &value);
-    bool evaluateCondition(const std::string &tableName, const Record &record, const std::vector<std::pair<std::string, std::pair<std::string, std::string>>> &conditions, const std::string &logicalOperator);
 };
 #endif
\ No newline at end of file
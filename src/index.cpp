@@ -0,0 +1,305 @@
+#include "index.hpp"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+uint64_t HashIndex::floatKey(double value)
+{
+    if (value == 0)
+        value = 0; // -0.0 与 0.0 视为同一个键
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+uint64_t HashIndex::textKey(std::string_view value)
+{
+    return std::hash<std::string_view>()(value);
+}
+
+uint64_t HashIndex::keyOf(const ColumnData &data, size_t row)
+{
+    switch (data.getType())
+    {
+    case ColumnType::INTEGER:
+        return intKey(data.intAt(row));
+    case ColumnType::FLOAT:
+        return floatKey(data.floatAt(row));
+    default:
+        return textKey(stripQuotes(data.textAt(row)));
+    }
+}
+
+void HashIndex::clear()
+{
+    slots.clear();
+    usedSlots = 0;
+    rowPool.clear();
+    liveRows = 0;
+}
+
+void HashIndex::growSlots(size_t slotCount)
+{
+    std::vector<Slot> old(slotCount, Slot{0, 0, 0, 0});
+    old.swap(slots);
+    size_t mask = slots.size() - 1;
+    for (const Slot &slot : old)
+    {
+        if (slot.capacity == 0)
+            continue;
+        size_t i = slotHash(slot.key, mask);
+        while (slots[i].capacity != 0)
+            i = (i + 1) & mask;
+        slots[i] = slot;
+    }
+}
+
+HashIndex::Slot &HashIndex::slotFor(uint64_t key)
+{
+    // 装填因子保持在 3/4 以下
+    if ((usedSlots + 1) * 4 > slots.size() * 3)
+        growSlots(std::max<size_t>(16, slots.size() * 2));
+    size_t mask = slots.size() - 1;
+    size_t i = slotHash(key, mask);
+    while (slots[i].capacity != 0 && slots[i].key != key)
+        i = (i + 1) & mask;
+    Slot &slot = slots[i];
+    if (slot.capacity == 0)
+    {
+        // 新键先在池尾占一个位置
+        slot = Slot{key, rowPool.size(), 0, 1};
+        rowPool.push_back(0);
+        usedSlots++;
+    }
+    return slot;
+}
+
+void HashIndex::compact()
+{
+    std::vector<Slot> old;
+    old.swap(slots);
+    std::vector<size_t> oldPool;
+    oldPool.swap(rowPool);
+    usedSlots = 0;
+    rowPool.reserve(liveRows);
+    for (const Slot &slot : old)
+    {
+        if (slot.capacity == 0 || slot.count == 0)
+            continue;
+        Slot &moved = slotFor(slot.key);
+        rowPool.pop_back(); // slotFor 为新键预留的位置由下面整段代替
+        moved.offset = rowPool.size();
+        rowPool.insert(rowPool.end(), oldPool.begin() + slot.offset, oldPool.begin() + slot.offset + slot.count);
+        moved.count = slot.count;
+        moved.capacity = slot.count;
+    }
+}
+
+// 函数 build 用于按列的全部数据重建索引：第一遍数出每个键的行数，按计数一次分好各段，第二遍填入行号，
+// 行号天然按升序写入
+void HashIndex::build(const ColumnData &data, size_t rowCount)
+{
+    clear();
+    std::vector<uint64_t> keys(rowCount);
+    const size_t sample = 4096;
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        keys[row] = keyOf(data, row);
+        slotFor(keys[row]).count++;
+        // 前 sample 行中大多是不同的键时，按全表的键数一次分配好槽数组，免得一路翻倍重排
+        if (row + 1 == sample && usedSlots * 2 > sample)
+        {
+            size_t slotCount = slots.size();
+            while (slotCount * 3 < rowCount * 4)
+                slotCount *= 2;
+            growSlots(slotCount);
+        }
+    }
+    uint64_t offset = 0;
+    for (Slot &slot : slots)
+    {
+        if (slot.capacity == 0)
+            continue;
+        slot.offset = offset;
+        slot.capacity = slot.count;
+        offset += slot.count;
+        slot.count = 0;
+    }
+    rowPool.assign(offset, 0);
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        Slot &slot = *findSlot(keys[row]);
+        rowPool[slot.offset + slot.count++] = row;
+    }
+    liveRows = rowCount;
+}
+
+void HashIndex::insertRow(const ColumnData &data, size_t row)
+{
+    Slot &slot = slotFor(keyOf(data, row));
+    if (slot.count == slot.capacity)
+    {
+        if (slot.offset + slot.capacity == rowPool.size())
+        {
+            // 段在池尾时原地延长
+            rowPool.resize(rowPool.size() + slot.capacity);
+        }
+        else
+        {
+            uint64_t offset = rowPool.size();
+            rowPool.resize(rowPool.size() + 2 * size_t(slot.capacity));
+            std::copy(rowPool.begin() + slot.offset, rowPool.begin() + slot.offset + slot.count, rowPool.begin() + offset);
+            slot.offset = offset;
+        }
+        slot.capacity *= 2;
+    }
+    size_t *first = rowPool.data() + slot.offset;
+    size_t *last = first + slot.count;
+    if (slot.count == 0 || last[-1] < row)
+        *last = row;
+    else
+    {
+        size_t *pos = std::lower_bound(first, last, row);
+        std::copy_backward(pos, last, last + 1);
+        *pos = row;
+    }
+    slot.count++;
+    liveRows++;
+    if (rowPool.size() > 2 * liveRows + 1024)
+        compact();
+}
+
+// 函数 eraseRow 必须在修改该行的值之前调用；键的行全部删除后槽仍然保留，直到下一次压缩
+void HashIndex::eraseRow(const ColumnData &data, size_t row)
+{
+    Slot *slot = findSlot(keyOf(data, row));
+    if (!slot)
+        return;
+    size_t *first = rowPool.data() + slot->offset;
+    size_t *last = first + slot->count;
+    size_t *pos = std::lower_bound(first, last, row);
+    if (pos == last || *pos != row)
+        return;
+    std::copy(pos + 1, last, pos);
+    slot->count--;
+    liveRows--;
+}
+
+void OrderedIndex::build(const ColumnData &data, size_t rowCount)
+{
+    if (type == ColumnType::INTEGER)
+    {
+        std::vector<BPlusTree<int64_t>::Entry> entries(rowCount);
+        for (size_t row = 0; row < rowCount; ++row)
+            entries[row] = {data.intAt(row), row};
+        std::sort(entries.begin(), entries.end());
+        ints.bulkLoad(entries);
+    }
+    else
+    {
+        std::vector<BPlusTree<double>::Entry> entries(rowCount);
+        for (size_t row = 0; row < rowCount; ++row)
+            entries[row] = {data.floatAt(row), row};
+        std::sort(entries.begin(), entries.end());
+        floats.bulkLoad(entries);
+    }
+}
+
+void OrderedIndex::insertRow(const ColumnData &data, size_t row)
+{
+    if (type == ColumnType::INTEGER)
+        ints.insert(data.intAt(row), row);
+    else
+        floats.insert(data.floatAt(row), row);
+}
+
+// 函数 eraseRow 必须在修改该行的值之前调用
+void OrderedIndex::eraseRow(const ColumnData &data, size_t row)
+{
+    if (type == ColumnType::INTEGER)
+        ints.erase(data.intAt(row), row);
+    else
+        floats.erase(data.floatAt(row), row);
+}
+
+template <typename Key>
+static bool collectFromTree(const BPlusTree<Key> &tree, bool hasLower, Key lower, bool lowerInclusive,
+                            bool hasUpper, Key upper, bool upperInclusive, size_t limit, std::vector<size_t> &rows)
+{
+    auto it = hasLower ? tree.lowerBound(lower, lowerInclusive) : tree.begin();
+    for (; it.valid(); it.next())
+    {
+        if (hasUpper && (upper < it.key() || (!upperInclusive && !(it.key() < upper))))
+            break;
+        if (rows.size() >= limit)
+            return false;
+        rows.push_back(static_cast<size_t>(it.row()));
+    }
+    return true;
+}
+
+bool OrderedIndex::collectRange(const KeyRange &range, size_t limit, std::vector<size_t> &rows) const
+{
+    rows.clear();
+    bool complete = type == ColumnType::INTEGER
+                        ? collectFromTree(ints, range.hasLower, range.intLower, range.lowerInclusive, range.hasUpper, range.intUpper, range.upperInclusive, limit, rows)
+                        : collectFromTree(floats, range.hasLower, range.floatLower, range.lowerInclusive, range.hasUpper, range.floatUpper, range.upperInclusive, limit, rows);
+    if (!complete)
+        return false;
+    std::sort(rows.begin(), rows.end());
+    return true;
+}
+
+template <typename Key>
+static void saveTree(std::string &out, const BPlusTree<Key> &tree)
+{
+    std::vector<typename BPlusTree<Key>::Entry> entries;
+    tree.toSorted(entries);
+    uint64_t count = entries.size();
+    out.append(reinterpret_cast<const char *>(&count), sizeof(count));
+    for (const auto &entry : entries)
+    {
+        out.append(reinterpret_cast<const char *>(&entry.key), sizeof(entry.key));
+        out.append(reinterpret_cast<const char *>(&entry.row), sizeof(entry.row));
+    }
+}
+
+template <typename Key>
+static bool loadTree(std::string_view bytes, size_t rowCount, BPlusTree<Key> &tree)
+{
+    const size_t entryBytes = sizeof(Key) + sizeof(uint64_t);
+    uint64_t count = 0;
+    if (bytes.size() < sizeof(count))
+        return false;
+    std::memcpy(&count, bytes.data(), sizeof(count));
+    bytes.remove_prefix(sizeof(count));
+    if (count != rowCount || bytes.size() != count * entryBytes)
+        return false;
+    std::vector<typename BPlusTree<Key>::Entry> entries(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char *entry = bytes.data() + i * entryBytes;
+        std::memcpy(&entries[i].key, entry, sizeof(Key));
+        std::memcpy(&entries[i].row, entry + sizeof(Key), sizeof(uint64_t));
+        if (entries[i].row >= rowCount)
+            return false;
+        // 条目必须严格递增，否则数据已损坏，交给调用方重建
+        if (i > 0 && !(entries[i - 1] < entries[i]))
+            return false;
+    }
+    tree.bulkLoad(entries);
+    return true;
+}
+
+void OrderedIndex::save(std::string &out) const
+{
+    if (type == ColumnType::INTEGER)
+        saveTree(out, ints);
+    else
+        saveTree(out, floats);
+}
+
+bool OrderedIndex::load(std::string_view bytes, size_t rowCount)
+{
+    return type == ColumnType::INTEGER ? loadTree(bytes, rowCount, ints) : loadTree(bytes, rowCount, floats);
+}
@@ -0,0 +1,157 @@
+#ifndef INDEX_HPP
+#define INDEX_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "column_store.hpp"
+#include "bptree.hpp"
+
+// 哈希索引中一个键的行号，按升序排列；指向索引内部的存储，索引被修改后失效
+struct PostingList
+{
+    const size_t *rows = nullptr;
+    size_t count = 0;
+
+    const size_t *begin() const { return rows; }
+    const size_t *end() const { return rows + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+};
+
+// 类 HashIndex 是表上的二级哈希索引：键值 -> 按升序排列的行号
+// INTEGER/FLOAT 按原生值精确匹配；TEXT 按去掉引号后的文本哈希，查到的行需要调用方再核对一次。
+// 键放在开放寻址的槽数组中，所有键的行号连续存放在同一个行号池里，每个键占池中的一段：
+// 建索引时先计数再一次性分段，不为每个键单独分配内存；段满时在池尾分配两倍大小的新段（bump-pointer），
+// 旧段成为空洞，空洞过多时整体压缩
+class HashIndex
+{
+public:
+    std::string name;
+    std::string columnName;
+    size_t column = 0;
+
+    HashIndex() = default;
+    HashIndex(const std::string &indexName, const std::string &indexColumnName, size_t columnIndex)
+        : name(indexName), columnName(indexColumnName), column(columnIndex) {}
+
+    void build(const ColumnData &data, size_t rowCount);
+    void insertRow(const ColumnData &data, size_t row);
+    void eraseRow(const ColumnData &data, size_t row);
+    void clear();
+
+    static uint64_t intKey(int64_t value) { return static_cast<uint64_t>(value); }
+    static uint64_t floatKey(double value);
+    static uint64_t textKey(std::string_view value); // value 为去掉引号后的文本
+    static uint64_t keyOf(const ColumnData &data, size_t row);
+
+    // 返回键对应的行号列表，不存在时返回空列表
+    PostingList find(uint64_t key) const
+    {
+        const Slot *slot = findSlot(key);
+        return slot ? PostingList{rowPool.data() + slot->offset, slot->count} : PostingList();
+    }
+
+private:
+    // 一个键的槽：行号在 rowPool[offset, offset + count) 中，段的容量为 capacity；capacity 为 0 表示空槽
+    struct Slot
+    {
+        uint64_t key;
+        uint64_t offset;
+        uint32_t count;
+        uint32_t capacity;
+    };
+
+    std::vector<Slot> slots; // 大小为 2 的幂，线性探测
+    size_t usedSlots = 0;
+    std::vector<size_t> rowPool;
+    size_t liveRows = 0; // 池中有效的行号个数，其余为空洞或段尾的余量
+
+    static size_t slotHash(uint64_t key, size_t mask) { return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask; }
+    const Slot *findSlot(uint64_t key) const
+    {
+        if (slots.empty())
+            return nullptr;
+        size_t mask = slots.size() - 1;
+        for (size_t i = slotHash(key, mask);; i = (i + 1) & mask)
+        {
+            const Slot &slot = slots[i];
+            if (slot.capacity == 0)
+                return nullptr;
+            if (slot.key == key)
+                return &slot;
+        }
+    }
+    Slot *findSlot(uint64_t key) { return const_cast<Slot *>(static_cast<const HashIndex *>(this)->findSlot(key)); }
+    // 函数 slotFor 返回键的槽，不存在时占用一个空槽；槽数组可能因此扩容，之前取得的槽指针失效
+    Slot &slotFor(uint64_t key);
+    void growSlots(size_t slotCount);
+    // 函数 compact 丢弃空洞和已经没有行的键，把各段重新紧密排列
+    void compact();
+};
+
+// 范围条件的上下界，INTEGER 列使用 int 字段，FLOAT 列使用 float 字段
+struct KeyRange
+{
+    bool hasLower = false;
+    bool lowerInclusive = false;
+    bool hasUpper = false;
+    bool upperInclusive = false;
+    int64_t intLower = 0;
+    int64_t intUpper = 0;
+    double floatLower = 0;
+    double floatUpper = 0;
+};
+
+// 类 OrderedIndex 是建立在 INTEGER/FLOAT 列上的有序索引（B+ 树），用于范围查询、有序输出和归并连接
+class OrderedIndex
+{
+public:
+    std::string name;
+    std::string columnName;
+    size_t column = 0;
+    ColumnType type = ColumnType::INTEGER;
+
+    OrderedIndex() = default;
+    OrderedIndex(const std::string &indexName, const std::string &indexColumnName, size_t columnIndex, ColumnType columnType)
+        : name(indexName), columnName(indexColumnName), column(columnIndex), type(columnType) {}
+
+    static bool supports(ColumnType columnType) { return columnType != ColumnType::TEXT; }
+
+    void build(const ColumnData &data, size_t rowCount);
+    void insertRow(const ColumnData &data, size_t row);
+    void eraseRow(const ColumnData &data, size_t row);
+
+    // 函数 collectRange 按行号升序收集范围内的行；超过 limit 行时放弃并返回 false
+    bool collectRange(const KeyRange &range, size_t limit, std::vector<size_t> &rows) const;
+
+    // 函数 forEachInOrder 按键值顺序（键相同时按行号）访问每一行
+    template <typename Visit>
+    void forEachInOrder(Visit &&visit) const
+    {
+        if (type == ColumnType::INTEGER)
+        {
+            for (auto it = ints.begin(); it.valid(); it.next())
+                visit(static_cast<size_t>(it.row()));
+        }
+        else
+        {
+            for (auto it = floats.begin(); it.valid(); it.next())
+                visit(static_cast<size_t>(it.row()));
+        }
+    }
+
+    const BPlusTree<int64_t> &intTree() const { return ints; }
+    const BPlusTree<double> &floatTree() const { return floats; }
+
+    // 函数 save / load 以二进制形式读写排好序的条目，加载时直接批量建树而无需重新排序
+    void save(std::string &out) const;
+    bool load(std::string_view bytes, size_t rowCount);
+
+private:
+    BPlusTree<int64_t> ints;
+    BPlusTree<double> floats;
+};
+
+#endif // INDEX_HPP
@@ -0,0 +1,390 @@
+#include "join.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+    // 连接键的比较方式：两侧类型相同时按原生类型比较，否则按存储文本比较
+    enum class KeyMode
+    {
+        INTEGER,
+        FLOAT,
+        TEXT,
+        FORMATTED
+    };
+
+    struct HashedRow
+    {
+        uint64_t hash;
+        size_t row;
+    };
+
+    // 每个建表行的大致内存占用：桶头、链表、行号和哈希值
+    const size_t BYTES_PER_BUILD_ROW = 40;
+    const size_t MAX_PARTITIONS = 128;
+
+    uint64_t mix(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    class KeyReader
+    {
+    public:
+        KeyReader(const ColumnData *keyColumn, KeyMode keyMode) : column(keyColumn), mode(keyMode) {}
+
+        uint64_t hash(size_t row) const
+        {
+            switch (mode)
+            {
+            case KeyMode::INTEGER:
+                return mix(static_cast<uint64_t>(column->intAt(row)));
+            case KeyMode::FLOAT:
+            {
+                double value = column->floatAt(row);
+                if (value == 0)
+                    value = 0; // 让 -0.0 与 0.0 落在同一个桶
+                uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return mix(bits);
+            }
+            case KeyMode::TEXT:
+                return mix(std::hash<std::string_view>()(column->textAt(row)));
+            default:
+                scratch.clear();
+                column->appendValue(scratch, row);
+                return mix(std::hash<std::string_view>()(scratch));
+            }
+        }
+
+        bool equals(size_t row, const KeyReader &other, size_t otherRow) const
+        {
+            switch (mode)
+            {
+            case KeyMode::INTEGER:
+                return column->intAt(row) == other.column->intAt(otherRow);
+            case KeyMode::FLOAT:
+                return column->floatAt(row) == other.column->floatAt(otherRow);
+            case KeyMode::TEXT:
+                return column->textAt(row) == other.column->textAt(otherRow);
+            default:
+                scratch.clear();
+                other.scratch.clear();
+                column->appendValue(scratch, row);
+                other.column->appendValue(other.scratch, otherRow);
+                return scratch == other.scratch;
+            }
+        }
+
+    private:
+        const ColumnData *column;
+        KeyMode mode;
+        mutable std::string scratch;
+    };
+
+    // 链式哈希表，所有桶和链表都保存在连续数组中，不为每个键单独分配内存
+    class BuildTable
+    {
+    public:
+        void build(const std::vector<HashedRow> &entries)
+        {
+            size_t bucketCount = 16;
+            while (bucketCount < entries.size() * 2)
+                bucketCount <<= 1;
+            mask = bucketCount - 1;
+            heads.assign(bucketCount, 0);
+            next.assign(entries.size() + 1, 0);
+            rows.resize(entries.size() + 1);
+            hashes.resize(entries.size() + 1);
+            // 逆序插入到链表头部，使每条链按行号升序排列
+            for (size_t i = entries.size(); i > 0; --i)
+            {
+                const HashedRow &entry = entries[i - 1];
+                size_t bucket = entry.hash & mask;
+                rows[i] = entry.row;
+                hashes[i] = entry.hash;
+                next[i] = heads[bucket];
+                heads[bucket] = i;
+            }
+        }
+
+        template <typename Emit>
+        void probe(uint64_t hash, size_t probeRow, const KeyReader &probeKey, const KeyReader &buildKey, Emit &&emit) const
+        {
+            for (size_t i = heads[hash & mask]; i != 0; i = next[i])
+            {
+                if (hashes[i] == hash && buildKey.equals(rows[i], probeKey, probeRow))
+                {
+                    emit(rows[i], probeRow);
+                }
+            }
+        }
+
+    private:
+        size_t mask = 0;
+        std::vector<size_t> heads;
+        std::vector<size_t> next;
+        std::vector<size_t> rows;
+        std::vector<uint64_t> hashes;
+    };
+
+    KeyMode chooseKeyMode(const ColumnData &left, const ColumnData &right)
+    {
+        if (left.getType() != right.getType())
+            return KeyMode::FORMATTED;
+        switch (left.getType())
+        {
+        case ColumnType::INTEGER:
+            return KeyMode::INTEGER;
+        case ColumnType::FLOAT:
+            return KeyMode::FLOAT;
+        default:
+            return KeyMode::TEXT;
+        }
+    }
+
+    void hashRows(const KeyReader &key, const JoinInput &input, std::vector<HashedRow> &entries)
+    {
+        entries.clear();
+        entries.reserve(input.size());
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            size_t row = input.rowAt(i);
+            entries.push_back({key.hash(row), row});
+        }
+    }
+
+    void sortPairs(std::vector<JoinPair> &pairs)
+    {
+        std::sort(pairs.begin(), pairs.end(), [](const JoinPair &a, const JoinPair &b)
+                  { return a.left != b.left ? a.left < b.left : a.right < b.right; });
+    }
+
+    bool readPartition(std::FILE *file, std::vector<HashedRow> &entries)
+    {
+        long bytes = std::ftell(file);
+        if (bytes < 0)
+            return false;
+        entries.resize(static_cast<size_t>(bytes) / sizeof(HashedRow));
+        std::rewind(file);
+        return std::fread(entries.data(), sizeof(HashedRow), entries.size(), file) == entries.size();
+    }
+
+    // 函数 graceJoin 先按哈希值的高位把两侧行号写入磁盘上的分区文件，再逐个分区建表和探测
+    bool graceJoin(const KeyReader &buildKey, const JoinInput &build, const KeyReader &probeKey, const JoinInput &probe,
+                   bool buildIsLeft, size_t partitionCount, std::vector<JoinPair> &pairs)
+    {
+        int partitionBits = 0;
+        while ((size_t(1) << partitionBits) < partitionCount)
+            partitionBits++;
+        partitionCount = size_t(1) << partitionBits;
+
+        std::vector<std::FILE *> buildFiles(partitionCount, nullptr), probeFiles(partitionCount, nullptr);
+        auto closeAll = [&]()
+        {
+            for (size_t i = 0; i < partitionCount; ++i)
+            {
+                if (buildFiles[i])
+                    std::fclose(buildFiles[i]);
+                if (probeFiles[i])
+                    std::fclose(probeFiles[i]);
+            }
+        };
+        for (size_t i = 0; i < partitionCount; ++i)
+        {
+            buildFiles[i] = std::tmpfile();
+            probeFiles[i] = std::tmpfile();
+            if (!buildFiles[i] || !probeFiles[i])
+            {
+                closeAll();
+                return false;
+            }
+        }
+
+        // 写分区失败（例如磁盘已满）时分区读回来会变短，连接结果会少行，所以每次写入和最后的刷新都要检查
+        auto spill = [&](const KeyReader &key, const JoinInput &input, std::vector<std::FILE *> &files)
+        {
+            for (size_t i = 0; i < input.size(); ++i)
+            {
+                size_t row = input.rowAt(i);
+                HashedRow entry{key.hash(row), row};
+                if (std::fwrite(&entry, sizeof(entry), 1, files[entry.hash >> (64 - partitionBits)]) != 1)
+                    return false;
+            }
+            for (std::FILE *file : files)
+            {
+                if (std::fflush(file) != 0)
+                    return false;
+            }
+            return true;
+        };
+        if (!spill(buildKey, build, buildFiles) || !spill(probeKey, probe, probeFiles))
+        {
+            closeAll();
+            return false;
+        }
+
+        std::vector<HashedRow> buildEntries, probeEntries;
+        BuildTable table;
+        bool ok = true;
+        for (size_t i = 0; i < partitionCount && ok; ++i)
+        {
+            ok = readPartition(buildFiles[i], buildEntries) && readPartition(probeFiles[i], probeEntries);
+            if (!ok || buildEntries.empty() || probeEntries.empty())
+                continue;
+            table.build(buildEntries);
+            for (const HashedRow &entry : probeEntries)
+            {
+                table.probe(entry.hash, entry.row, probeKey, buildKey, [&](size_t buildRow, size_t probeRow)
+                            { pairs.push_back(buildIsLeft ? JoinPair{buildRow, probeRow} : JoinPair{probeRow, buildRow}); });
+            }
+        }
+        closeAll();
+        if (!ok)
+            return false;
+        sortPairs(pairs);
+        return true;
+    }
+
+
+    bool usableIndex(const JoinInput &input, KeyMode mode)
+    {
+        return input.index && !input.rows && mode != KeyMode::FORMATTED;
+    }
+
+    // 函数 indexJoin 用另一侧的每一行在索引中查找候选行，再核对连接键
+    void indexJoin(const JoinInput &indexed, const KeyReader &indexedKey, const JoinInput &probe, const KeyReader &probeKey,
+                   bool indexIsLeft, std::vector<JoinPair> &pairs)
+    {
+        for (size_t i = 0; i < probe.size(); ++i)
+        {
+            size_t row = probe.rowAt(i);
+            PostingList candidates = indexed.index->find(HashIndex::keyOf(*probe.key, row));
+            for (size_t candidate : candidates)
+            {
+                if (indexedKey.equals(candidate, probeKey, row))
+                    pairs.push_back(indexIsLeft ? JoinPair{candidate, row} : JoinPair{row, candidate});
+            }
+        }
+        if (indexIsLeft)
+        {
+            std::stable_sort(pairs.begin(), pairs.end(), [](const JoinPair &a, const JoinPair &b)
+                             { return a.left < b.left; });
+        }
+    }
+
+    bool usableOrdered(const JoinInput &left, const JoinInput &right, KeyMode mode)
+    {
+        return left.ordered && right.ordered && !left.rows && !right.rows &&
+               (mode == KeyMode::INTEGER || mode == KeyMode::FLOAT);
+    }
+
+    // 函数 mergeTrees 同步遍历两棵 B+ 树，对每组相同的键输出两侧行的笛卡尔积
+    template <typename Key>
+    void mergeTrees(const BPlusTree<Key> &left, const BPlusTree<Key> &right, std::vector<JoinPair> &pairs)
+    {
+        std::vector<size_t> group;
+        auto leftIt = left.begin();
+        auto rightIt = right.begin();
+        while (leftIt.valid() && rightIt.valid())
+        {
+            if (leftIt.key() < rightIt.key())
+            {
+                leftIt.next();
+                continue;
+            }
+            if (rightIt.key() < leftIt.key())
+            {
+                rightIt.next();
+                continue;
+            }
+            Key key = leftIt.key();
+            group.clear();
+            for (; rightIt.valid() && !(key < rightIt.key()); rightIt.next())
+                group.push_back(rightIt.row());
+            for (; leftIt.valid() && !(key < leftIt.key()); leftIt.next())
+            {
+                if (key != key)
+                    continue; // NaN 与任何值都不相等
+                for (size_t row : group)
+                    pairs.push_back({static_cast<size_t>(leftIt.row()), row});
+            }
+        }
+        sortPairs(pairs);
+    }
+}
+
+void hashJoin(const JoinInput &left, const JoinInput &right, size_t memoryBudget, std::vector<JoinPair> &pairs)
+{
+    pairs.clear();
+    if (left.size() == 0 || right.size() == 0)
+        return;
+
+    KeyMode mode = chooseKeyMode(*left.key, *right.key);
+    KeyReader leftKey(left.key, mode), rightKey(right.key, mode);
+
+    // 两侧都有索引时用较大一侧的索引，让较小的一侧去探测
+    bool leftIndexed = usableIndex(left, mode), rightIndexed = usableIndex(right, mode);
+    if (leftIndexed && (!rightIndexed || left.size() >= right.size()))
+    {
+        indexJoin(left, leftKey, right, rightKey, true, pairs);
+        return;
+    }
+    if (rightIndexed)
+    {
+        indexJoin(right, rightKey, left, leftKey, false, pairs);
+        return;
+    }
+    if (usableOrdered(left, right, mode))
+    {
+        if (mode == KeyMode::INTEGER)
+            mergeTrees(left.ordered->intTree(), right.ordered->intTree(), pairs);
+        else
+            mergeTrees(left.ordered->floatTree(), right.ordered->floatTree(), pairs);
+        return;
+    }
+    bool buildIsLeft = left.size() < right.size();
+    const KeyReader &buildKey = buildIsLeft ? leftKey : rightKey;
+    const KeyReader &probeKey = buildIsLeft ? rightKey : leftKey;
+    const JoinInput &build = buildIsLeft ? left : right;
+    const JoinInput &probe = buildIsLeft ? right : left;
+
+    size_t needed = build.size() * BYTES_PER_BUILD_ROW;
+    if (memoryBudget > 0 && needed > memoryBudget)
+    {
+        size_t partitionCount = std::min(MAX_PARTITIONS, needed / memoryBudget + 1);
+        if (graceJoin(buildKey, build, probeKey, probe, buildIsLeft, partitionCount, pairs))
+            return;
+        std::cerr << "Warning: Failed to spill join partitions, joining in memory." << std::endl;
+        pairs.clear();
+    }
+
+    std::vector<HashedRow> entries;
+    hashRows(buildKey, build, entries);
+    BuildTable table;
+    table.build(entries);
+    entries.clear();
+    entries.shrink_to_fit();
+
+    // 探测侧按行号升序扫描；建表侧为第二个表时输出天然有序，否则按第一个表的行号稳定排序
+    for (size_t i = 0; i < probe.size(); ++i)
+    {
+        size_t row = probe.rowAt(i);
+        table.probe(probeKey.hash(row), row, probeKey, buildKey, [&](size_t buildRow, size_t probeRow)
+                    { pairs.push_back(buildIsLeft ? JoinPair{buildRow, probeRow} : JoinPair{probeRow, buildRow}); });
+    }
+    if (buildIsLeft)
+    {
+        std::stable_sort(pairs.begin(), pairs.end(), [](const JoinPair &a, const JoinPair &b)
+                         { return a.left < b.left; });
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef JOIN_HPP
+#define JOIN_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "column_store.hpp"
+#include "index.hpp"
+
+// 连接结果中的一对行号，left 来自第一个表，right 来自第二个表
+struct JoinPair
+{
+    size_t left;
+    size_t right;
+};
+
+// 连接的一侧输入：连接列以及参与连接的行；rows 为空指针时表示前 rowCount 行全部参与
+// index 为连接列上的哈希索引，ordered 为连接列上的有序索引，只有全部行参与时才会被用来代替建表
+struct JoinInput
+{
+    const ColumnData *key;
+    size_t rowCount;
+    const std::vector<size_t> *rows = nullptr;
+    const HashIndex *index = nullptr;
+    const OrderedIndex *ordered = nullptr;
+
+    size_t size() const { return rows ? rows->size() : rowCount; }
+    size_t rowAt(size_t position) const { return rows ? (*rows)[position] : position; }
+};
+
+// 函数 hashJoin 用较小的一侧建立哈希表、用较大的一侧探测，结果按 (left, right) 升序排列，
+// 与嵌套循环连接的输出顺序完全一致；一侧带有可用索引时直接用索引探测，两侧都有有序索引时做归并连接，
+// 预计哈希表超过 memoryBudget 字节时改用分区（grace）连接
+void hashJoin(const JoinInput &left, const JoinInput &right, size_t memoryBudget, std::vector<JoinPair> &pairs);
+
+#endif // JOIN_HPP
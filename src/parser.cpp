@@ -0,0 +1,779 @@
+#include "parser.hpp"
+#include "removespace.hpp"
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    bool isIdentifierStart(char c)
+    {
+        return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+    }
+
+    bool isIdentifierChar(char c)
+    {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    }
+
+    bool isDigit(char c)
+    {
+        return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    }
+
+    bool equalsIgnoreCase(std::string_view text, const char *keyword)
+    {
+        size_t i = 0;
+        for (; i < text.size(); ++i)
+        {
+            if (keyword[i] == '\0' || std::toupper(static_cast<unsigned char>(text[i])) != keyword[i])
+                return false;
+        }
+        return keyword[i] == '\0';
+    }
+
+    // 类 Parser 对一条语句的记号序列做递归下降分析；每个 parseXxx 出错时记录原因并返回 false
+    class Parser
+    {
+    public:
+        Parser(std::string_view text, const std::vector<Token> &tokens) : text(text), tokens(tokens) {}
+
+        bool parse(Statement &statement)
+        {
+            if (acceptKeyword("CREATE"))
+            {
+                if (acceptKeyword("DATABASE"))
+                {
+                    statement.type = StatementType::CREATE_DATABASE;
+                    return identifier(statement.name) && finish();
+                }
+                if (acceptKeyword("TABLE"))
+                    return parseCreateTable(statement) && finish();
+                if (acceptKeyword("INDEX"))
+                    return parseCreateIndex(statement) && finish();
+                return fail("Expected DATABASE, TABLE or INDEX after CREATE");
+            }
+            if (acceptKeyword("USE"))
+            {
+                acceptKeyword("DATABASE");
+                statement.type = StatementType::USE_DATABASE;
+                return identifier(statement.name) && finish();
+            }
+            if (acceptKeyword("DROP"))
+            {
+                if (acceptKeyword("TABLE"))
+                    statement.type = StatementType::DROP_TABLE;
+                else if (acceptKeyword("INDEX"))
+                    statement.type = StatementType::DROP_INDEX;
+                else
+                    return fail("Expected TABLE or INDEX after DROP");
+                return identifier(statement.type == StatementType::DROP_TABLE ? statement.table : statement.name) && finish();
+            }
+            if (acceptKeyword("INSERT"))
+                return parseInsert(statement) && finish();
+            if (acceptKeyword("SELECT"))
+                return parseSelect(statement) && finish();
+            if (acceptKeyword("UPDATE"))
+                return parseUpdate(statement) && finish();
+            if (acceptKeyword("DELETE"))
+            {
+                statement.type = StatementType::DELETE;
+                return expectKeyword("FROM") && identifier(statement.table) && parseOptionalWhere(statement) && finish();
+            }
+            if (acceptKeyword("COPY"))
+                return parseCopy(statement) && finish();
+            if (acceptKeyword("SET"))
+            {
+                statement.type = StatementType::SET;
+                std::string_view value;
+                bool isParameter;
+                if (!identifier(statement.name) || !expectSymbol('=') || !rawValue(value, false, isParameter))
+                    return false;
+                // 设置名与关键字一样不区分大小写
+                for (char &c : statement.name)
+                    c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+                statement.value = std::string(value);
+                return finish();
+            }
+            if (acceptKeyword("CHECKPOINT"))
+            {
+                statement.type = StatementType::CHECKPOINT;
+                return finish();
+            }
+            if (acceptKeyword("VACUUM"))
+            {
+                // VACUUM [表名]：省略表名时压缩当前数据库的所有表
+                statement.type = StatementType::VACUUM;
+                return (peek().type == TokenType::END || identifier(statement.table)) && finish();
+            }
+            if (acceptKeyword("BEGIN"))
+            {
+                // BEGIN [TRANSACTION]
+                statement.type = StatementType::BEGIN;
+                acceptKeyword("TRANSACTION");
+                return finish();
+            }
+            if (acceptKeyword("COMMIT"))
+            {
+                statement.type = StatementType::COMMIT;
+                return finish();
+            }
+            if (acceptKeyword("ROLLBACK"))
+            {
+                statement.type = StatementType::ROLLBACK;
+                return finish();
+            }
+            if (acceptKeyword("PREPARE"))
+            {
+                // PREPARE 名称 AS 语句：语句原文在执行 PREPARE 时再解析
+                statement.type = StatementType::PREPARE;
+                if (!identifier(statement.name) || !expectKeyword("AS"))
+                    return false;
+                if (peek().type == TokenType::END)
+                    return fail("Expected a statement");
+                statement.value = std::string(text.substr(peek().offset));
+                return true;
+            }
+            if (acceptKeyword("EXECUTE"))
+                return parseExecute(statement) && finish();
+            return fail("Unknown statement");
+        }
+
+        const std::string &getError() const { return error; }
+
+    private:
+        std::string_view text;
+        const std::vector<Token> &tokens;
+        size_t position = 0;
+        std::string error;
+
+        const Token &peek() const { return tokens[position]; }
+        const Token &advance() { return tokens[position < tokens.size() - 1 ? position++ : position]; }
+
+        bool fail(const std::string &message)
+        {
+            if (error.empty())
+            {
+                const Token &token = peek();
+                error = message + (token.type == TokenType::END ? " at end of statement" : " near '" + std::string(token.text) + "'");
+            }
+            return false;
+        }
+
+        bool isKeyword(const char *keyword) const
+        {
+            return peek().type == TokenType::IDENTIFIER && equalsIgnoreCase(peek().text, keyword);
+        }
+        bool acceptKeyword(const char *keyword)
+        {
+            if (!isKeyword(keyword))
+                return false;
+            advance();
+            return true;
+        }
+        bool expectKeyword(const char *keyword)
+        {
+            return acceptKeyword(keyword) || fail(std::string("Expected ") + keyword);
+        }
+        bool isSymbol(char symbol) const
+        {
+            return peek().type == TokenType::SYMBOL && peek().text[0] == symbol;
+        }
+        bool acceptSymbol(char symbol)
+        {
+            if (!isSymbol(symbol))
+                return false;
+            advance();
+            return true;
+        }
+        bool expectSymbol(char symbol)
+        {
+            return acceptSymbol(symbol) || fail(std::string("Expected '") + symbol + "'");
+        }
+        bool identifier(std::string &name)
+        {
+            if (peek().type != TokenType::IDENTIFIER)
+                return fail("Expected a name");
+            name = std::string(advance().text);
+            return true;
+        }
+        bool finish()
+        {
+            return peek().type == TokenType::END || fail("Unexpected input");
+        }
+
+        // 函数 qualifiedName 解析 "表.列" 或 "列"
+        bool qualifiedName(QualifiedName &name)
+        {
+            if (!identifier(name.column))
+                return false;
+            if (acceptSymbol('.'))
+            {
+                name.table = std::move(name.column);
+                return identifier(name.column);
+            }
+            return true;
+        }
+
+        // 函数 aggregateFunction 判断当前位置是否为聚合函数名且后面紧跟左括号
+        bool aggregateFunction(AggregateFunction &function) const
+        {
+            static const std::pair<const char *, AggregateFunction> names[] = {
+                {"COUNT", AggregateFunction::COUNT}, {"SUM", AggregateFunction::SUM}, {"AVG", AggregateFunction::AVG}, {"MIN", AggregateFunction::MIN}, {"MAX", AggregateFunction::MAX}};
+            const Token &next = tokens[std::min(position + 1, tokens.size() - 1)];
+            if (next.type != TokenType::SYMBOL || next.text[0] != '(')
+                return false;
+            for (const auto &name : names)
+            {
+                if (isKeyword(name.first))
+                {
+                    function = name.second;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // 函数 selectItem 解析 SELECT 列表中的一项：列名，或 COUNT/SUM/AVG/MIN/MAX(列)、COUNT(*)
+        bool selectItem(QualifiedName &item)
+        {
+            if (!aggregateFunction(item.aggregate))
+                return qualifiedName(item);
+            advance();
+            advance();
+            if (item.aggregate == AggregateFunction::COUNT && acceptSymbol('*'))
+                item.column = "*";
+            else if (!qualifiedName(item))
+                return false;
+            return expectSymbol(')');
+        }
+
+        // 函数 rawValue 读取一个值直到引号外的逗号、右括号、语句结尾，或者（inCondition 时）AND/OR/GROUP/ORDER/LIMIT，
+        // 返回这些记号在原文中覆盖的范围，与按字符串切分时得到的值相同；
+        // 值恰好是一个参数时 isParameter 为 true，参数只能单独作为一个值出现
+        bool rawValue(std::string_view &value, bool inCondition, bool &isParameter)
+        {
+            size_t first = position;
+            bool hasParameter = false;
+            while (peek().type != TokenType::END && !isSymbol(',') && !isSymbol(')') &&
+                   !(inCondition && (isKeyword("AND") || isKeyword("OR") || isKeyword("GROUP") || isKeyword("ORDER") || isKeyword("LIMIT"))))
+            {
+                hasParameter = hasParameter || peek().type == TokenType::PARAMETER;
+                advance();
+            }
+            if (position == first)
+                return fail("Expected a value");
+            isParameter = hasParameter && position == first + 1;
+            if (hasParameter && !isParameter)
+                return fail("A parameter must be a whole value");
+            const Token &last = tokens[position - 1];
+            value = text.substr(tokens[first].offset, last.offset + last.text.size() - tokens[first].offset);
+            return true;
+        }
+
+        void addParameter(Statement &statement, ParameterTarget target, size_t row, size_t index)
+        {
+            statement.parameters.push_back(StatementParameter{target, row, index});
+        }
+
+        bool parseCreateTable(Statement &statement)
+        {
+            statement.type = StatementType::CREATE_TABLE;
+            if (!identifier(statement.table) || !expectSymbol('('))
+                return false;
+            do
+            {
+                std::string columnName, typeName;
+                if (!identifier(columnName) || !identifier(typeName))
+                    return false;
+                for (char &c : typeName)
+                    c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+                ColumnType type;
+                if (!parseColumnType(typeName, type))
+                {
+                    error = "Invalid column type: " + typeName;
+                    return false;
+                }
+                statement.columns.emplace_back(columnName, type);
+            } while (acceptSymbol(','));
+            return expectSymbol(')');
+        }
+
+        // CREATE INDEX 索引名 ON 表名(列名) [USING BTREE|HASH]
+        bool parseCreateIndex(Statement &statement)
+        {
+            statement.type = StatementType::CREATE_INDEX;
+            if (!identifier(statement.name) || !expectKeyword("ON") || !identifier(statement.table) ||
+                !expectSymbol('(') || !identifier(statement.indexColumn) || !expectSymbol(')'))
+                return false;
+            if (acceptKeyword("USING"))
+            {
+                if (acceptKeyword("BTREE"))
+                    statement.ordered = true;
+                else if (!acceptKeyword("HASH"))
+                    return fail("Expected BTREE or HASH");
+            }
+            return true;
+        }
+
+        // INSERT INTO 表名 VALUES (值, ...) [, (值, ...)]...
+        bool parseInsert(Statement &statement)
+        {
+            statement.type = StatementType::INSERT;
+            if (!expectKeyword("INTO") || !identifier(statement.table) || !expectKeyword("VALUES"))
+                return false;
+            do
+            {
+                if (!expectSymbol('('))
+                    return false;
+                statement.rows.emplace_back();
+                std::vector<std::string> &row = statement.rows.back();
+                do
+                {
+                    std::string_view value;
+                    bool isParameter;
+                    if (!rawValue(value, false, isParameter))
+                        return false;
+                    if (isParameter)
+                        addParameter(statement, ParameterTarget::INSERT_VALUE, statement.rows.size() - 1, row.size());
+                    row.emplace_back(value);
+                } while (acceptSymbol(','));
+                if (!expectSymbol(')'))
+                    return false;
+            } while (acceptSymbol(','));
+            return true;
+        }
+
+        // SELECT 列, ... FROM 表 [[INNER] JOIN 表 ON 表.列 = 表.列] [WHERE 条件] [GROUP BY 列, ...]
+        //   [ORDER BY 列 [ASC|DESC], ...] [LIMIT 行数 [OFFSET 行数]]
+        bool parseSelect(Statement &statement)
+        {
+            statement.type = StatementType::SELECT;
+            if (acceptSymbol('*'))
+            {
+                statement.selectAll = true;
+            }
+            else
+            {
+                do
+                {
+                    statement.selectList.emplace_back();
+                    if (!selectItem(statement.selectList.back()))
+                        return false;
+                } while (acceptSymbol(','));
+            }
+            if (!expectKeyword("FROM") || !identifier(statement.table))
+                return false;
+            bool inner = acceptKeyword("INNER");
+            if (acceptKeyword("JOIN"))
+            {
+                statement.type = StatementType::JOIN;
+                if (!identifier(statement.joinTable) || !expectKeyword("ON") ||
+                    !qualifiedName(statement.joinLeft) || !expectSymbol('=') || !qualifiedName(statement.joinRight))
+                    return false;
+            }
+            else if (inner)
+            {
+                return fail("Expected JOIN");
+            }
+            if (!parseOptionalWhere(statement))
+                return false;
+            if (acceptKeyword("GROUP"))
+            {
+                if (!expectKeyword("BY"))
+                    return false;
+                do
+                {
+                    statement.groupBy.emplace_back();
+                    if (!qualifiedName(statement.groupBy.back()))
+                        return false;
+                } while (acceptSymbol(','));
+            }
+            if (acceptKeyword("ORDER"))
+            {
+                if (!expectKeyword("BY"))
+                    return false;
+                do
+                {
+                    statement.order.items.emplace_back();
+                    OrderItem &item = statement.order.items.back();
+                    if (!selectItem(item.name))
+                        return false;
+                    if (acceptKeyword("DESC"))
+                        item.descending = true;
+                    else
+                        acceptKeyword("ASC");
+                } while (acceptSymbol(','));
+            }
+            if (acceptKeyword("LIMIT"))
+            {
+                if (!rowCount(statement, ParameterTarget::LIMIT, statement.order.limit))
+                    return false;
+                if (acceptKeyword("OFFSET") && !rowCount(statement, ParameterTarget::OFFSET, statement.order.offset))
+                    return false;
+            }
+            return true;
+        }
+
+        // 函数 rowCount 解析 LIMIT 或 OFFSET 后的非负整数
+        bool rowCount(Statement &statement, ParameterTarget target, uint64_t &count)
+        {
+            const Token &token = peek();
+            if (token.type == TokenType::PARAMETER)
+            {
+                addParameter(statement, target, 0, 0);
+                // PREPARE 中的 ? 在 EXECUTE 时才填入
+                if (token.text == "?")
+                {
+                    advance();
+                    return true;
+                }
+            }
+            int64_t value;
+            if ((token.type != TokenType::NUMBER && token.type != TokenType::PARAMETER) || !parseInteger(token.text, value) || value < 0)
+                return fail("Expected a non-negative row count");
+            count = static_cast<uint64_t>(value);
+            advance();
+            return true;
+        }
+
+        // UPDATE 表 SET 列 = 表达式 [WHERE 条件]
+        bool parseUpdate(Statement &statement)
+        {
+            statement.type = StatementType::UPDATE;
+            if (!identifier(statement.table) || !expectKeyword("SET") || !identifier(statement.set.column) || !expectSymbol('='))
+                return false;
+            size_t first = position;
+            size_t parameters = 0;
+            std::string_view expression;
+            while (peek().type != TokenType::END && !isKeyword("WHERE"))
+            {
+                parameters += peek().type == TokenType::PARAMETER;
+                advance();
+            }
+            if (position == first)
+                return fail("Expected a value");
+            const Token &last = tokens[position - 1];
+            expression = text.substr(tokens[first].offset, last.offset + last.text.size() - tokens[first].offset);
+            statement.set.expression = std::string(expression);
+            // "源列 运算符 常量" 形式的算术更新
+            const Token &source = tokens[first];
+            const Token &op = tokens[first + 1];
+            bool arithmetic = position - first >= 3 && source.type == TokenType::IDENTIFIER && op.type == TokenType::SYMBOL &&
+                              std::string_view("+-*/").find(op.text[0]) != std::string_view::npos;
+            if (arithmetic)
+            {
+                statement.set.source = std::string(source.text);
+                statement.set.op = op.text[0];
+                const Token &operand = tokens[first + 2];
+                statement.set.operand = std::string(text.substr(operand.offset, last.offset + last.text.size() - operand.offset));
+            }
+            if (parameters > 0)
+            {
+                // 参数只能是整个右侧，或者算术更新的常量
+                if (parameters == 1 && position == first + 1)
+                    addParameter(statement, ParameterTarget::SET_VALUE, 0, 0);
+                else if (parameters == 1 && arithmetic && position == first + 3 && last.type == TokenType::PARAMETER)
+                    addParameter(statement, ParameterTarget::SET_OPERAND, 0, 0);
+                else
+                    return fail("A parameter must be a whole value");
+            }
+            return parseOptionalWhere(statement);
+        }
+
+        // EXECUTE 名称 [(值, ...)]
+        bool parseExecute(Statement &statement)
+        {
+            statement.type = StatementType::EXECUTE;
+            if (!identifier(statement.name))
+                return false;
+            statement.rows.emplace_back();
+            if (!acceptSymbol('('))
+                return true;
+            do
+            {
+                std::string_view value;
+                bool isParameter;
+                if (!rawValue(value, false, isParameter))
+                    return false;
+                if (isParameter)
+                    return fail("Expected a value");
+                statement.rows[0].emplace_back(value);
+            } while (acceptSymbol(','));
+            return expectSymbol(')');
+        }
+
+        // COPY 表 FROM '文件' [WITH HEADER]
+        bool parseCopy(Statement &statement)
+        {
+            statement.type = StatementType::COPY;
+            if (!identifier(statement.table) || !expectKeyword("FROM"))
+                return false;
+            if (peek().type != TokenType::STRING)
+                return fail("Expected a quoted file name");
+            std::string_view path = advance().text;
+            statement.value = std::string(path.substr(1, path.size() - 2));
+            if (acceptKeyword("WITH"))
+            {
+                if (!expectKeyword("HEADER"))
+                    return false;
+                statement.header = true;
+            }
+            return true;
+        }
+
+        // WHERE 条件 [AND|OR 条件]...，条件为 "[表.]列 运算符 值"，值两端的引号会被去掉
+        bool parseOptionalWhere(Statement &statement)
+        {
+            WhereClause &where = statement.where;
+            if (!acceptKeyword("WHERE"))
+                return true;
+            do
+            {
+                QualifiedName column;
+                if (!qualifiedName(column))
+                    return false;
+                size_t opStart = peek().offset;
+                size_t opEnd = opStart;
+                while (isSymbol('=') || isSymbol('<') || isSymbol('>') || isSymbol('!'))
+                {
+                    opEnd = advance().offset + 1;
+                }
+                if (opEnd == opStart)
+                    return fail("Expected a comparison operator");
+                std::string_view value;
+                bool isParameter;
+                if (!rawValue(value, true, isParameter))
+                    return false;
+                if (isParameter)
+                    addParameter(statement, ParameterTarget::WHERE_VALUE, 0, where.conditions.size());
+                std::string name = column.table.empty() ? column.column : column.table + "." + column.column;
+                where.conditions.emplace_back(name, std::make_pair(std::string(text.substr(opStart, opEnd - opStart)), std::string(stripQuotes(value))));
+                if (isKeyword("AND") || isKeyword("OR"))
+                {
+                    where.logicalOperator = isKeyword("AND") ? "AND" : "OR";
+                    advance();
+                    continue;
+                }
+                break;
+            } while (true);
+            return true;
+        }
+    };
+}
+
+bool tokenize(std::string_view text, std::vector<Token> &tokens, std::string &errorMessage)
+{
+    tokens.clear();
+    size_t i = 0;
+    while (i < text.size())
+    {
+        char c = text[i];
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            i++;
+            continue;
+        }
+        size_t start = i;
+        TokenType type;
+        if (isIdentifierStart(c))
+        {
+            while (i < text.size() && isIdentifierChar(text[i]))
+                i++;
+            type = TokenType::IDENTIFIER;
+        }
+        else if (isDigit(c) || (c == '.' && i + 1 < text.size() && isDigit(text[i + 1])))
+        {
+            // 数字：整数部分、小数部分和指数；紧跟的字母也并入记号，由列类型决定它是否合法
+            while (i < text.size() && (isIdentifierChar(text[i]) || text[i] == '.' ||
+                                       ((text[i] == '+' || text[i] == '-') && (text[i - 1] == 'e' || text[i - 1] == 'E'))))
+                i++;
+            type = TokenType::NUMBER;
+        }
+        else if (c == '\'' || c == '"')
+        {
+            // 连续两个引号表示引号本身
+            i++;
+            while (true)
+            {
+                size_t close = text.find(c, i);
+                if (close == std::string_view::npos)
+                {
+                    errorMessage = "Unterminated string starting at position " + std::to_string(start);
+                    return false;
+                }
+                i = close + 1;
+                if (i >= text.size() || text[i] != c)
+                    break;
+                i++;
+            }
+            type = TokenType::STRING;
+        }
+        else if (c == ';' && trimView(text.substr(i + 1)).empty())
+        {
+            // 语句结尾的一个分号与命令行中的写法相同，不作为记号
+            text = text.substr(0, i);
+            break;
+        }
+        else
+        {
+            i++;
+            type = c == '?' ? TokenType::PARAMETER : TokenType::SYMBOL;
+        }
+        tokens.push_back(Token{type, text.substr(start, i - start), start});
+    }
+    tokens.push_back(Token{TokenType::END, std::string_view(), text.size()});
+    return true;
+}
+
+void normalizeTokens(std::vector<Token> &tokens, std::string &key, std::vector<std::string_view> &literals)
+{
+    key.clear();
+    literals.clear();
+    size_t out = 0;
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        Token token = tokens[i];
+        // 跟在运算符、逗号或左括号之后的正负号属于后面的数字
+        bool sign = token.type == TokenType::SYMBOL && (token.text[0] == '-' || token.text[0] == '+') &&
+                    i + 1 < tokens.size() && tokens[i + 1].type == TokenType::NUMBER &&
+                    out > 0 && tokens[out - 1].type == TokenType::SYMBOL && tokens[out - 1].text[0] != ')';
+        if (sign)
+        {
+            const Token &number = tokens[++i];
+            token.text = std::string_view(token.text.data(), number.offset + number.text.size() - token.offset);
+            token.type = TokenType::NUMBER;
+        }
+        if (token.type == TokenType::NUMBER || token.type == TokenType::STRING || token.type == TokenType::PARAMETER)
+        {
+            token.type = TokenType::PARAMETER;
+            literals.push_back(token.text);
+        }
+        if (token.type != TokenType::END)
+        {
+            if (!key.empty())
+                key += ' ';
+            if (token.type == TokenType::PARAMETER)
+                key += '?';
+            else
+                key.append(token.text);
+        }
+        tokens[out++] = token;
+    }
+    tokens.resize(out);
+}
+
+bool parseStatement(std::string_view text, Statement &statement, std::string &errorMessage)
+{
+    std::vector<Token> tokens;
+    if (!tokenize(text, tokens, errorMessage))
+        return false;
+    return parseTokens(text, tokens, statement, errorMessage);
+}
+
+bool parseTokens(std::string_view text, const std::vector<Token> &tokens, Statement &statement, std::string &errorMessage)
+{
+    statement = Statement();
+    Parser parser(text, tokens);
+    if (!parser.parse(statement))
+    {
+        errorMessage = parser.getError();
+        return false;
+    }
+    return true;
+}
+
+bool bindParameters(Statement &statement, const std::vector<std::string_view> &values, std::string &errorMessage)
+{
+    if (values.size() != statement.parameters.size())
+    {
+        errorMessage = "Expected " + std::to_string(statement.parameters.size()) + " parameters, got " + std::to_string(values.size());
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        const StatementParameter &parameter = statement.parameters[i];
+        std::string_view value = trimView(values[i]);
+        switch (parameter.target)
+        {
+        case ParameterTarget::INSERT_VALUE:
+            statement.rows[parameter.row][parameter.index].assign(value);
+            break;
+        case ParameterTarget::WHERE_VALUE:
+            statement.where.conditions[parameter.index].second.second.assign(stripQuotes(value));
+            break;
+        case ParameterTarget::SET_VALUE:
+            statement.set.expression.assign(value);
+            break;
+        case ParameterTarget::SET_OPERAND:
+            statement.set.operand.assign(value);
+            statement.set.expression = statement.set.source + " " + statement.set.op + " " + statement.set.operand;
+            break;
+        case ParameterTarget::LIMIT:
+        case ParameterTarget::OFFSET:
+        {
+            int64_t count;
+            if (!parseInteger(value, count) || count < 0)
+            {
+                errorMessage = "Expected a non-negative row count";
+                return false;
+            }
+            (parameter.target == ParameterTarget::LIMIT ? statement.order.limit : statement.order.offset) = static_cast<uint64_t>(count);
+            break;
+        }
+        }
+    }
+    return true;
+}
+
+bool StatementReader::next(std::string &statement)
+{
+    std::string line;
+    while (true)
+    {
+        while (scanned < pending.size())
+        {
+            char c = pending[scanned];
+            if (quote)
+            {
+                if (c == quote)
+                    quote = 0;
+            }
+            else if (c == '\'' || c == '"')
+            {
+                quote = c;
+            }
+            else if (c == '-' && scanned + 1 < pending.size() && pending[scanned + 1] == '-')
+            {
+                // 注释一直到行尾，pending 中的每一行都以换行符结尾
+                pending.erase(scanned, pending.find('\n', scanned) - scanned);
+                continue;
+            }
+            else if (c == ';')
+            {
+                std::string_view text = trimView(std::string_view(pending).substr(0, scanned));
+                bool found = !text.empty();
+                if (found)
+                    statement.assign(text);
+                pending.erase(0, scanned + 1);
+                scanned = 0;
+                if (found)
+                    return true;
+                continue;
+            }
+            scanned++;
+        }
+        if (!std::getline(input, line))
+        {
+            std::string_view text = trimView(pending);
+            bool found = !text.empty();
+            if (found)
+                statement.assign(text);
+            pending.clear();
+            scanned = 0;
+            quote = 0;
+            return found;
+        }
+        pending += line;
+        pending += '\n';
+    }
+}
@@ -0,0 +1,170 @@
+#ifndef PARSER_HPP
+#define PARSER_HPP
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "column_store.hpp"
+#include "predicate.hpp"
+
+enum class TokenType
+{
+    IDENTIFIER, // 标识符和关键字，关键字不区分大小写
+    NUMBER,
+    STRING,    // 带引号的常量，text 包含两端的引号
+    SYMBOL,    // 单个标点或运算符字符
+    PARAMETER, // "?"，或规范化时替换掉的常量（text 为常量原文，负号并入常量）
+    END
+};
+
+struct Token
+{
+    TokenType type = TokenType::END;
+    std::string_view text; // 指向语句文本
+    size_t offset = 0;     // 在语句文本中的位置
+};
+
+// 函数 tokenize 一次扫描把语句文本切分为记号，末尾追加一个 END 记号；结尾的一个分号被忽略，引号未闭合时返回 false
+bool tokenize(std::string_view text, std::vector<Token> &tokens, std::string &errorMessage);
+
+// 函数 normalizeTokens 把记号中的数字和字符串常量替换为参数，key 返回去掉常量后的规范化文本，
+// literals 按出现顺序返回被替换的常量（包括原有的 "?"）。只有常量不同的语句得到相同的 key
+void normalizeTokens(std::vector<Token> &tokens, std::string &key, std::vector<std::string_view> &literals);
+
+enum class StatementType
+{
+    CREATE_DATABASE,
+    USE_DATABASE,
+    CREATE_TABLE,
+    DROP_TABLE,
+    CREATE_INDEX,
+    DROP_INDEX,
+    INSERT,
+    SELECT,
+    JOIN,
+    UPDATE,
+    DELETE,
+    COPY,
+    SET,
+    CHECKPOINT,
+    VACUUM,
+    PREPARE,
+    EXECUTE,
+    BEGIN,
+    COMMIT,
+    ROLLBACK
+};
+
+// SELECT 列表中的聚合函数
+enum class AggregateFunction
+{
+    NONE, // 普通的列
+    COUNT,
+    SUM,
+    AVG,
+    MIN,
+    MAX
+};
+
+// "表.列" 或 "列"；在 SELECT 列表中也可以是聚合函数 "函数(列)"，COUNT(*) 的 column 为 "*"
+struct QualifiedName
+{
+    std::string table; // 没有限定表名时为空
+    std::string column;
+    AggregateFunction aggregate = AggregateFunction::NONE;
+};
+
+// UPDATE 的 SET 子句："列 = 常量" 或 "列 = 源列 运算符 常量"
+struct SetClause
+{
+    std::string column;
+    std::string expression; // 等号右侧的原文，按常量赋值时使用
+    std::string source;     // 算术更新的源列，不是算术表达式时为空
+    char op = 0;            // + - * /
+    std::string operand;
+};
+
+// ORDER BY 的一项：列或聚合函数，以及排序方向
+struct OrderItem
+{
+    QualifiedName name;
+    bool descending = false;
+};
+
+// SELECT 的 ORDER BY 和 LIMIT/OFFSET 子句
+struct OrderClause
+{
+    std::vector<OrderItem> items;
+    uint64_t limit = UINT64_MAX; // 没有 LIMIT 时为最大值
+    uint64_t offset = 0;
+};
+
+// 参数在语法树中的位置
+enum class ParameterTarget
+{
+    INSERT_VALUE, // rows[row][index]
+    WHERE_VALUE,  // where.conditions[index] 的常量
+    SET_VALUE,    // UPDATE 的整个右侧
+    SET_OPERAND,  // UPDATE 算术表达式的常量
+    LIMIT,        // order.limit
+    OFFSET        // order.offset
+};
+
+struct StatementParameter
+{
+    ParameterTarget target;
+    size_t row;
+    size_t index;
+};
+
+// 一条语句的语法树。与 LogRecord 一样用一个结构表示所有语句，各字段只在对应的语句中有意义
+struct Statement
+{
+    StatementType type = StatementType::SELECT;
+    std::string name;                                        // CREATE/USE DATABASE：库名；CREATE/DROP INDEX：索引名；SET：设置名
+    std::string table;                                       // 语句操作的表；JOIN：FROM 后的表
+    std::vector<std::pair<std::string, ColumnType>> columns; // CREATE TABLE：列定义
+    std::string indexColumn;                                 // CREATE INDEX：被索引的列
+    bool ordered = false;                                    // CREATE INDEX：USING BTREE
+    std::vector<std::vector<std::string>> rows;              // INSERT：每行的值，保留原文（TEXT 常量带引号）
+    bool selectAll = false;                                  // SELECT *
+    std::vector<QualifiedName> selectList;                   // SELECT/JOIN：输出列
+    std::vector<QualifiedName> groupBy;                      // SELECT：GROUP BY 的列
+    std::string joinTable;                                   // JOIN：INNER JOIN 后的表
+    QualifiedName joinLeft;                                  // JOIN：ON 左侧的列
+    QualifiedName joinRight;                                 // JOIN：ON 右侧的列
+    SetClause set;                                           // UPDATE
+    std::string value;                                       // SET：设置值；COPY：文件路径；PREPARE：AS 之后的语句
+    bool header = false;                                     // COPY：WITH HEADER
+    WhereClause where;                                       // SELECT/JOIN/UPDATE/DELETE
+    OrderClause order;                                       // SELECT/JOIN
+    std::vector<StatementParameter> parameters;              // 各参数的位置，按出现顺序；EXECUTE 的实参在 rows[0] 中
+};
+
+// 函数 parseStatement 用递归下降把一条语句（结尾可以有一个分号）解析为语法树，语法错误时返回 false 并给出原因
+bool parseStatement(std::string_view text, Statement &statement, std::string &errorMessage);
+// 函数 parseTokens 解析已经切分（可能已经规范化）的记号
+bool parseTokens(std::string_view text, const std::vector<Token> &tokens, Statement &statement, std::string &errorMessage);
+// 函数 bindParameters 把 values 依次填入语法树中的参数位置，个数不符时返回 false
+bool bindParameters(Statement &statement, const std::vector<std::string_view> &values, std::string &errorMessage);
+
+// 类 StatementReader 从输入流中按引号外的分号切分语句，一条语句可以跨越多行，一行也可以包含多条语句；
+// "--" 开始的注释到行尾为止
+class StatementReader
+{
+public:
+    explicit StatementReader(std::istream &input) : input(input) {}
+    // 函数 next 读出下一条非空语句（不含分号），输入结束时返回 false；结尾缺少分号的语句也会返回
+    bool next(std::string &statement);
+
+private:
+    std::istream &input;
+    std::string pending;
+    size_t scanned = 0; // pending 中已经扫描过的字节数
+    char quote = 0;     // 扫描位置处于引号内时为对应的引号
+};
+
+#endif // PARSER_HPP
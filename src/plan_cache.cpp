@@ -0,0 +1,37 @@
+#include "plan_cache.hpp"
+
+CachedPlan *PlanCache::find(const std::string &key)
+{
+    auto it = plans.find(key);
+    return it == plans.end() ? nullptr : &it->second;
+}
+
+CachedPlan &PlanCache::insert(const std::string &key, const Statement &statement)
+{
+    if (plans.size() >= CAPACITY)
+        plans.clear();
+    CachedPlan &plan = plans[key];
+    plan.statement = statement;
+    plan.binding = BoundStatement();
+    return plan;
+}
+
+CachedPlan *PlanCache::findPrepared(const std::string &name)
+{
+    auto it = prepared.find(name);
+    return it == prepared.end() ? nullptr : &it->second;
+}
+
+void PlanCache::prepare(const std::string &name, const Statement &statement)
+{
+    CachedPlan &plan = prepared[name];
+    plan.statement = statement;
+    plan.binding = BoundStatement();
+}
+
+void PlanCache::invalidate()
+{
+    plans.clear();
+    for (auto &entry : prepared)
+        entry.second.binding = BoundStatement();
+}
@@ -0,0 +1,46 @@
+#ifndef PLAN_CACHE_HPP
+#define PLAN_CACHE_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "parser.hpp"
+#include "planner.hpp"
+
+class Table;
+
+// 单表语句绑定后的计划：解析好的表、输出列和编译好的扫描计划，重复执行时只换入新的常量
+struct BoundStatement
+{
+    Table *table = nullptr;            // 为空表示尚未绑定
+    std::vector<size_t> outputColumns; // SELECT 输出的列
+    ScanPlan scan;
+};
+
+// 计划缓存中的一条语句：参数化的语法树和它的绑定
+struct CachedPlan
+{
+    Statement statement;
+    BoundStatement binding;
+};
+
+// 类 PlanCache 保存自动缓存的语句（以去掉常量的规范化文本为键）和 PREPARE 的语句（以名称为键）。
+// 表结构或索引变化后调用 invalidate：自动缓存的语句全部丢弃，PREPARE 的语句保留语法树并在下次执行时重新绑定
+class PlanCache
+{
+public:
+    static const size_t CAPACITY = 1024;
+
+    CachedPlan *find(const std::string &key);
+    // 函数 insert 缓存一条语句；缓存满时先清空，工作负载中反复出现的语句形状很快会重新进入缓存
+    CachedPlan &insert(const std::string &key, const Statement &statement);
+    CachedPlan *findPrepared(const std::string &name);
+    void prepare(const std::string &name, const Statement &statement);
+    void invalidate();
+
+private:
+    std::unordered_map<std::string, CachedPlan> plans;
+    std::unordered_map<std::string, CachedPlan> prepared;
+};
+
+#endif // PLAN_CACHE_HPP
@@ -0,0 +1,202 @@
+#include "planner.hpp"
+#include "data_manager.hpp"
+#include <algorithm>
+
+// 函数 splitQualified 用于把 "表.列" 拆成表名和列名，没有表名时 tableName 为空
+static void splitQualified(const std::string &name, std::string &tableName, std::string &columnName)
+{
+    size_t dot = name.find('.');
+    if (dot == std::string::npos)
+    {
+        tableName.clear();
+        columnName = name;
+    }
+    else
+    {
+        tableName = name.substr(0, dot);
+        columnName = name.substr(dot + 1);
+    }
+}
+
+// 函数 narrowRange 把一个比较条件合并进 range，只保留更紧的上下界
+static void narrowRange(const BoundCondition &condition, KeyRange &range)
+{
+    bool isInt = condition.column->getType() == ColumnType::INTEGER;
+    auto tighter = [&](bool has, int64_t intBound, double floatBound, bool greater)
+    {
+        if (!has)
+            return true;
+        return isInt ? (greater ? condition.intValue > intBound : condition.intValue < intBound)
+                     : (greater ? condition.floatValue > floatBound : condition.floatValue < floatBound);
+    };
+    auto equalBound = [&](int64_t intBound, double floatBound)
+    {
+        return isInt ? condition.intValue == intBound : condition.floatValue == floatBound;
+    };
+    bool inclusive = condition.op == CompareOp::EQUAL;
+    if (condition.op != CompareOp::LESS)
+    {
+        if (tighter(range.hasLower, range.intLower, range.floatLower, true))
+        {
+            range.hasLower = true;
+            range.lowerInclusive = inclusive;
+            range.intLower = condition.intValue;
+            range.floatLower = condition.floatValue;
+        }
+        else if (equalBound(range.intLower, range.floatLower))
+        {
+            range.lowerInclusive = range.lowerInclusive && inclusive;
+        }
+    }
+    if (condition.op != CompareOp::GREATER)
+    {
+        if (tighter(range.hasUpper, range.intUpper, range.floatUpper, false))
+        {
+            range.hasUpper = true;
+            range.upperInclusive = inclusive;
+            range.intUpper = condition.intValue;
+            range.floatUpper = condition.floatValue;
+        }
+        else if (equalBound(range.intUpper, range.floatUpper))
+        {
+            range.upperInclusive = range.upperInclusive && inclusive;
+        }
+    }
+}
+
+// 函数 chooseAccessPath 按谓词中的常量为已编译的计划选出访问路径
+static void chooseAccessPath(const Table &table, ScanPlan &plan)
+{
+    plan.indexScan = false;
+    plan.candidates.clear();
+    if (plan.predicate.isAlwaysFalse() || plan.predicate.isDisjunction())
+        return;
+
+    // 选出候选行最少的等值索引
+    PostingList best;
+    bool found = false;
+    for (const auto &condition : plan.predicate.getConditions())
+    {
+        const HashIndex *index = condition.indexable ? table.findIndexOn(condition.columnIndex) : nullptr;
+        if (!index)
+            continue;
+        uint64_t key;
+        switch (condition.column->getType())
+        {
+        case ColumnType::INTEGER:
+            key = HashIndex::intKey(condition.intValue);
+            break;
+        case ColumnType::FLOAT:
+            key = HashIndex::floatKey(condition.floatValue);
+            break;
+        default:
+            key = HashIndex::textKey(condition.textValue);
+            break;
+        }
+        PostingList rows = index->find(key);
+        if (!found || rows.size() < best.size())
+            best = rows;
+        found = true;
+    }
+    if (found)
+    {
+        plan.indexScan = true;
+        plan.candidates.assign(best.begin(), best.end());
+        return;
+    }
+
+    // 对每个带有序索引的列合并上下界，范围内的行不超过表的四分之一时才值得走索引
+    size_t limit = table.rowCount / 4;
+    const auto &bound = plan.predicate.getConditions();
+    for (size_t i = 0; i < bound.size(); ++i)
+    {
+        const BoundCondition &condition = bound[i];
+        const OrderedIndex *index = table.findOrderedIndexOn(condition.columnIndex);
+        bool seen = std::any_of(bound.begin(), bound.begin() + i, [&](const BoundCondition &earlier)
+                                { return earlier.columnIndex == condition.columnIndex; });
+        if (!index || seen)
+            continue;
+        KeyRange range;
+        bool usable = true;
+        for (const auto &other : bound)
+        {
+            if (other.columnIndex != condition.columnIndex)
+                continue;
+            if (other.op == CompareOp::EQUAL && !other.indexable)
+                usable = false; // 恒不成立的等值条件，交给谓词处理
+            else
+                narrowRange(other, range);
+        }
+        std::vector<size_t> rows;
+        if (usable && index->collectRange(range, limit, rows) && (!plan.indexScan || rows.size() < plan.candidates.size()))
+        {
+            plan.indexScan = true;
+            plan.candidates.swap(rows);
+        }
+    }
+}
+
+void ScanPlan::parallelMatches(size_t begin, size_t end, ThreadPool &pool, std::vector<size_t> &rows) const
+{
+    size_t morsels = (end - begin + MORSEL_ROWS - 1) / MORSEL_ROWS;
+    // 每个 morsel 写入自己的结果，最后按 morsel 顺序拼接，输出顺序与单线程扫描相同
+    std::vector<std::vector<size_t>> parts(morsels);
+    pool.run(morsels, [&](size_t morsel)
+             {
+        size_t from = begin + morsel * MORSEL_ROWS;
+        size_t to = std::min(end, from + MORSEL_ROWS);
+        std::vector<size_t> &part = parts[morsel];
+        predicate.forEachMatch(from, to, [&](size_t row)
+                               { part.push_back(row); }); });
+    for (const auto &part : parts)
+    {
+        rows.insert(rows.end(), part.begin(), part.end());
+    }
+}
+
+void ScanPlan::collectMatches(size_t rowCount, ThreadPool &pool, std::vector<size_t> &rows) const
+{
+    rows.clear();
+    if (useParallelScan(rowCount, pool))
+    {
+        parallelMatches(0, rowCount, pool, rows);
+        return;
+    }
+    forEachMatch(rowCount, [&](size_t row)
+                 { rows.push_back(row); });
+}
+
+void planScan(const Table &table, const std::vector<WhereCondition> &conditions, const std::string &logicalOperator, ScanPlan &plan)
+{
+    plan.predicate.compile(table, conditions, logicalOperator);
+    chooseAccessPath(table, plan);
+}
+
+void replanScan(const Table &table, const std::vector<WhereCondition> &conditions, ScanPlan &plan)
+{
+    plan.predicate.rebind(conditions);
+    chooseAccessPath(table, plan);
+}
+
+void planJoin(const Table &left, const Table &right, const std::vector<WhereCondition> &conditions, const std::string &logicalOperator, JoinPlan &plan)
+{
+    std::vector<WhereCondition> leftConditions, rightConditions;
+    std::string tableName, columnName;
+    for (const auto &cond : conditions)
+    {
+        splitQualified(cond.first, tableName, columnName);
+        bool onRight;
+        if (tableName.empty())
+            onRight = left.findColumn(columnName) < 0 && right.findColumn(columnName) >= 0;
+        else
+            onRight = (tableName == right.name && tableName != left.name);
+        if (!tableName.empty() && !onRight && tableName != left.name)
+            columnName = cond.first; // 不属于参与连接的表，编译时报告列不存在
+        (onRight ? rightConditions : leftConditions).emplace_back(columnName, cond.second);
+    }
+
+    // AND 条件或只涉及一个表的条件可以完整下推；OR 跨越两表时保留为连接后的残余条件
+    plan.residualOr = logicalOperator == "OR" && !leftConditions.empty() && !rightConditions.empty();
+    plan.leftFilter.compile(left, leftConditions, logicalOperator);
+    plan.rightFilter.compile(right, rightConditions, logicalOperator);
+}
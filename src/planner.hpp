@@ -0,0 +1,86 @@
+#ifndef PLANNER_HPP
+#define PLANNER_HPP
+
+#include <string>
+#include <vector>
+#include "predicate.hpp"
+#include "index.hpp"
+#include "thread_pool.hpp"
+
+// 单表扫描的计划：编译后的谓词和选出的访问路径
+struct ScanPlan
+{
+    Predicate predicate;
+    bool indexScan = false;         // 使用哈希索引或有序索引时为 true
+    std::vector<size_t> candidates; // 索引查到的候选行，按升序排列
+
+    // 函数 forEachMatch 按行号升序访问所有满足谓词的行
+    template <typename Visit>
+    void forEachMatch(size_t rowCount, Visit &&visit) const
+    {
+        if (predicate.isAlwaysFalse())
+            return;
+        if (indexScan)
+        {
+            for (size_t row : candidates)
+            {
+                if (predicate.matches(row))
+                    visit(row);
+            }
+            return;
+        }
+        predicate.forEachMatch(0, rowCount, visit);
+    }
+
+    // 函数 parallelMatches 把表行 [begin, end) 切成 morsel 在线程池上并行过滤，满足谓词的行号按升序追加到 rows；
+    // 只用于全表扫描
+    void parallelMatches(size_t begin, size_t end, ThreadPool &pool, std::vector<size_t> &rows) const;
+    // 函数 collectMatches 按升序收集所有满足谓词的行号，全表扫描的行数超过两个 morsel 时并行过滤
+    void collectMatches(size_t rowCount, ThreadPool &pool, std::vector<size_t> &rows) const;
+    // 函数 useParallelScan 判断扫描是否值得并行：全表扫描、线程池有多个线程且至少有两个 morsel
+    bool useParallelScan(size_t rowCount, const ThreadPool &pool) const
+    {
+        return !indexScan && !predicate.isAlwaysFalse() && pool.threads() > 1 && rowCount >= 2 * MORSEL_ROWS;
+    }
+
+    // 函数 nextMatches 从 position 处继续扫描，把至多 limit 个满足谓词的行号追加到 rows，position 停在下次开始的位置；
+    // position 是候选行（索引扫描）或表行的序号，从 0 开始。游标用它分批拉取结果
+    void nextMatches(size_t rowCount, size_t &position, std::vector<size_t> &rows, size_t limit) const
+    {
+        if (predicate.isAlwaysFalse())
+            return;
+        if (!indexScan)
+        {
+            predicate.nextMatches(position, rowCount, rows, limit);
+            return;
+        }
+        for (size_t found = 0; position < candidates.size() && found < limit; ++position)
+        {
+            size_t row = candidates[position];
+            if (predicate.matches(row))
+            {
+                rows.push_back(row);
+                ++found;
+            }
+        }
+    }
+};
+
+// 函数 planScan 编译 WHERE 条件，并在合取条件中存在带索引列的等值比较时改用索引查找；
+// 没有可用的哈希索引时，对带有序索引的列上的范围条件做 B+ 树范围扫描，命中行过多时退回全表扫描
+void planScan(const Table &table, const std::vector<WhereCondition> &conditions, const std::string &logicalOperator, ScanPlan &plan);
+// 函数 replanScan 用于重复执行同一形状的语句：沿用 plan 中已解析的列和比较函数，只换入新的常量并重新选择访问路径
+void replanScan(const Table &table, const std::vector<WhereCondition> &conditions, ScanPlan &plan);
+
+// 连接查询的逻辑计划：WHERE 条件按所属的表下推到连接的两个输入上
+struct JoinPlan
+{
+    Predicate leftFilter;
+    Predicate rightFilter;
+    bool residualOr = false; // 条件用 OR 跨越两个表时无法下推，只能在连接之后求值
+};
+
+// 函数 planJoin 把 "表.列" 或 "列" 形式的条件分配给所属的表并编译为各自的过滤谓词
+void planJoin(const Table &left, const Table &right, const std::vector<WhereCondition> &conditions, const std::string &logicalOperator, JoinPlan &plan);
+
+#endif // PLANNER_HPP
@@ -0,0 +1,243 @@
+#include "predicate.hpp"
+#include "data_manager.hpp"
+#include "simd_filter.hpp"
+#include <cmath>
+
+static bool alwaysFalseTest(const BoundCondition &, size_t)
+{
+    return false;
+}
+
+template <CompareOp Op>
+static bool intTest(const BoundCondition &condition, size_t row)
+{
+    int64_t value = condition.column->intAt(row);
+    if (Op == CompareOp::EQUAL)
+        return value == condition.intValue;
+    if (Op == CompareOp::GREATER)
+        return value > condition.intValue;
+    return value < condition.intValue;
+}
+
+template <CompareOp Op>
+static bool floatTest(const BoundCondition &condition, size_t row)
+{
+    double value = condition.column->floatAt(row);
+    if (Op == CompareOp::EQUAL)
+        return value == condition.floatValue;
+    if (Op == CompareOp::GREATER)
+        return value > condition.floatValue;
+    return value < condition.floatValue;
+}
+
+static bool textEqualTest(const BoundCondition &condition, size_t row)
+{
+    return stripQuotes(condition.column->textAt(row)) == condition.textValue;
+}
+
+static bool dictionaryEqualTest(const BoundCondition &condition, size_t row)
+{
+    int32_t code = condition.column->codeAt(row);
+    return code == condition.codes[0] || code == condition.codes[1];
+}
+
+// 函数 bindText 绑定 TEXT 列上的等值比较；列为字典编码时先在字典中查出常量的编码，逐行只比较整数
+static void bindText(BoundCondition &bound, std::string_view value)
+{
+    bound.textValue = std::string(value);
+    bound.dictionary = bound.column->isDictionary();
+    if (!bound.dictionary)
+    {
+        bound.test = textEqualTest;
+        return;
+    }
+    // 存储的文本保留引号，去掉引号后等于常量的只可能是 '常量' 或不带引号的常量本身
+    bound.codes[0] = bound.column->findCode("'" + bound.textValue + "'");
+    bound.codes[1] = stripQuotes(value) == value ? bound.column->findCode(value) : -1;
+    bound.test = dictionaryEqualTest;
+}
+
+template <CompareOp Op>
+static bool (*chooseTest(ColumnType type))(const BoundCondition &, size_t)
+{
+    return type == ColumnType::INTEGER ? intTest<Op> : floatTest<Op>;
+}
+
+// 函数 bindNumeric 用于把常量转换为列的原生类型并选出比较函数
+// INTEGER 列遇到带小数的常量时，和原来用 stoi 转换一样把常量向零截断，例如 ID = 3.5 等同于 ID = 3
+static bool bindNumeric(BoundCondition &bound, ColumnType type, const std::string &value)
+{
+    double target;
+    bound.numeric = false;
+    if (!parseFloat(value, target))
+        return false;
+    bound.floatValue = target;
+    if (type == ColumnType::INTEGER && !parseInteger(value, bound.intValue))
+    {
+        if (std::isnan(target) || std::fabs(target) >= 9.2e18)
+            return false;
+        bound.intValue = static_cast<int64_t>(std::trunc(target));
+    }
+    bound.numeric = true;
+    switch (bound.op)
+    {
+    case CompareOp::EQUAL:
+        bound.test = chooseTest<CompareOp::EQUAL>(type);
+        bound.indexable = true;
+        break;
+    case CompareOp::GREATER:
+        bound.test = chooseTest<CompareOp::GREATER>(type);
+        break;
+    default:
+        bound.test = chooseTest<CompareOp::LESS>(type);
+        break;
+    }
+    return true;
+}
+
+bool Predicate::compile(const Table &table, const std::vector<WhereCondition> &whereConditions, const std::string &logicalOperator)
+{
+    conditions.clear();
+    useOr = (logicalOperator == "OR");
+    alwaysFalse = false;
+    deleted = &table.deleted;
+    conditions.reserve(whereConditions.size());
+    for (const auto &cond : whereConditions)
+    {
+        const std::string &columnName = cond.first;
+        const std::string &op = cond.second.first;
+        std::string_view value = stripQuotes(cond.second.second);
+
+        int columnIndex = table.findColumn(columnName);
+        if (columnIndex < 0)
+        {
+            std::cerr << "Column not found: " << columnName << std::endl;
+            alwaysFalse = true;
+            return false;
+        }
+
+        BoundCondition bound;
+        bound.columnIndex = static_cast<size_t>(columnIndex);
+        bound.column = &table.data[columnIndex];
+        ColumnType type = table.columns[columnIndex].type;
+        bool knownOp = true;
+        if (op == "=")
+            bound.op = CompareOp::EQUAL;
+        else if (op == ">")
+            bound.op = CompareOp::GREATER;
+        else if (op == "<")
+            bound.op = CompareOp::LESS;
+        else
+            knownOp = false;
+
+        if (!knownOp || (type == ColumnType::TEXT && bound.op != CompareOp::EQUAL))
+        {
+            // 不支持的比较对所有行都不成立
+            bound.comparable = false;
+            bound.test = alwaysFalseTest;
+        }
+        else if (type == ColumnType::TEXT)
+        {
+            bindText(bound, value);
+            bound.indexable = true;
+        }
+        else if (!bindNumeric(bound, type, std::string(value)))
+        {
+            std::cerr << "Error: Invalid value for " << columnTypeName(type) << " column." << std::endl;
+            alwaysFalse = true;
+            return false;
+        }
+        conditions.push_back(std::move(bound));
+    }
+    return true;
+}
+
+bool Predicate::rebind(const std::vector<WhereCondition> &whereConditions)
+{
+    alwaysFalse = false;
+    for (size_t i = 0; i < conditions.size(); ++i)
+    {
+        BoundCondition &bound = conditions[i];
+        if (!bound.comparable)
+            continue;
+        std::string_view value = stripQuotes(whereConditions[i].second.second);
+        ColumnType type = bound.column->getType();
+        if (type == ColumnType::TEXT)
+        {
+            bindText(bound, value);
+            continue;
+        }
+        bound.indexable = false;
+        if (!bindNumeric(bound, type, std::string(value)))
+        {
+            std::cerr << "Error: Invalid value for " << columnTypeName(type) << " column." << std::endl;
+            alwaysFalse = true;
+            return false;
+        }
+    }
+    return true;
+}
+
+// 函数 conditionBits 把一个条件在 [begin, begin + count) 行上的结果写入位图
+static void conditionBits(const BoundCondition &condition, size_t begin, size_t count, uint64_t *bits)
+{
+    if (condition.numeric)
+    {
+        if (condition.column->getType() == ColumnType::INTEGER)
+            compareInts(condition.column->intBlock(begin), count, condition.op, condition.intValue, bits);
+        else
+            compareFloats(condition.column->floatBlock(begin), count, condition.op, condition.floatValue, bits);
+        return;
+    }
+    if (condition.dictionary)
+    {
+        matchCodes(condition.column->codeBlock(begin), count, condition.codes[0], condition.codes[1], bits);
+        return;
+    }
+    for (size_t w = 0; w < (count + 63) / 64; ++w)
+        bits[w] = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (condition.test(condition, begin + i))
+            bits[i / 64] |= uint64_t(1) << (i % 64);
+    }
+}
+
+void Predicate::filterBlock(size_t begin, size_t end, uint64_t *bits) const
+{
+    evaluateBlock(begin, end, bits);
+    if (!deleted || !deleted->any())
+        return;
+    for (size_t w = 0; w < (end - begin + 63) / 64; ++w)
+        bits[w] &= ~deleted->wordAt(begin + w * 64);
+}
+
+void Predicate::evaluateBlock(size_t begin, size_t end, uint64_t *bits) const
+{
+    size_t count = end - begin;
+    size_t words = (count + 63) / 64;
+    if (conditions.empty())
+    {
+        // 没有条件时所有行都满足
+        for (size_t w = 0; w < words; ++w)
+            bits[w] = ~uint64_t(0);
+        if (count % 64 != 0)
+            bits[words - 1] = (uint64_t(1) << (count % 64)) - 1;
+        return;
+    }
+    conditionBits(conditions[0], begin, count, bits);
+    uint64_t scratch[BLOCK_ROWS / 64];
+    for (size_t i = 1; i < conditions.size(); ++i)
+    {
+        uint64_t any = 0;
+        conditionBits(conditions[i], begin, count, scratch);
+        for (size_t w = 0; w < words; ++w)
+        {
+            bits[w] = useOr ? (bits[w] | scratch[w]) : (bits[w] & scratch[w]);
+            any |= bits[w];
+        }
+        // AND 的位图已经全为 0 时，剩下的条件不必再求值
+        if (!useOr && any == 0)
+            return;
+    }
+}
@@ -0,0 +1,153 @@
+#ifndef PREDICATE_HPP
+#define PREDICATE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "column_store.hpp"
+
+class Table;
+
+// WHERE 子句中的一个条件：列名、(运算符, 常量)
+typedef std::pair<std::string, std::pair<std::string, std::string>> WhereCondition;
+
+// 解析后的 WHERE 子句，条件之间统一用 logicalOperator（AND 或 OR）连接
+struct WhereClause
+{
+    std::vector<WhereCondition> conditions;
+    std::string logicalOperator = "AND";
+};
+
+enum class CompareOp
+{
+    EQUAL,
+    GREATER,
+    LESS
+};
+
+// 绑定后的条件：列已解析为下标，常量已转换为列的原生类型
+struct BoundCondition
+{
+    size_t columnIndex = 0;
+    const ColumnData *column = nullptr;
+    CompareOp op = CompareOp::EQUAL;
+    int64_t intValue = 0;
+    double floatValue = 0;
+    std::string textValue;
+    bool indexable = false; // 精确的等值比较，可以用索引查找
+    bool comparable = true; // 运算符和列类型受支持；为 false 时条件恒不成立
+    bool numeric = false;   // 数值列与常量的比较，可以用 SIMD 内核按块求值
+    bool dictionary = false; // 字典编码的 TEXT 列上的等值比较，逐行只比较编码
+    int32_t codes[2] = {-1, -1}; // 去掉引号后等于常量的字典项（带引号和不带引号两种写法），-1 表示不存在
+    bool (*test)(const BoundCondition &condition, size_t row) = nullptr;
+};
+
+// 类 Predicate 是每条语句只编译一次的 WHERE 程序，逐行求值时不分配内存、不比较字符串。
+// 表中已删除（带墓碑）的行对任何谓词都不成立
+class Predicate
+{
+public:
+    // 函数 compile 把条件绑定到 table 上；出错时打印信息，并让谓词对所有行返回 false
+    bool compile(const Table &table, const std::vector<WhereCondition> &conditions, const std::string &logicalOperator);
+    // 函数 rebind 只换入新的常量，列、运算符和条件个数必须与 compile 时相同
+    bool rebind(const std::vector<WhereCondition> &conditions);
+    bool empty() const { return conditions.empty() && !alwaysFalse; }
+    bool isAlwaysFalse() const { return alwaysFalse; }
+    bool isDisjunction() const { return useOr && conditions.size() > 1; }
+    const std::vector<BoundCondition> &getConditions() const { return conditions; }
+    // 按块求值时每块的行数，一块的选择位图占 BLOCK_ROWS / 64 个字。块按 BLOCK_ROWS 的整数倍对齐，不会跨过列的段
+    static const size_t BLOCK_ROWS = 1024;
+    // 函数 filterBlock 对 [begin, end) 行（不超过 BLOCK_ROWS 行，且不跨过 BLOCK_ROWS 的整数倍）求值，bits 的第 i 位表示第 begin + i 行是否满足谓词；
+    // 数值条件用 SIMD 内核得到位图，多个条件的位图按 AND/OR 逐字合并，最后去掉已删除的行
+    void filterBlock(size_t begin, size_t end, uint64_t *bits) const;
+    // 函数 forEachMatch 按块求值 [begin, end) 行，按升序访问满足谓词的行
+    template <typename Visit>
+    void forEachMatch(size_t begin, size_t end, Visit &&visit) const
+    {
+        if (alwaysFalse)
+            return;
+        uint64_t bits[BLOCK_ROWS / 64];
+        for (size_t block = begin; block < end;)
+        {
+            size_t blockEnd = std::min(end, blockLimit(block));
+            filterBlock(block, blockEnd, bits);
+            size_t words = (blockEnd - block + 63) / 64;
+            for (size_t w = 0; w < words; ++w)
+            {
+                for (uint64_t word = bits[w]; word != 0; word &= word - 1)
+                    visit(block + w * 64 + static_cast<size_t>(__builtin_ctzll(word)));
+            }
+            block = blockEnd;
+        }
+    }
+    // 函数 nextMatches 从 position 行开始按块求值，把至多 limit 个满足谓词的行号追加到 rows，position 停在下次开始的位置
+    void nextMatches(size_t &position, size_t end, std::vector<size_t> &rows, size_t limit) const
+    {
+        if (alwaysFalse)
+            return;
+        uint64_t bits[BLOCK_ROWS / 64];
+        size_t found = 0;
+        while (position < end)
+        {
+            size_t blockEnd = std::min(end, blockLimit(position));
+            filterBlock(position, blockEnd, bits);
+            size_t words = (blockEnd - position + 63) / 64;
+            for (size_t w = 0; w < words; ++w)
+            {
+                for (uint64_t word = bits[w]; word != 0; word &= word - 1)
+                {
+                    size_t row = position + w * 64 + static_cast<size_t>(__builtin_ctzll(word));
+                    if (found == limit)
+                    {
+                        position = row;
+                        return;
+                    }
+                    rows.push_back(row);
+                    ++found;
+                }
+            }
+            position = blockEnd;
+        }
+    }
+    // 函数 filter 把前 rowCount 行中满足谓词的行号按升序写入 rows
+    void filter(size_t rowCount, std::vector<size_t> &rows) const
+    {
+        rows.clear();
+        forEachMatch(0, rowCount, [&](size_t row)
+                     { rows.push_back(row); });
+    }
+    bool matches(size_t row) const
+    {
+        if (alwaysFalse || (deleted && deleted->contains(row)))
+            return false;
+        if (useOr)
+        {
+            for (const auto &condition : conditions)
+            {
+                if (condition.test(condition, row))
+                    return true;
+            }
+            return conditions.empty();
+        }
+        for (const auto &condition : conditions)
+        {
+            if (!condition.test(condition, row))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    std::vector<BoundCondition> conditions;
+    bool useOr = false;
+    bool alwaysFalse = false;
+    const Tombstones *deleted = nullptr; // 所绑定的表的删除位图
+
+    void evaluateBlock(size_t begin, size_t end, uint64_t *bits) const;
+    // 函数 blockLimit 返回 row 所在块的结束行号
+    static size_t blockLimit(size_t row) { return (row / BLOCK_ROWS + 1) * BLOCK_ROWS; }
+};
+
+#endif // PREDICATE_HPP
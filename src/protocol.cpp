@@ -0,0 +1,232 @@
+#include "protocol.hpp"
+#include <arpa/inet.h>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    bool isPort(const std::string &text)
+    {
+        if (text.empty() || text.size() > 5)
+            return false;
+        for (char c : text)
+        {
+            if (!std::isdigit(static_cast<unsigned char>(c)))
+                return false;
+        }
+        return true;
+    }
+
+    // 函数 splitTcp 把地址拆成主机和端口，不是 TCP 地址时返回 false
+    bool splitTcp(const std::string &address, std::string &host, std::string &port)
+    {
+        if (isPort(address))
+        {
+            host = "127.0.0.1";
+            port = address;
+            return true;
+        }
+        size_t colon = address.rfind(':');
+        if (colon == std::string::npos || address.find('/') != std::string::npos || !isPort(address.substr(colon + 1)))
+            return false;
+        host = address.substr(0, colon);
+        port = address.substr(colon + 1);
+        return true;
+    }
+
+    bool unixAddress(const std::string &path, sockaddr_un &addr, std::string &error)
+    {
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path))
+        {
+            error = "socket path too long: " + path;
+            return false;
+        }
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+    // 函数 openTcp 解析主机和端口后监听或连接第一个可用的地址
+    int openTcp(const std::string &host, const std::string &port, bool listening, std::string &error)
+    {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        if (listening)
+            hints.ai_flags = AI_PASSIVE;
+        addrinfo *found = nullptr;
+        int status = getaddrinfo(host.c_str(), port.c_str(), &hints, &found);
+        if (status != 0)
+        {
+            error = host + ": " + gai_strerror(status);
+            return -1;
+        }
+        int fd = -1;
+        error = "cannot reach " + host + ":" + port;
+        for (addrinfo *entry = found; entry && fd < 0; entry = entry->ai_next)
+        {
+            fd = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+            if (fd < 0)
+                continue;
+            bool ok;
+            if (listening)
+            {
+                int reuse = 1;
+                setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+                ok = bind(fd, entry->ai_addr, entry->ai_addrlen) == 0 && listen(fd, SOMAXCONN) == 0;
+            }
+            else
+            {
+                ok = connect(fd, entry->ai_addr, entry->ai_addrlen) == 0;
+            }
+            if (!ok)
+            {
+                error = host + ":" + port + ": " + std::strerror(errno);
+                close(fd);
+                fd = -1;
+            }
+        }
+        freeaddrinfo(found);
+        return fd;
+    }
+
+    int openUnix(const std::string &path, bool listening, std::string &error)
+    {
+        sockaddr_un addr;
+        if (!unixAddress(path, addr, error))
+            return -1;
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+        {
+            error = std::strerror(errno);
+            return -1;
+        }
+        if (listening)
+        {
+            // 上一次没有正常退出的服务器留下的套接字文件连接不上，可以删除；连接得上说明服务器还在运行
+            int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (probe >= 0 && connect(probe, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0)
+            {
+                close(probe);
+                close(fd);
+                error = path + ": a server is already listening";
+                return -1;
+            }
+            if (probe >= 0)
+                close(probe);
+            unlink(path.c_str());
+        }
+        bool ok = listening ? bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0 && listen(fd, SOMAXCONN) == 0
+                            : connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0;
+        if (!ok)
+        {
+            error = path + ": " + std::strerror(errno);
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    // 函数 writeAll 写出全部字节，非阻塞套接字暂时写不进去时等待可写
+    bool writeAll(int fd, const char *data, size_t length)
+    {
+        while (length > 0)
+        {
+            ssize_t written = send(fd, data, length, MSG_NOSIGNAL);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                    return false;
+                pollfd wait{fd, POLLOUT, 0};
+                poll(&wait, 1, -1);
+                continue;
+            }
+            data += written;
+            length -= static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    bool readAll(int fd, char *data, size_t length)
+    {
+        while (length > 0)
+        {
+            ssize_t got = recv(fd, data, length, 0);
+            if (got < 0 && errno == EINTR)
+                continue;
+            if (got <= 0)
+                return false;
+            data += got;
+            length -= static_cast<size_t>(got);
+        }
+        return true;
+    }
+}
+
+int listenOn(const std::string &address, std::string &error)
+{
+    std::string host, port;
+    if (splitTcp(address, host, port))
+        return openTcp(host, port, true, error);
+    return openUnix(address, true, error);
+}
+
+int connectTo(const std::string &address, std::string &error)
+{
+    std::string host, port;
+    if (splitTcp(address, host, port))
+        return openTcp(host, port, false, error);
+    return openUnix(address, false, error);
+}
+
+void closeListener(int fd, const std::string &address)
+{
+    close(fd);
+    std::string host, port;
+    if (!splitTcp(address, host, port))
+        unlink(address.c_str());
+}
+
+bool writeFrame(int fd, std::string_view payload)
+{
+    uint32_t length = htonl(static_cast<uint32_t>(payload.size()));
+    return writeAll(fd, reinterpret_cast<const char *>(&length), sizeof(length)) && writeAll(fd, payload.data(), payload.size());
+}
+
+bool readFrame(int fd, std::string &payload)
+{
+    uint32_t length;
+    if (!readAll(fd, reinterpret_cast<char *>(&length), sizeof(length)))
+        return false;
+    length = ntohl(length);
+    if (length > MAX_FRAME_BYTES)
+        return false;
+    payload.resize(length);
+    return readAll(fd, payload.data(), length);
+}
+
+int takeFrame(std::string &buffer, std::string &payload)
+{
+    uint32_t length;
+    if (buffer.size() < sizeof(length))
+        return 0;
+    std::memcpy(&length, buffer.data(), sizeof(length));
+    length = ntohl(length);
+    if (length > MAX_FRAME_BYTES)
+        return -1;
+    if (buffer.size() < sizeof(length) + length)
+        return 0;
+    payload.assign(buffer, sizeof(length), length);
+    buffer.erase(0, sizeof(length) + length);
+    return 1;
+}
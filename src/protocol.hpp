@@ -0,0 +1,30 @@
+#ifndef PROTOCOL_HPP
+#define PROTOCOL_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// minidb --serve 与客户端之间的协议：每一帧是 u32 长度（网络字节序）加上这么多字节的内容。
+// 客户端的一帧是一段 SQL 文本，其中可以有多条语句；服务器对每个请求回复两帧，
+// 第一帧是各语句的输出（查询结果等，原来写到标准输出的内容），第二帧是错误信息（原来写到标准错误的内容），没有时为空帧
+const uint32_t MAX_FRAME_BYTES = 64 * 1024 * 1024;
+
+// 地址的写法：全是数字时是 127.0.0.1 上的 TCP 端口，"主机:端口" 是指定主机上的 TCP 端口，其余都是 Unix 域套接字的路径
+const char *const DEFAULT_SERVER_ADDRESS = "minidb.sock";
+
+// 函数 listenOn 在 address 上监听，返回监听套接字；失败时把原因写入 error 并返回 -1
+int listenOn(const std::string &address, std::string &error);
+// 函数 connectTo 连接到 address 上的服务器，返回套接字；失败时把原因写入 error 并返回 -1
+int connectTo(const std::string &address, std::string &error);
+// 函数 closeListener 关闭监听套接字，Unix 域套接字同时删除路径
+void closeListener(int fd, const std::string &address);
+
+// 函数 writeFrame 写出一帧；套接字是非阻塞的也会等到全部写完，对方断开时返回 false
+bool writeFrame(int fd, std::string_view payload);
+// 函数 readFrame 阻塞读取一帧，连接关闭或帧过长时返回 false
+bool readFrame(int fd, std::string &payload);
+// 函数 takeFrame 从已收到的字节 buffer 中取出一个完整的帧：取到时返回 1，字节还不够时返回 0，帧过长时返回 -1
+int takeFrame(std::string &buffer, std::string &payload);
+
+#endif // PROTOCOL_HPP
@@ -22,3 +22,19 @@ std::string trim(const std::string &str)
 
     return std::string(start, end + 1);
 }
+
+// 函数 trimView 与 trim 相同，但直接返回原字符串上的视图，不分配内存
+std::string_view trimView(std::string_view str)
+{
+    size_t start = 0;
+    while (start < str.size() && std::isspace(static_cast<unsigned char>(str[start])))
+    {
+        start++;
+    }
+    size_t end = str.size();
+    while (end > start && std::isspace(static_cast<unsigned char>(str[end - 1])))
+    {
+        end--;
+    }
+    return str.substr(start, end - start);
+}
@@ -2,7 +2,9 @@
 #define REMOVESPACE_HPP
 
 #include <string>
+#include <string_view>
 
 std::string trim(const std::string &str);
+std::string_view trimView(std::string_view str);
 
 #endif // REMOVESPACE_HPP
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "result_cursor.hpp"
+#include <algorithm>
+
+bool ResultCursor::next(ResultBatch &batch, size_t maxRows)
+{
+    while (skip > 0)
+    {
+        if (!fetch(batch, static_cast<size_t>(std::min<uint64_t>(skip, maxRows))))
+            return false;
+        skip -= batch.size();
+    }
+    if (remaining == 0)
+    {
+        fetch(batch, 0);
+        return false;
+    }
+    fetch(batch, static_cast<size_t>(std::min<uint64_t>(remaining, maxRows)));
+    remaining -= batch.size();
+    return !batch.empty();
+}
+
+bool ResultCursor::fetch(ResultBatch &batch, size_t maxRows)
+{
+    batch.columns = &columns;
+    batch.rows[0].clear();
+    batch.rows[1].clear();
+    if (kind == Kind::SCAN && sorted)
+    {
+        sorter.next(batch.rows[0], maxRows);
+    }
+    else if (kind == Kind::SCAN && pool)
+    {
+        const ScanPlan &plan = scan();
+        while (buffered.size() - bufferedPosition < maxRows && position < rowCount)
+        {
+            buffered.erase(buffered.begin(), buffered.begin() + bufferedPosition);
+            bufferedPosition = 0;
+            size_t end = std::min(rowCount, position + pool->threads() * MORSEL_ROWS);
+            plan.parallelMatches(position, end, *pool, buffered);
+            position = end;
+        }
+        size_t count = std::min(maxRows, buffered.size() - bufferedPosition);
+        batch.rows[0].assign(buffered.begin() + bufferedPosition, buffered.begin() + bufferedPosition + count);
+        bufferedPosition += count;
+    }
+    else if (kind == Kind::SCAN)
+    {
+        scan().nextMatches(rowCount, position, batch.rows[0], maxRows);
+    }
+    else if (kind == Kind::JOIN)
+    {
+        // 条件用 OR 跨越两个表时，连接之后才能过滤
+        while (position < pairs.size() && batch.rows[0].size() < maxRows)
+        {
+            const JoinPair &pair = pairs[position++];
+            if (joinPlan.residualOr && !joinPlan.leftFilter.matches(pair.left) && !joinPlan.rightFilter.matches(pair.right))
+            {
+                continue;
+            }
+            batch.rows[0].push_back(pair.left);
+            batch.rows[1].push_back(pair.right);
+        }
+    }
+    else if (kind == Kind::AGGREGATE)
+    {
+        size_t end = std::min(rowCount, position + maxRows);
+        for (; position < end; ++position)
+        {
+            size_t row = order.empty() ? position : order[position];
+            batch.rows[0].push_back(row);
+            if (!groupRows.empty())
+                batch.rows[1].push_back(groupRows[row]);
+        }
+    }
+    return !batch.empty();
+}
+
+void ResultCursor::fail(const std::string &message)
+{
+    errorMessage = message;
+    kind = Kind::NONE;
+    columns.clear();
+}
+
+void ResultCursor::reset()
+{
+    kind = Kind::NONE;
+    errorMessage.clear();
+    columns.clear();
+    position = 0;
+    borrowedPlan = nullptr;
+    pool = nullptr;
+    buffered.clear();
+    bufferedPosition = 0;
+    aggregateValues.clear();
+    groupRows.clear();
+    sorter.clear();
+    sorted = false;
+    order.clear();
+    skip = 0;
+    remaining = UINT64_MAX;
+}
+
+void ResultCursor::ownPlan()
+{
+    if (borrowedPlan)
+    {
+        ownedPlan = *borrowedPlan;
+        borrowedPlan = nullptr;
+    }
+}
@@ -0,0 +1,106 @@
+#ifndef RESULT_CURSOR_HPP
+#define RESULT_CURSOR_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "column_store.hpp"
+#include "join.hpp"
+#include "planner.hpp"
+#include "sort.hpp"
+
+// 结果中的一列：列名、所在的表列，以及来自连接的哪一侧（单表查询只有 0）
+struct ResultColumn
+{
+    std::string name;
+    const ColumnData *data;
+    size_t source;
+};
+
+// 类 ResultBatch 是游标一次取出的一批结果行。批中只记录行号，值在读取时直接从表的列中取出，不复制表的存储
+class ResultBatch
+{
+public:
+    size_t size() const { return rows[0].size(); }
+    bool empty() const { return rows[0].empty(); }
+    size_t columnCount() const { return columns ? columns->size() : 0; }
+    ColumnType type(size_t column) const { return (*columns)[column].data->getType(); }
+    const ColumnData &column(size_t column) const { return *(*columns)[column].data; }
+    // 函数 rowAt 返回批中第 row 行在第 column 列所属的表中的行号
+    size_t rowAt(size_t row, size_t column) const { return rows[(*columns)[column].source][row]; }
+    int64_t intAt(size_t row, size_t column) const { return this->column(column).intAt(rowAt(row, column)); }
+    double floatAt(size_t row, size_t column) const { return this->column(column).floatAt(rowAt(row, column)); }
+    // 函数 textAt 返回去掉引号的 TEXT 值，指向表的存储
+    std::string_view textAt(size_t row, size_t column) const { return stripQuotes(this->column(column).textAt(rowAt(row, column))); }
+
+private:
+    friend class ResultCursor;
+    const std::vector<ResultColumn> *columns = nullptr;
+    std::vector<size_t> rows[2]; // 每个输入一组行号
+};
+
+// 类 ResultCursor 是 MiniDB::query 返回的结果游标。单表查询在每次 next 时才继续扫描（设置了线程池的大表一次并行扫描
+// 每个线程一个 morsel），连接查询、聚合查询和带 ORDER BY 的查询在打开时完成连接、聚合或排序，之后按批交出结果；
+// LIMIT/OFFSET 在交出时截取。游标引用表的列存储，表被修改、删除或切换数据库之后不能再使用
+class ResultCursor
+{
+public:
+    static const size_t BATCH_ROWS = 1024;
+
+    bool ok() const { return errorMessage.empty(); }
+    const std::string &error() const { return errorMessage; }
+    // 函数 hasRows 判断语句是否产生结果集：只有 SELECT 和连接查询会产生
+    bool hasRows() const { return kind != Kind::NONE; }
+    size_t columnCount() const { return columns.size(); }
+    const std::string &columnName(size_t column) const { return columns[column].name; }
+    ColumnType columnType(size_t column) const { return columns[column].data->getType(); }
+    // 函数 next 取出下一批至多 maxRows 行，结果取完时返回 false；调用方可以随时停止取数
+    bool next(ResultBatch &batch, size_t maxRows = BATCH_ROWS);
+
+private:
+    friend class MiniDB;
+    enum class Kind
+    {
+        NONE,
+        SCAN,
+        JOIN,
+        AGGREGATE
+    };
+    Kind kind = Kind::NONE;
+    std::string errorMessage;
+    std::vector<ResultColumn> columns;
+    size_t position = 0;
+    // 单表查询：borrowedPlan 指向计划缓存中的计划，为空时使用 ownedPlan
+    const ScanPlan *borrowedPlan = nullptr;
+    ScanPlan ownedPlan;
+    size_t rowCount = 0;
+    // 并行扫描：每次并行过滤一段 morsel，结果暂存在 buffered 中按批交出
+    ThreadPool *pool = nullptr;
+    std::vector<size_t> buffered;
+    size_t bufferedPosition = 0;
+    // 连接查询
+    JoinPlan joinPlan;
+    std::vector<JoinPair> pairs;
+    // 聚合查询：打开时即完成聚合，rowCount 为结果行数。聚合结果保存在游标自己的列中（输入 0），
+    // 分组列仍指向表的存储，groupRows 为每个分组的代表行（输入 1）
+    std::vector<ColumnData> aggregateValues;
+    std::vector<size_t> groupRows;
+    // ORDER BY：单表查询打开时排好序，由 sorter 按顺序交出行号；聚合查询的结果行顺序记在 order 中
+    RowSorter sorter;
+    bool sorted = false;
+    std::vector<size_t> order;
+    // LIMIT/OFFSET：还要跳过和还能交出的行数
+    uint64_t skip = 0;
+    uint64_t remaining = UINT64_MAX;
+
+    const ScanPlan &scan() const { return borrowedPlan ? *borrowedPlan : ownedPlan; }
+    // 函数 fetch 不考虑 LIMIT/OFFSET 取出下一批至多 maxRows 行
+    bool fetch(ResultBatch &batch, size_t maxRows);
+    void fail(const std::string &message);
+    // 函数 reset 清除上一条语句的状态，保留已分配的缓冲区以便复用
+    void reset();
+    // 函数 ownPlan 复制借用的扫描计划，之后的语句改写计划缓存时游标不受影响
+    void ownPlan();
+};
+
+#endif // RESULT_CURSOR_HPP
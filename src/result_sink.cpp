@@ -0,0 +1,167 @@
+#include "result_sink.hpp"
+#include <charconv>
+
+bool parseResultFormat(const std::string &name, ResultFormat &format)
+{
+    if (name == "CSV")
+        format = ResultFormat::CSV;
+    else if (name == "TSV")
+        format = ResultFormat::TSV;
+    else if (name == "BINARY")
+        format = ResultFormat::BINARY;
+    else
+        return false;
+    return true;
+}
+
+void ResultSink::separate()
+{
+    if (!firstField)
+        buffer += format == ResultFormat::TSV ? '\t' : ',';
+    firstField = false;
+}
+
+void ResultSink::header(const std::vector<std::string> &names)
+{
+    if (format == ResultFormat::BINARY)
+    {
+        putTag('H');
+        putRaw(static_cast<uint32_t>(names.size()));
+        for (const auto &name : names)
+        {
+            putRaw(static_cast<uint32_t>(name.size()));
+            buffer += name;
+        }
+        return;
+    }
+    beginRow();
+    for (const auto &name : names)
+    {
+        separate();
+        buffer += name;
+    }
+    endRow();
+}
+
+void ResultSink::beginRow()
+{
+    firstField = true;
+    if (format == ResultFormat::BINARY)
+        putTag('R');
+}
+
+void ResultSink::addInt(int64_t value)
+{
+    if (format == ResultFormat::BINARY)
+    {
+        putTag('I');
+        putRaw(value);
+        return;
+    }
+    separate();
+    formatInteger(buffer, value);
+}
+
+void ResultSink::addFloat(double value)
+{
+    if (format == ResultFormat::BINARY)
+    {
+        putTag('F');
+        putRaw(value);
+        return;
+    }
+    separate();
+    char text[512];
+    auto result = std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, 2);
+    buffer.append(text, result.ptr);
+}
+
+void ResultSink::addText(std::string_view value)
+{
+    switch (format)
+    {
+    case ResultFormat::BINARY:
+        putTag('T');
+        putRaw(static_cast<uint32_t>(value.size()));
+        buffer.append(value);
+        break;
+    case ResultFormat::TSV:
+        separate();
+        for (char c : stripQuotes(value))
+        {
+            if (c == '\t')
+                buffer += "\\t";
+            else if (c == '\n')
+                buffer += "\\n";
+            else if (c == '\\')
+                buffer += "\\\\";
+            else
+                buffer += c;
+        }
+        break;
+    default:
+        separate();
+        buffer.append(value);
+        break;
+    }
+}
+
+void ResultSink::addValue(const ColumnData &column, size_t row)
+{
+    switch (column.getType())
+    {
+    case ColumnType::INTEGER:
+        addInt(column.intAt(row));
+        break;
+    case ColumnType::FLOAT:
+        addFloat(column.floatAt(row));
+        break;
+    default:
+        addText(column.textAt(row));
+        break;
+    }
+}
+
+void ResultSink::addStoredValue(const ColumnData &column, size_t row)
+{
+    if (format == ResultFormat::BINARY || column.getType() != ColumnType::FLOAT)
+    {
+        addValue(column, row);
+        return;
+    }
+    separate();
+    formatFloat(buffer, column.floatAt(row));
+}
+
+void ResultSink::endRow()
+{
+    if (format != ResultFormat::BINARY)
+        buffer += '\n';
+    if (buffer.size() >= FLUSH_BYTES)
+        flush();
+}
+
+void ResultSink::endResult()
+{
+    switch (format)
+    {
+    case ResultFormat::BINARY:
+        putTag('E');
+        break;
+    case ResultFormat::TSV:
+        buffer += '\n';
+        break;
+    default:
+        buffer += "---\n";
+        break;
+    }
+    flush();
+}
+
+void ResultSink::flush()
+{
+    if (buffer.empty())
+        return;
+    out->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+}
@@ -0,0 +1,68 @@
+#ifndef RESULT_SINK_HPP
+#define RESULT_SINK_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "column_store.hpp"
+
+// 查询结果的输出格式：
+//   CSV    —— 逗号分隔，每个结果以 "---" 一行结束（默认，与原来的输出相同）；
+//   TSV    —— 制表符分隔，TEXT 值去掉引号并转义 \t \n \\，每个结果以空行结束；
+//   BINARY —— 紧凑的二进制行：'H' u32 列数 + 各列名，'R' 开始一行，
+//             值为 'I' int64 / 'F' double / 'T' u32 长度 + 字节，'E' 结束一个结果。整数按本机字节序
+enum class ResultFormat
+{
+    CSV,
+    TSV,
+    BINARY
+};
+
+bool parseResultFormat(const std::string &name, ResultFormat &format);
+
+// 类 ResultSink 把查询结果编码到内存缓冲区，缓冲区超过 FLUSH_BYTES 或一个结果结束时才整体写入输出流，
+// 不再每行刷新一次
+class ResultSink
+{
+public:
+    static const size_t FLUSH_BYTES = 1 << 20;
+
+    explicit ResultSink(std::ostream &output) : out(&output) {}
+    ResultSink(const ResultSink &) = delete;
+    ResultSink &operator=(const ResultSink &) = delete;
+    ~ResultSink() { flush(); }
+
+    void setFormat(ResultFormat resultFormat) { format = resultFormat; }
+    ResultFormat getFormat() const { return format; }
+
+    // 函数 header 输出列名行
+    void header(const std::vector<std::string> &names);
+    void beginRow();
+    void addInt(int64_t value);
+    // 函数 addFloat 以两位小数输出
+    void addFloat(double value);
+    void addText(std::string_view value);
+    // 函数 addValue 按查询结果的格式输出一个值：FLOAT 保留两位小数
+    void addValue(const ColumnData &column, size_t row);
+    // 函数 addStoredValue 按存储格式输出一个值（连接查询的输出沿用这种写法）
+    void addStoredValue(const ColumnData &column, size_t row);
+    void endRow();
+    // 函数 endResult 写出结果结束标记并把缓冲区交给输出流
+    void endResult();
+    void flush();
+
+private:
+    std::ostream *out;
+    ResultFormat format = ResultFormat::CSV;
+    std::string buffer;
+    bool firstField = true;
+
+    void separate();
+    void putTag(char tag) { buffer += tag; }
+    template <typename T>
+    void putRaw(T value) { buffer.append(reinterpret_cast<const char *>(&value), sizeof(value)); }
+};
+
+#endif // RESULT_SINK_HPP
@@ -0,0 +1,55 @@
+#include "segmented.hpp"
+#include <cstring>
+#include <utility>
+
+const char *TextHeap::append(std::string_view value)
+{
+    if (value.empty())
+        return cursor;
+    if (!cursor || value.size() > static_cast<size_t>(limit - cursor))
+    {
+        // 块从 4 KB 开始按两倍增长；单个值比块还大时为它单独申请
+        size_t size = std::max(nextChunk, value.size());
+        chunks.emplace_back(new char[size]);
+        cursor = chunks.back().get();
+        limit = cursor + size;
+        nextChunk = std::min(nextChunk * 2, MAX_CHUNK);
+    }
+    char *data = cursor;
+    std::memcpy(data, value.data(), value.size());
+    cursor += value.size();
+    used += value.size();
+    return data;
+}
+
+void TextHeap::unwind(const char *data, size_t length)
+{
+    if (length == 0 || data + length != cursor)
+        return;
+    cursor -= length;
+    used -= length;
+}
+
+void TextHeap::reserve(size_t bytes)
+{
+    if (cursor && bytes <= static_cast<size_t>(limit - cursor))
+        return;
+    nextChunk = std::max(nextChunk, std::min(bytes, MAX_CHUNK));
+}
+
+void TextHeap::clear()
+{
+    chunks.clear();
+    cursor = limit = nullptr;
+    nextChunk = FIRST_CHUNK;
+    used = 0;
+}
+
+void TextHeap::swap(TextHeap &other) noexcept
+{
+    chunks.swap(other.chunks);
+    std::swap(cursor, other.cursor);
+    std::swap(limit, other.limit);
+    std::swap(nextChunk, other.nextChunk);
+    std::swap(used, other.used);
+}
@@ -0,0 +1,256 @@
+#ifndef SEGMENTED_HPP
+#define SEGMENTED_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// 类 SegmentedArray 把元素按下标分成固定大小（2^SEGMENT_BITS 个元素）的段存放，段由引用计数共享，复制整个数组只复制段指针（写时复制）。
+// 修改一个被共享的段之前先复制这个段，其他副本看到的内容不变；追加只写入任何副本都还看不到的下标，
+// 所以只有原数组能原地追加到共享的末尾段，副本第一次追加时先复制末尾段。T 必须是平凡可复制的类型
+template <typename T, size_t SEGMENT_BITS>
+class SegmentedArray
+{
+public:
+    static constexpr size_t SEGMENT_SIZE = size_t(1) << SEGMENT_BITS;
+
+    SegmentedArray() = default;
+    SegmentedArray(const SegmentedArray &other)
+        : segments(other.segments), pointers(other.pointers), count(other.count), firstCapacity(other.firstCapacity), ownsTail(false)
+    {
+    }
+    SegmentedArray &operator=(const SegmentedArray &other)
+    {
+        if (this != &other)
+        {
+            segments = other.segments;
+            pointers = other.pointers;
+            count = other.count;
+            firstCapacity = other.firstCapacity;
+            ownsTail = false;
+        }
+        return *this;
+    }
+    SegmentedArray(SegmentedArray &&other) noexcept
+        : segments(std::move(other.segments)), pointers(std::move(other.pointers)), count(other.count), firstCapacity(other.firstCapacity), ownsTail(other.ownsTail)
+    {
+        other.clear();
+    }
+    SegmentedArray &operator=(SegmentedArray &&other) noexcept
+    {
+        if (this != &other)
+        {
+            segments = std::move(other.segments);
+            pointers = std::move(other.pointers);
+            count = other.count;
+            firstCapacity = other.firstCapacity;
+            ownsTail = other.ownsTail;
+            other.clear();
+        }
+        return *this;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T &operator[](size_t i) const { return pointers[i >> SEGMENT_BITS][i & MASK]; }
+    // 函数 block 返回第 i 个元素的地址，从它到所在段末尾的元素连续存放
+    const T *block(size_t i) const { return pointers[i >> SEGMENT_BITS] + (i & MASK); }
+
+    // 函数 mutableAt 返回可写的第 i 个元素，所在的段被共享时先复制
+    T &mutableAt(size_t i)
+    {
+        size_t segment = i >> SEGMENT_BITS;
+        unshare(segment);
+        return pointers[segment][i & MASK];
+    }
+    void set(size_t i, const T &value) { mutableAt(i) = value; }
+    // 函数 detach 在第 i 个元素所在的段被共享时先复制它。多个线程并发修改同一段中的元素之前，由一个线程先调用，
+    // 否则各线程会各自复制这个段，只有最后换上的副本保留下来
+    void detach(size_t i) { unshare(i >> SEGMENT_BITS); }
+
+    void push_back(const T &value)
+    {
+        size_t segment = count >> SEGMENT_BITS;
+        size_t offset = count & MASK;
+        if (segment == segments.size())
+            addSegment();
+        else if (offset == capacityOf(segment))
+            growFirst(std::min(firstCapacity * 2, SEGMENT_SIZE));
+        else if (!ownsTail)
+            unshare(segment);
+        ownsTail = true;
+        pointers[segment][offset] = value;
+        ++count;
+    }
+    // 函数 append 追加 n 个元素的原始字节，values 不要求按 T 对齐
+    void append(const void *values, size_t n)
+    {
+        const char *bytes = static_cast<const char *>(values);
+        reserve(count + n);
+        while (n > 0)
+        {
+            size_t segment = count >> SEGMENT_BITS;
+            size_t offset = count & MASK;
+            if (segment == segments.size())
+                addSegment();
+            else if (!ownsTail)
+                unshare(segment);
+            ownsTail = true;
+            size_t take = std::min(n, capacityOf(segment) - offset);
+            std::memcpy(pointers[segment] + offset, bytes, take * sizeof(T));
+            bytes += take * sizeof(T);
+            count += take;
+            n -= take;
+        }
+    }
+    void pop_back() { resize(count - 1); }
+    // 函数 resize 缩短时只丢弃末尾的元素；之后追加会覆盖的段如果被共享，先复制，使其他副本中仍可见的元素保持不变
+    void resize(size_t n, const T &value = T())
+    {
+        if (n >= count)
+        {
+            reserve(n);
+            while (count < n)
+                push_back(value);
+            return;
+        }
+        count = n;
+        size_t kept = (n + MASK) >> SEGMENT_BITS;
+        segments.resize(kept);
+        pointers.resize(kept);
+        if ((n & MASK) != 0)
+            unshare(n >> SEGMENT_BITS);
+        if (segments.empty())
+            firstCapacity = 0;
+    }
+    // 函数 reserve 只预留第一个段的容量，之后的段总是一次分配整段
+    void reserve(size_t n)
+    {
+        size_t wanted = std::min(n, SEGMENT_SIZE);
+        if (segments.empty())
+            firstCapacity = std::max(firstCapacity, wanted);
+        else if (segments.size() == 1 && firstCapacity < wanted)
+            growFirst(wanted);
+    }
+    void clear()
+    {
+        segments.clear();
+        pointers.clear();
+        count = 0;
+        firstCapacity = 0;
+        ownsTail = true;
+    }
+
+    // 函数 forEachSegment 按顺序对每段中已使用的元素调用 visit(const T *values, size_t count)
+    template <typename Visit>
+    void forEachSegment(Visit &&visit) const
+    {
+        for (size_t segment = 0; segment < segments.size(); ++segment)
+            visit(static_cast<const T *>(pointers[segment]), usedIn(segment));
+    }
+
+private:
+    static constexpr size_t MASK = SEGMENT_SIZE - 1;
+
+    std::vector<std::shared_ptr<T[]>> segments;
+    std::vector<T *> pointers; // 与 segments 对应，按下标访问时少一次间接寻址
+    size_t count = 0;
+    size_t firstCapacity = 0; // 只有第一段可能小于整段，从小容量开始按倍数增长
+    bool ownsTail = true;     // 复制得到的数组不拥有末尾段中未使用的位置
+
+    size_t capacityOf(size_t segment) const { return segment == 0 ? firstCapacity : SEGMENT_SIZE; }
+    size_t usedIn(size_t segment) const { return std::min(capacityOf(segment), count - (segment << SEGMENT_BITS)); }
+
+    void replace(size_t segment, size_t capacity)
+    {
+        std::shared_ptr<T[]> copy(new T[capacity]);
+        size_t used = segment < segments.size() ? usedIn(segment) : 0;
+        if (used > 0)
+            std::copy(pointers[segment], pointers[segment] + used, copy.get());
+        if (segment == segments.size())
+        {
+            segments.push_back(nullptr);
+            pointers.push_back(nullptr);
+        }
+        pointers[segment] = copy.get();
+        segments[segment] = std::move(copy);
+    }
+    void addSegment()
+    {
+        if (segments.empty())
+            firstCapacity = std::max<size_t>(firstCapacity, std::min<size_t>(16, SEGMENT_SIZE));
+        replace(segments.size(), capacityOf(segments.size()));
+    }
+    void growFirst(size_t capacity)
+    {
+        firstCapacity = capacity;
+        replace(0, capacity);
+        ownsTail = true;
+    }
+    void unshare(size_t segment)
+    {
+        if (segment >= segments.size())
+            return;
+        if (segments[segment].use_count() > 1)
+        {
+            replace(segment, capacityOf(segment));
+            if (segment + 1 == segments.size())
+                ownsTail = true;
+            return;
+        }
+        // 其他副本释放段时的读取先于这里的写入
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+};
+
+// 类 TextHeap 是 TEXT 列的字节存储：值只追加到按块分配的内存中，地址在值被丢弃前保持不变。
+// 块由引用计数共享，复制 TextHeap 不复制字节；复制得到的 TextHeap 从新的块开始追加，已写入的字节从不原地修改
+class TextHeap
+{
+public:
+    TextHeap() = default;
+    TextHeap(const TextHeap &other) : chunks(other.chunks), used(other.used) {}
+    TextHeap &operator=(const TextHeap &other)
+    {
+        if (this != &other)
+        {
+            chunks = other.chunks;
+            cursor = limit = nullptr;
+            used = other.used;
+        }
+        return *this;
+    }
+    TextHeap(TextHeap &&other) noexcept { swap(other); }
+    TextHeap &operator=(TextHeap &&other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // 函数 append 复制 value 并返回副本的地址
+    const char *append(std::string_view value);
+    // 函数 unwind 归还最近一次 append 的字节，data 不是最后追加的值时什么也不做
+    void unwind(const char *data, size_t length);
+    // 函数 reserve 让下一个块至少能容纳 bytes 个字节
+    void reserve(size_t bytes);
+    void clear();
+    // 函数 usedBytes 返回追加过的字节总数，包括已经不再引用的字节
+    size_t usedBytes() const { return used; }
+    void swap(TextHeap &other) noexcept;
+
+private:
+    static constexpr size_t FIRST_CHUNK = 4 * 1024;
+    static constexpr size_t MAX_CHUNK = 16 * 1024 * 1024;
+
+    std::vector<std::shared_ptr<char[]>> chunks;
+    char *cursor = nullptr;
+    char *limit = nullptr;
+    size_t nextChunk = FIRST_CHUNK;
+    size_t used = 0;
+};
+
+#endif // SEGMENTED_HPP
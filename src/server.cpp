@@ -0,0 +1,333 @@
+#include "server.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "protocol.hpp"
+
+namespace
+{
+    volatile sig_atomic_t stopRequested = 0;
+    int signalFd = -1;
+
+    void onSignal(int)
+    {
+        stopRequested = 1;
+        char byte = 0;
+        if (write(signalFd, &byte, 1) < 0)
+        {
+            // 管道已满时主线程已经会被唤醒
+        }
+    }
+
+    void setNonBlocking(int fd)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+
+    // 类 CaptureOutput 在作用域内把标准输出和标准错误换成请求自己的缓冲区
+    class CaptureOutput
+    {
+    public:
+        CaptureOutput(std::ostream &output, std::ostream &errors)
+            : savedOut(std::cout.rdbuf(output.rdbuf())), savedErr(std::cerr.rdbuf(errors.rdbuf()))
+        {
+        }
+        ~CaptureOutput()
+        {
+            std::cout.rdbuf(savedOut);
+            std::cerr.rdbuf(savedErr);
+        }
+
+    private:
+        std::streambuf *savedOut;
+        std::streambuf *savedErr;
+    };
+}
+
+Server::Server(MiniDB &engine, size_t workers)
+    : db(engine), workerCount(workers != 0 ? workers : std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+Server::~Server()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueReady.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+    for (auto &entry : connections)
+        close(entry.first);
+    for (int fd : wakeFds)
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+}
+
+bool Server::serve(const std::string &address)
+{
+    std::string error;
+    int listener = listenOn(address, error);
+    if (listener < 0)
+    {
+        std::cerr << "Error: cannot listen on " << error << std::endl;
+        return false;
+    }
+    if (pipe(wakeFds) != 0)
+    {
+        std::cerr << "Error: cannot create wake pipe." << std::endl;
+        closeListener(listener, address);
+        return false;
+    }
+    setNonBlocking(wakeFds[0]);
+    setNonBlocking(wakeFds[1]);
+    setNonBlocking(listener);
+    signalFd = wakeFds[1];
+    stopRequested = 0;
+    std::signal(SIGPIPE, SIG_IGN);
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    // 工作线程启动后标准输出可能被换成请求的缓冲区，在此之前打印
+    std::cout << "minidb listening on " << address << " with " << workerCount << " workers" << std::endl;
+    for (size_t i = 0; i < workerCount; ++i)
+        workers.emplace_back(&Server::workerLoop, this);
+
+    std::vector<pollfd> polled;
+    while (!stopRequested)
+    {
+        polled.clear();
+        polled.push_back({wakeFds[0], POLLIN, 0});
+        polled.push_back({listener, POLLIN, 0});
+        for (auto &entry : connections)
+        {
+            if (!entry.second->busy && !entry.second->closing)
+                polled.push_back({entry.first, POLLIN, 0});
+        }
+        if (poll(polled.data(), polled.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        // 先读客户端，再处理做完的请求和新连接，这样本轮 poll 的文件描述符不会被新连接复用
+        for (size_t i = 2; i < polled.size(); ++i)
+        {
+            if (polled[i].revents == 0)
+                continue;
+            Connection &connection = *connections[polled[i].fd];
+            char buffer[64 * 1024];
+            for (;;)
+            {
+                ssize_t got = recv(connection.fd, buffer, sizeof(buffer), 0);
+                if (got > 0)
+                {
+                    connection.input.append(buffer, static_cast<size_t>(got));
+                    continue;
+                }
+                if (got < 0 && errno == EINTR)
+                    continue;
+                if (got == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                    connection.closing = true;
+                break;
+            }
+            // 对方关闭之前发来的完整请求照常执行，做完后再关闭
+            dispatch(connection);
+            if (connection.closing && !connection.busy)
+                retire(connection);
+        }
+        if (polled[0].revents != 0)
+        {
+            char drain[256];
+            while (read(wakeFds[0], drain, sizeof(drain)) > 0)
+            {
+            }
+            std::vector<std::pair<Connection *, Outcome>> done;
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                done.swap(finished);
+            }
+            for (auto &[connection, outcome] : done)
+            {
+                connection->busy = false;
+                if (outcome == Outcome::FAILED)
+                    connection->closing = true;
+                else if (outcome == Outcome::REPLIED)
+                    dispatch(*connection);
+                if (connection->closing && !connection->busy)
+                    retire(*connection);
+            }
+            // 事务结束后重新提交暂缓的请求；事务在这次检查之后才结束时，它的回复会再次唤醒主线程
+            if (transactionSession.load() == 0)
+            {
+                for (auto &entry : connections)
+                {
+                    if (!entry.second->busy && entry.second->deferred)
+                        dispatch(*entry.second);
+                }
+            }
+        }
+        if (polled[1].revents != 0)
+        {
+            int fd;
+            while ((fd = accept(listener, nullptr, nullptr)) >= 0)
+            {
+                setNonBlocking(fd);
+                auto connection = std::make_unique<Connection>();
+                connection->fd = fd;
+                connection->session = nextSession++;
+                connections[fd] = std::move(connection);
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueReady.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+    workers.clear();
+    while (!connections.empty())
+        closeConnection(connections.begin()->first);
+    closeListener(listener, address);
+    std::signal(SIGINT, SIG_DFL);
+    std::signal(SIGTERM, SIG_DFL);
+    signalFd = -1;
+    std::cout << "minidb server stopped" << std::endl;
+    return true;
+}
+
+void Server::dispatch(Connection &connection)
+{
+    if (connection.busy)
+        return;
+    if (connection.deferred)
+    {
+        connection.deferred = false;
+        enqueue(connection, std::move(connection.parked));
+        return;
+    }
+    std::string request;
+    int status = takeFrame(connection.input, request);
+    if (status < 0)
+    {
+        // 帧长度超出上限，无法再与这个客户端同步
+        connection.input.clear();
+        connection.closing = true;
+        return;
+    }
+    if (status == 0)
+        return;
+    enqueue(connection, std::move(request));
+}
+
+void Server::enqueue(Connection &connection, std::string request)
+{
+    connection.busy = true;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        jobs.push_back({&connection, std::move(request)});
+    }
+    queueReady.notify_one();
+}
+
+void Server::retire(Connection &connection)
+{
+    if (connection.session == transactionSession.load())
+    {
+        enqueue(connection, "ROLLBACK;");
+        return;
+    }
+    closeConnection(connection.fd);
+}
+
+void Server::closeConnection(int fd)
+{
+    close(fd);
+    connections.erase(fd);
+}
+
+void Server::workerLoop()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this]
+                            { return stopping || !jobs.empty(); });
+            if (jobs.empty())
+                return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        std::string output, errors;
+        Outcome outcome = Outcome::DEFERRED;
+        if (handle(*job.connection, job.request, output, errors))
+            outcome = writeFrame(job.connection->fd, output) && writeFrame(job.connection->fd, errors) ? Outcome::REPLIED : Outcome::FAILED;
+        else
+        {
+            job.connection->parked = std::move(job.request);
+            job.connection->deferred = true;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            finished.emplace_back(job.connection, outcome);
+        }
+        char byte = 0;
+        if (write(wakeFds[1], &byte, 1) < 0)
+        {
+            // 管道已满时主线程已经会被唤醒
+        }
+    }
+}
+
+// 函数 handle 在引擎锁内执行一个请求中的各条语句：先换入这个会话的数据库，输出和错误信息分别收集到 output 和 errors；
+// 执行之后记下这个会话是否留下了未结束的事务
+bool Server::handle(Connection &connection, const std::string &request, std::string &output, std::string &errors)
+{
+    std::ostringstream out, err;
+    std::lock_guard<std::mutex> lock(engineMutex);
+    uint64_t owner = transactionSession.load();
+    if (owner != 0 && owner != connection.session)
+        return false;
+    {
+        CaptureOutput capture(out, err);
+        if (activeSession != connection.session)
+        {
+            db.switchDatabase(connection.database);
+            activeSession = connection.session;
+        }
+        std::istringstream input(request);
+        StatementReader reader(input);
+        std::string command;
+        while (reader.next(command))
+        {
+            try
+            {
+                db.run(command);
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << e.what() << '\n';
+            }
+        }
+        Database *current = db.getCurrentDatabase();
+        connection.database = current ? current->name : "";
+        transactionSession.store(db.inTransaction() ? connection.session : 0);
+    }
+    output = out.str();
+    errors = err.str();
+    return true;
+}
@@ -0,0 +1,85 @@
+#ifndef SERVER_HPP
+#define SERVER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "data_manager.hpp"
+
+// 类 Server 是 minidb --serve 的守护进程：数据库常驻在一个 MiniDB 中，客户端按 protocol.hpp 中的协议发来 SQL。
+// 主线程用 poll 接受连接并收齐请求帧，完整的请求交给工作线程池执行并回复；一个连接同一时间只有一个请求在执行，
+// 它收到的下一个请求等这个请求回复后才开始。每个连接是一个会话，记住自己 USE 的数据库。
+// MiniDB 通过标准输出和标准错误报告结果，执行语句时要把它们换成这个请求的缓冲区，所以语句在引擎锁内逐个执行；
+// 工作线程并行的是收发和回复，一个客户端取大量结果时不会挡住其他客户端。
+// 一个会话 BEGIN 之后，直到它 COMMIT 或 ROLLBACK 为止，其他会话的请求都暂缓执行；事务未结束就断开的会话自动回滚
+class Server
+{
+public:
+    // workers 为 0 时使用硬件线程数
+    Server(MiniDB &engine, size_t workers);
+    ~Server();
+    Server(const Server &) = delete;
+    Server &operator=(const Server &) = delete;
+
+    // 函数 serve 在 address 上监听并处理请求，直到收到 SIGINT 或 SIGTERM；不能监听时打印原因并返回 false
+    bool serve(const std::string &address);
+
+private:
+    struct Connection
+    {
+        int fd = -1;
+        uint64_t session = 0;
+        std::string database; // 这个会话当前使用的数据库，为空表示还没有选择
+        std::string input;    // 已收到但还没有取出的字节
+        bool busy = false;    // 有请求交给了工作线程，只由主线程读写
+        bool closing = false; // 对方已经关闭或出错，空闲后关闭
+        bool deferred = false; // parked 中有一个因其他会话的事务而暂缓的请求
+        std::string parked;
+    };
+    struct Job
+    {
+        Connection *connection;
+        std::string request;
+    };
+
+    MiniDB &db;
+    size_t workerCount;
+    std::vector<std::thread> workers;
+    std::mutex engineMutex; // 串行执行语句，同时保护标准输出和标准错误的重定向
+    uint64_t activeSession = 0;
+    std::mutex queueMutex;
+    std::condition_variable queueReady;
+    std::deque<Job> jobs;
+    std::atomic<uint64_t> transactionSession{0}; // 有未结束的事务的会话，0 表示没有；只在引擎锁内修改
+    // 工作线程做完的请求：回复成功、回复失败，或者因为其他会话的事务暂缓
+    enum class Outcome
+    {
+        REPLIED,
+        FAILED,
+        DEFERRED
+    };
+    std::vector<std::pair<Connection *, Outcome>> finished;
+    bool stopping = false;
+    int wakeFds[2] = {-1, -1}; // 工作线程做完请求后写入，唤醒主线程的 poll
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    uint64_t nextSession = 1;
+
+    void workerLoop();
+    // 函数 handle 执行一个请求，其他会话的事务未结束时不执行并返回 false
+    bool handle(Connection &connection, const std::string &request, std::string &output, std::string &errors);
+    // 函数 dispatch 把暂缓的请求或连接缓冲区中的下一个完整请求交给工作线程，没有完整请求时什么也不做
+    void dispatch(Connection &connection);
+    void enqueue(Connection &connection, std::string request);
+    // 函数 retire 关闭空闲的连接，连接还有未结束的事务时先交给工作线程回滚
+    void retire(Connection &connection);
+    void closeConnection(int fd);
+};
+
+#endif // SERVER_HPP
@@ -0,0 +1,333 @@
+#include "simd_filter.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MINIDB_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+template <CompareOp Op, typename T>
+static inline bool compareOne(T value, T constant)
+{
+    if (Op == CompareOp::EQUAL)
+        return value == constant;
+    if (Op == CompareOp::GREATER)
+        return value > constant;
+    return value < constant;
+}
+
+// 函数 scalarTail 逐个比较 values[from..count)，结果写入对应的位；from 是 64 的倍数，之前的位由调用方写好
+template <CompareOp Op, typename T>
+static inline void scalarTail(const T *values, size_t from, size_t count, T constant, uint64_t *bits)
+{
+    for (size_t i = from; i < count; ++i)
+    {
+        if (i % 64 == 0)
+            bits[i / 64] = 0;
+        bits[i / 64] |= static_cast<uint64_t>(compareOne<Op>(values[i], constant)) << (i % 64);
+    }
+}
+
+template <CompareOp Op, typename T>
+static void scalarCompare(const T *values, size_t count, T constant, uint64_t *bits)
+{
+    scalarTail<Op>(values, 0, count, constant, bits);
+}
+
+static void scalarCodes(const uint16_t *codes, size_t from, size_t count, uint16_t first, uint16_t second, uint64_t *bits)
+{
+    for (size_t i = from; i < count; ++i)
+    {
+        if (i % 64 == 0)
+            bits[i / 64] = 0;
+        bits[i / 64] |= static_cast<uint64_t>(codes[i] == first || codes[i] == second) << (i % 64);
+    }
+}
+
+#ifdef MINIDB_X86_KERNELS
+
+// 16 位编码：两组比较结果用 packs 压成字节，再用 movemask 取出每个编码一位
+__attribute__((target("avx2"))) static void avx2Codes(const uint16_t *codes, size_t count, uint16_t first, uint16_t second, uint64_t *bits)
+{
+    const __m256i key1 = _mm256_set1_epi16(static_cast<short>(first));
+    const __m256i key2 = _mm256_set1_epi16(static_cast<short>(second));
+    size_t full = count / 64 * 64;
+    for (size_t base = 0; base < full; base += 64)
+    {
+        uint64_t word = 0;
+        for (size_t i = 0; i < 64; i += 32)
+        {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(codes + base + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(codes + base + i + 16));
+            __m256i maskA = _mm256_or_si256(_mm256_cmpeq_epi16(a, key1), _mm256_cmpeq_epi16(a, key2));
+            __m256i maskB = _mm256_or_si256(_mm256_cmpeq_epi16(b, key1), _mm256_cmpeq_epi16(b, key2));
+            // packs 按 128 位分别交错两个输入，permute 恢复成 a 在前、b 在后的顺序
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(maskA, maskB), 0xD8);
+            word |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(packed))) << i;
+        }
+        bits[base / 64] = word;
+    }
+    scalarCodes(codes, full, count, first, second, bits);
+}
+
+__attribute__((target("sse4.2"))) static void sse42Codes(const uint16_t *codes, size_t count, uint16_t first, uint16_t second, uint64_t *bits)
+{
+    const __m128i key1 = _mm_set1_epi16(static_cast<short>(first));
+    const __m128i key2 = _mm_set1_epi16(static_cast<short>(second));
+    size_t full = count / 64 * 64;
+    for (size_t base = 0; base < full; base += 64)
+    {
+        uint64_t word = 0;
+        for (size_t i = 0; i < 64; i += 16)
+        {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(codes + base + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(codes + base + i + 8));
+            __m128i maskA = _mm_or_si128(_mm_cmpeq_epi16(a, key1), _mm_cmpeq_epi16(a, key2));
+            __m128i maskB = _mm_or_si128(_mm_cmpeq_epi16(b, key1), _mm_cmpeq_epi16(b, key2));
+            word |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(maskA, maskB)))) << i;
+        }
+        bits[base / 64] = word;
+    }
+    scalarCodes(codes, full, count, first, second, bits);
+}
+
+// AVX2：每次比较 4 个 int64 或 4 个 double，movemask 取出 4 位
+template <CompareOp Op>
+__attribute__((target("avx2"))) static void avx2Ints(const int64_t *values, size_t count, int64_t constant, uint64_t *bits)
+{
+    const __m256i key = _mm256_set1_epi64x(constant);
+    size_t full = count / 64 * 64;
+    for (size_t base = 0; base < full; base += 64)
+    {
+        uint64_t word = 0;
+        for (size_t i = 0; i < 64; i += 4)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + base + i));
+            __m256i mask;
+            if (Op == CompareOp::EQUAL)
+                mask = _mm256_cmpeq_epi64(v, key);
+            else if (Op == CompareOp::GREATER)
+                mask = _mm256_cmpgt_epi64(v, key);
+            else
+                mask = _mm256_cmpgt_epi64(key, v);
+            word |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(mask))) << i;
+        }
+        bits[base / 64] = word;
+    }
+    scalarTail<Op>(values, full, count, constant, bits);
+}
+
+template <CompareOp Op>
+__attribute__((target("avx2"))) static void avx2Floats(const double *values, size_t count, double constant, uint64_t *bits)
+{
+    const __m256d key = _mm256_set1_pd(constant);
+    size_t full = count / 64 * 64;
+    for (size_t base = 0; base < full; base += 64)
+    {
+        uint64_t word = 0;
+        for (size_t i = 0; i < 64; i += 4)
+        {
+            __m256d v = _mm256_loadu_pd(values + base + i);
+            __m256d mask;
+            // 有序比较：NaN 与任何值比较都不成立，与标量比较一致
+            if (Op == CompareOp::EQUAL)
+                mask = _mm256_cmp_pd(v, key, _CMP_EQ_OQ);
+            else if (Op == CompareOp::GREATER)
+                mask = _mm256_cmp_pd(v, key, _CMP_GT_OQ);
+            else
+                mask = _mm256_cmp_pd(v, key, _CMP_LT_OQ);
+            word |= static_cast<uint64_t>(_mm256_movemask_pd(mask)) << i;
+        }
+        bits[base / 64] = word;
+    }
+    scalarTail<Op>(values, full, count, constant, bits);
+}
+
+// SSE4.2：每次比较 2 个 int64（pcmpgtq 需要 SSE4.2）或 2 个 double
+template <CompareOp Op>
+__attribute__((target("sse4.2"))) static void sse42Ints(const int64_t *values, size_t count, int64_t constant, uint64_t *bits)
+{
+    const __m128i key = _mm_set1_epi64x(constant);
+    size_t full = count / 64 * 64;
+    for (size_t base = 0; base < full; base += 64)
+    {
+        uint64_t word = 0;
+        for (size_t i = 0; i < 64; i += 2)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + base + i));
+            __m128i mask;
+            if (Op == CompareOp::EQUAL)
+                mask = _mm_cmpeq_epi64(v, key);
+            else if (Op == CompareOp::GREATER)
+                mask = _mm_cmpgt_epi64(v, key);
+            else
+                mask = _mm_cmpgt_epi64(key, v);
+            word |= static_cast<uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(mask))) << i;
+        }
+        bits[base / 64] = word;
+    }
+    scalarTail<Op>(values, full, count, constant, bits);
+}
+
+template <CompareOp Op>
+__attribute__((target("sse4.2"))) static void sse42Floats(const double *values, size_t count, double constant, uint64_t *bits)
+{
+    const __m128d key = _mm_set1_pd(constant);
+    size_t full = count / 64 * 64;
+    for (size_t base = 0; base < full; base += 64)
+    {
+        uint64_t word = 0;
+        for (size_t i = 0; i < 64; i += 2)
+        {
+            __m128d v = _mm_loadu_pd(values + base + i);
+            __m128d mask;
+            if (Op == CompareOp::EQUAL)
+                mask = _mm_cmpeq_pd(v, key);
+            else if (Op == CompareOp::GREATER)
+                mask = _mm_cmpgt_pd(v, key);
+            else
+                mask = _mm_cmplt_pd(v, key);
+            word |= static_cast<uint64_t>(_mm_movemask_pd(mask)) << i;
+        }
+        bits[base / 64] = word;
+    }
+    scalarTail<Op>(values, full, count, constant, bits);
+}
+
+#endif // MINIDB_X86_KERNELS
+
+enum class SimdLevel
+{
+    SCALAR,
+    SSE42,
+    AVX2
+};
+
+// 函数 detectLevel 在第一次使用时检测 CPU 支持的指令集
+static SimdLevel detectLevel()
+{
+#ifdef MINIDB_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return SimdLevel::SSE42;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+static SimdLevel currentLevel()
+{
+    static const SimdLevel level = detectLevel();
+    return level;
+}
+
+template <CompareOp Op>
+static void dispatchInts(const int64_t *values, size_t count, int64_t constant, uint64_t *bits)
+{
+#ifdef MINIDB_X86_KERNELS
+    switch (currentLevel())
+    {
+    case SimdLevel::AVX2:
+        avx2Ints<Op>(values, count, constant, bits);
+        return;
+    case SimdLevel::SSE42:
+        sse42Ints<Op>(values, count, constant, bits);
+        return;
+    default:
+        break;
+    }
+#endif
+    scalarCompare<Op>(values, count, constant, bits);
+}
+
+template <CompareOp Op>
+static void dispatchFloats(const double *values, size_t count, double constant, uint64_t *bits)
+{
+#ifdef MINIDB_X86_KERNELS
+    switch (currentLevel())
+    {
+    case SimdLevel::AVX2:
+        avx2Floats<Op>(values, count, constant, bits);
+        return;
+    case SimdLevel::SSE42:
+        sse42Floats<Op>(values, count, constant, bits);
+        return;
+    default:
+        break;
+    }
+#endif
+    scalarCompare<Op>(values, count, constant, bits);
+}
+
+void compareInts(const int64_t *values, size_t count, CompareOp op, int64_t constant, uint64_t *bits)
+{
+    switch (op)
+    {
+    case CompareOp::EQUAL:
+        dispatchInts<CompareOp::EQUAL>(values, count, constant, bits);
+        break;
+    case CompareOp::GREATER:
+        dispatchInts<CompareOp::GREATER>(values, count, constant, bits);
+        break;
+    default:
+        dispatchInts<CompareOp::LESS>(values, count, constant, bits);
+        break;
+    }
+}
+
+void compareFloats(const double *values, size_t count, CompareOp op, double constant, uint64_t *bits)
+{
+    switch (op)
+    {
+    case CompareOp::EQUAL:
+        dispatchFloats<CompareOp::EQUAL>(values, count, constant, bits);
+        break;
+    case CompareOp::GREATER:
+        dispatchFloats<CompareOp::GREATER>(values, count, constant, bits);
+        break;
+    default:
+        dispatchFloats<CompareOp::LESS>(values, count, constant, bits);
+        break;
+    }
+}
+
+void matchCodes(const uint16_t *codes, size_t count, int32_t first, int32_t second, uint64_t *bits)
+{
+    if (first < 0 && second < 0)
+    {
+        // 常量不在字典中，没有行满足
+        for (size_t w = 0; w < (count + 63) / 64; ++w)
+            bits[w] = 0;
+        return;
+    }
+    // 只有一个编码有效时两次比较同一个编码，-1 不会与 65535 号编码混淆
+    uint16_t key1 = static_cast<uint16_t>(first >= 0 ? first : second);
+    uint16_t key2 = static_cast<uint16_t>(second >= 0 ? second : first);
+#ifdef MINIDB_X86_KERNELS
+    switch (currentLevel())
+    {
+    case SimdLevel::AVX2:
+        avx2Codes(codes, count, key1, key2, bits);
+        return;
+    case SimdLevel::SSE42:
+        sse42Codes(codes, count, key1, key2, bits);
+        return;
+    default:
+        break;
+    }
+#endif
+    scalarCodes(codes, 0, count, key1, key2, bits);
+}
+
+const char *simdLevel()
+{
+    switch (currentLevel())
+    {
+    case SimdLevel::AVX2:
+        return "avx2";
+    case SimdLevel::SSE42:
+        return "sse4.2";
+    default:
+        return "scalar";
+    }
+}
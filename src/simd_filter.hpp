@@ -0,0 +1,18 @@
+#ifndef SIMD_FILTER_HPP
+#define SIMD_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "predicate.hpp"
+
+// 数值列的比较内核：把 values[0..count) 与常量逐个比较，第 i 个结果写入选择位图 bits 的第 i 位，
+// 最后一个字中 count 之后的位清零。运行时按 CPU 支持的指令集选用 AVX2、SSE4.2 或标量实现
+void compareInts(const int64_t *values, size_t count, CompareOp op, int64_t constant, uint64_t *bits);
+void compareFloats(const double *values, size_t count, CompareOp op, double constant, uint64_t *bits);
+// 函数 matchCodes 比较字典编码：codes[i] 等于 first 或 second 时置位；编码为 -1 表示不参与比较
+void matchCodes(const uint16_t *codes, size_t count, int32_t first, int32_t second, uint64_t *bits);
+
+// 函数 simdLevel 返回当前使用的实现："avx2"、"sse4.2" 或 "scalar"
+const char *simdLevel();
+
+#endif // SIMD_FILTER_HPP
@@ -0,0 +1,103 @@
+#include "snapshot.hpp"
+#include <algorithm>
+
+SnapshotSource::SnapshotSource()
+{
+    for (size_t slot = 0; slot < MAX_READERS; ++slot)
+    {
+        pinned[slot].store(0);
+        used[slot].store(false);
+    }
+}
+
+SnapshotSource::~SnapshotSource()
+{
+    delete current.load();
+}
+
+void SnapshotSource::publish(std::unique_ptr<DatabaseVersion> version)
+{
+    DatabaseVersion *old = current.exchange(version.release());
+    if (old)
+    {
+        // 取到旧版本的读者记下的纪元不会大于换入新版本之后纪元递增前的值
+        retired.emplace_back(epoch.fetch_add(1), std::unique_ptr<DatabaseVersion>(old));
+    }
+    reclaim();
+}
+
+void SnapshotSource::reclaim()
+{
+    uint64_t oldest = UINT64_MAX;
+    for (size_t slot = 0; slot < MAX_READERS; ++slot)
+    {
+        uint64_t value = pinned[slot].load();
+        if (value != 0)
+            oldest = std::min(oldest, value);
+    }
+    retired.erase(std::remove_if(retired.begin(), retired.end(), [oldest](const auto &entry)
+                                 { return entry.first < oldest; }),
+                  retired.end());
+}
+
+int SnapshotSource::acquireSlot()
+{
+    for (size_t slot = 0; slot < MAX_READERS; ++slot)
+    {
+        bool expected = false;
+        if (used[slot].compare_exchange_strong(expected, true))
+            return static_cast<int>(slot);
+    }
+    return -1;
+}
+
+void SnapshotSource::releaseSlot(int slot)
+{
+    pinned[slot].store(0);
+    used[slot].store(false);
+}
+
+const DatabaseVersion *SnapshotSource::pin(int slot)
+{
+    pinned[slot].store(epoch.load());
+    return current.load();
+}
+
+void SnapshotSource::unpin(int slot)
+{
+    pinned[slot].store(0);
+}
+
+SnapshotReader::SnapshotReader(std::shared_ptr<SnapshotSource> versions, int readerSlot, const std::string &databaseName)
+    : source(std::move(versions)), slot(readerSlot), name(databaseName)
+{
+    // 读者通常很多，各自单线程扫描；需要时可以用 SET THREADS 打开并行扫描
+    db.readOnly = true;
+    db.scanThreads.setThreads(1);
+    db.currentDatabase = &db.databases[name];
+    db.currentDatabase->name = name;
+}
+
+SnapshotReader::~SnapshotReader()
+{
+    source->releaseSlot(slot);
+}
+
+// 函数 refresh 换入最新提交的版本：复制各表只复制段指针，版本没有变化时保留原来的表和计划缓存
+void SnapshotReader::refresh()
+{
+    const DatabaseVersion *version = source->pin(slot);
+    if (version && version->timestamp != timestamp)
+    {
+        db.currentDatabase->tables = version->tables;
+        db.planCache.invalidate();
+        timestamp = version->timestamp;
+    }
+    source->unpin(slot);
+}
+
+ResultCursor SnapshotReader::query(const std::string &text)
+{
+    refresh();
+    return db.query(text);
+}
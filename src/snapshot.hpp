@@ -0,0 +1,77 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "data_manager.hpp"
+
+// 一个已提交的数据库版本：发布时各表的快照（见 Table::snapshot）和提交时间戳，发布后不再修改
+struct DatabaseVersion
+{
+    uint64_t timestamp = 0;
+    std::unordered_map<std::string, Table> tables;
+};
+
+// 类 SnapshotSource 发布一个数据库最新提交的版本，并按纪元（epoch）回收旧版本：
+// 读者取版本之前在自己的槽位中记下当前纪元，取完清除；写者换入新版本后把旧版本连同当时的纪元放入待回收列表，
+// 等到所有读者记下的纪元都比它新时才释放。读者取版本不加锁，写者发布也从不等待读者
+class SnapshotSource
+{
+public:
+    static const size_t MAX_READERS = 64;
+
+    SnapshotSource();
+    ~SnapshotSource();
+    SnapshotSource(const SnapshotSource &) = delete;
+    SnapshotSource &operator=(const SnapshotSource &) = delete;
+
+    // 以下由写者调用：函数 publish 换入新版本并回收已经没有读者的旧版本
+    void publish(std::unique_ptr<DatabaseVersion> version);
+    // 以下由读者调用：函数 acquireSlot 为读者分配槽位，槽位用完时返回 -1
+    int acquireSlot();
+    void releaseSlot(int slot);
+    // 函数 pin 记下当前纪元后返回最新版本，版本在同一槽位 unpin 之前不会被释放
+    const DatabaseVersion *pin(int slot);
+    void unpin(int slot);
+
+private:
+    std::atomic<DatabaseVersion *> current{nullptr};
+    std::atomic<uint64_t> epoch{1};
+    std::atomic<uint64_t> pinned[MAX_READERS]; // 读者正在取版本时为它记下的纪元，0 表示没有在取
+    std::atomic<bool> used[MAX_READERS];
+    std::vector<std::pair<uint64_t, std::unique_ptr<DatabaseVersion>>> retired; // 只由写者访问
+
+    void reclaim();
+};
+
+// 类 SnapshotReader 是数据库上的只读会话，由 MiniDB::openReader 打开。每条语句开始时取得最新提交的版本，
+// 在这个快照上执行，与写者所在的线程并发运行，双方互不阻塞。读者只执行查询（SELECT、连接、聚合，以及 PREPARE、EXECUTE 和 SET），
+// 快照中没有索引，查询都是全表扫描。一个读者同一时间只能由一个线程使用；query 返回的游标在同一读者执行下一条语句之前有效
+class SnapshotReader
+{
+public:
+    SnapshotReader(std::shared_ptr<SnapshotSource> versions, int readerSlot, const std::string &databaseName);
+    ~SnapshotReader();
+    SnapshotReader(const SnapshotReader &) = delete;
+    SnapshotReader &operator=(const SnapshotReader &) = delete;
+
+    ResultCursor query(const std::string &text);
+    // 函数 snapshotTimestamp 返回最近一条语句所读取版本的提交时间戳
+    uint64_t snapshotTimestamp() const { return timestamp; }
+
+private:
+    std::shared_ptr<SnapshotSource> source;
+    int slot;
+    std::string name;
+    uint64_t timestamp = 0;
+    MiniDB db;
+
+    void refresh();
+};
+
+#endif // SNAPSHOT_HPP
@@ -0,0 +1,290 @@
+#include "sort.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+void RowSorter::setup(const std::vector<SortKey> &sortKeys, size_t memoryBudget, uint64_t itemLimit)
+{
+    clear();
+    keys = sortKeys;
+    limit = itemLimit;
+    budgetEntries = std::max<size_t>(memoryBudget / sizeof(Entry), 1024);
+    topK = limit <= budgetEntries;
+    ranks.assign(keys.size(), {});
+    for (size_t k = 0; k < keys.size(); ++k)
+    {
+        const ColumnData &column = *keys[k].column;
+        if (!column.isDictionary())
+            continue;
+        // 字典项按去掉引号后的文本排好序，逐行只比较名次；文本相同的字典项名次相同
+        std::vector<uint32_t> codes(column.dictionarySize());
+        for (size_t code = 0; code < codes.size(); ++code)
+            codes[code] = static_cast<uint32_t>(code);
+        std::sort(codes.begin(), codes.end(), [&](uint32_t first, uint32_t second)
+                  { return stripQuotes(column.dictionaryText(first)) < stripQuotes(column.dictionaryText(second)); });
+        std::vector<uint32_t> &rank = ranks[k];
+        rank.resize(codes.size());
+        for (size_t i = 0; i < codes.size(); ++i)
+        {
+            bool same = i > 0 && stripQuotes(column.dictionaryText(codes[i])) == stripQuotes(column.dictionaryText(codes[i - 1]));
+            rank[codes[i]] = same ? rank[codes[i - 1]] : static_cast<uint32_t>(i);
+        }
+    }
+}
+
+uint64_t RowSorter::prefixOf(size_t k, size_t item) const
+{
+    const SortKey &key = keys[k];
+    const ColumnData &column = *key.column;
+    size_t row = rowOf(key, item);
+    uint64_t prefix = 0;
+    if (column.getType() == ColumnType::INTEGER)
+        prefix = static_cast<uint64_t>(column.intAt(row)) ^ (uint64_t(1) << 63);
+    else if (column.getType() == ColumnType::FLOAT)
+    {
+        // 负数取反、非负数置符号位后，按无符号整数比较与按浮点数比较的顺序相同
+        double value = column.floatAt(row);
+        if (value == 0)
+            value = 0;
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        prefix = (bits >> 63) ? ~bits : bits | (uint64_t(1) << 63);
+    }
+    else if (column.isDictionary())
+        prefix = ranks[k][column.codeAt(row)];
+    else
+    {
+        std::string_view text = stripQuotes(column.textAt(row));
+        for (size_t i = 0; i < 8; ++i)
+            prefix = prefix << 8 | (i < text.size() ? static_cast<unsigned char>(text[i]) : 0);
+    }
+    return key.descending ? ~prefix : prefix;
+}
+
+int RowSorter::compareKey(size_t k, size_t first, size_t second) const
+{
+    const SortKey &key = keys[k];
+    const ColumnData &column = *key.column;
+    size_t row1 = rowOf(key, first);
+    size_t row2 = rowOf(key, second);
+    int result;
+    if (column.getType() == ColumnType::INTEGER)
+        result = (column.intAt(row1) > column.intAt(row2)) - (column.intAt(row1) < column.intAt(row2));
+    else if (column.getType() == ColumnType::FLOAT)
+        result = (column.floatAt(row1) > column.floatAt(row2)) - (column.floatAt(row1) < column.floatAt(row2));
+    else if (column.isDictionary())
+    {
+        uint32_t rank1 = ranks[k][column.codeAt(row1)];
+        uint32_t rank2 = ranks[k][column.codeAt(row2)];
+        result = (rank1 > rank2) - (rank1 < rank2);
+    }
+    else
+    {
+        int compared = stripQuotes(column.textAt(row1)).compare(stripQuotes(column.textAt(row2)));
+        result = (compared > 0) - (compared < 0);
+    }
+    return key.descending ? -result : result;
+}
+
+bool RowSorter::lessFrom(size_t k, size_t first, size_t second) const
+{
+    for (; k < keys.size(); ++k)
+    {
+        int result = compareKey(k, first, second);
+        if (result != 0)
+            return result < 0;
+    }
+    return first < second;
+}
+
+bool RowSorter::less(const Entry &first, const Entry &second) const
+{
+    if (first.prefix != second.prefix)
+        return first.prefix < second.prefix;
+    return lessFrom(exactPrefix(0) ? 1 : 0, first.item, second.item);
+}
+
+void RowSorter::sortByPrefix(std::vector<Entry>::iterator begin, std::vector<Entry>::iterator end)
+{
+    std::sort(begin, end, [](const Entry &first, const Entry &second)
+              { return first.prefix < second.prefix || (first.prefix == second.prefix && first.item < second.item); });
+}
+
+void RowSorter::sortTies(std::vector<Entry>::iterator begin, std::vector<Entry>::iterator end, size_t k)
+{
+    // 前缀相同的条目已经相邻并按条目排好；第 k 个键的前缀是精确的时，算出下一个键的前缀后同样处理，
+    // 每一层只为每个条目读一次列。普通 TEXT 的前缀相同时才逐对比较完整的值
+    for (auto run = begin; run != end;)
+    {
+        auto runEnd = run + 1;
+        while (runEnd != end && runEnd->prefix == run->prefix)
+            ++runEnd;
+        if (runEnd - run > 1)
+        {
+            if (!exactPrefix(k))
+            {
+                std::sort(run, runEnd, [this, k](const Entry &first, const Entry &second)
+                          { return lessFrom(k, first.item, second.item); });
+            }
+            else if (k + 1 < keys.size())
+            {
+                std::vector<Entry> ties(run, runEnd);
+                for (Entry &entry : ties)
+                    entry.prefix = prefixOf(k + 1, entry.item);
+                sortByPrefix(ties.begin(), ties.end());
+                sortTies(ties.begin(), ties.end(), k + 1);
+                for (size_t i = 0; i < ties.size(); ++i)
+                    run[i].item = ties[i].item;
+            }
+        }
+        run = runEnd;
+    }
+}
+
+void RowSorter::sortEntries()
+{
+    // 先只按第一个键的前缀和条目排序，比较时不读取列，再处理前缀相同的条目
+    sortByPrefix(entries.begin(), entries.end());
+    sortTies(entries.begin(), entries.end(), 0);
+}
+
+void RowSorter::add(size_t item)
+{
+    Entry entry{prefixOf(0, item), item};
+    auto entryLess = [this](const Entry &first, const Entry &second)
+    { return less(first, second); };
+    if (topK)
+    {
+        // 堆顶是目前保留的条目中最大的一个，新条目比它小时才替换
+        if (entries.size() < limit)
+        {
+            entries.push_back(entry);
+            std::push_heap(entries.begin(), entries.end(), entryLess);
+        }
+        else if (limit > 0 && less(entry, entries.front()))
+        {
+            std::pop_heap(entries.begin(), entries.end(), entryLess);
+            entries.back() = entry;
+            std::push_heap(entries.begin(), entries.end(), entryLess);
+        }
+        return;
+    }
+    entries.push_back(entry);
+    if (entries.size() >= budgetEntries && !spillRun())
+    {
+        std::cerr << "Warning: Failed to spill sort runs, sorting in memory." << std::endl;
+        budgetEntries = SIZE_MAX;
+    }
+}
+
+bool RowSorter::spillRun()
+{
+    std::unique_ptr<std::FILE, FileCloser> file(std::tmpfile());
+    if (!file)
+        return false;
+    sortEntries();
+    if (std::fwrite(entries.data(), sizeof(Entry), entries.size(), file.get()) != entries.size() || std::fflush(file.get()) != 0)
+        return false;
+    std::rewind(file.get());
+    Run run;
+    run.file = std::move(file);
+    run.remaining = entries.size();
+    runs.push_back(std::move(run));
+    entries.clear();
+    return true;
+}
+
+bool RowSorter::fillRun(Run &run)
+{
+    run.position = 0;
+    run.buffer.clear();
+    if (!run.file || run.remaining == 0)
+        return false;
+    size_t count = static_cast<size_t>(std::min<uint64_t>(runBuffer, run.remaining));
+    run.buffer.resize(count);
+    if (std::fread(run.buffer.data(), sizeof(Entry), count, run.file.get()) != count)
+    {
+        std::cerr << "Warning: Failed to read a sort run." << std::endl;
+        run.buffer.clear();
+        run.remaining = 0;
+        return false;
+    }
+    run.remaining -= count;
+    return true;
+}
+
+void RowSorter::finish()
+{
+    auto entryLess = [this](const Entry &first, const Entry &second)
+    { return less(first, second); };
+    position = 0;
+    if (topK)
+    {
+        std::sort_heap(entries.begin(), entries.end(), entryLess);
+        return;
+    }
+    if (runs.empty())
+    {
+        sortEntries();
+        return;
+    }
+    // 最后一段也写入临时文件，归并时内存中只有各段的读缓冲区；写入失败时这一段留在内存中参与归并
+    Run last;
+    if (!entries.empty() && !spillRun())
+    {
+        sortEntries();
+        last.buffer.swap(entries);
+    }
+    std::vector<Entry>().swap(entries);
+    runBuffer = std::max<size_t>(budgetEntries / runs.size(), 256);
+    for (Run &run : runs)
+        fillRun(run);
+    if (!last.buffer.empty())
+        runs.push_back(std::move(last));
+
+    auto runGreater = [this](size_t first, size_t second)
+    { return less(runs[second].buffer[runs[second].position], runs[first].buffer[runs[first].position]); };
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        if (!runs[i].buffer.empty())
+        {
+            mergeHeap.push_back(i);
+            std::push_heap(mergeHeap.begin(), mergeHeap.end(), runGreater);
+        }
+    }
+}
+
+bool RowSorter::next(std::vector<size_t> &out, size_t maxItems)
+{
+    size_t count = 0;
+    if (runs.empty())
+    {
+        for (; position < entries.size() && count < maxItems; ++count)
+            out.push_back(entries[position++].item);
+        return count > 0;
+    }
+    auto runGreater = [this](size_t first, size_t second)
+    { return less(runs[second].buffer[runs[second].position], runs[first].buffer[runs[first].position]); };
+    for (; count < maxItems && !mergeHeap.empty(); ++count)
+    {
+        std::pop_heap(mergeHeap.begin(), mergeHeap.end(), runGreater);
+        Run &run = runs[mergeHeap.back()];
+        out.push_back(run.buffer[run.position++].item);
+        if (run.position < run.buffer.size() || fillRun(run))
+            std::push_heap(mergeHeap.begin(), mergeHeap.end(), runGreater);
+        else
+            mergeHeap.pop_back();
+    }
+    return count > 0;
+}
+
+void RowSorter::clear()
+{
+    keys.clear();
+    ranks.clear();
+    std::vector<Entry>().swap(entries);
+    position = 0;
+    runs.clear();
+    mergeHeap.clear();
+}
@@ -0,0 +1,86 @@
+#ifndef SORT_HPP
+#define SORT_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "column_store.hpp"
+
+// ORDER BY 的一个排序键。被排序的条目是行号时 rows 为空；条目是结果行下标时 rows 把下标映射为列中的行号
+struct SortKey
+{
+    const ColumnData *column;
+    const std::vector<size_t> *rows = nullptr;
+    bool descending = false;
+};
+
+// 类 RowSorter 按 ORDER BY 的排序键给条目排序，取出时按顺序分批交出。比较时直接读取列中的类型化值，
+// 各键编码成保序的 64 位前缀（整数、浮点数、字典编码的 TEXT 的字典序名次，或普通 TEXT 的前 8 个字节），
+// 排序先只比较第一个键的前缀，前缀相同的条目再按下一个键的前缀排序，多数比较不读取列；键相同的条目按加入的先后排列，与稳定排序相同。
+// 只需要前 limit 个条目且放得进内存时用大小为 limit 的堆（top-k），其余条目加入时就被丢弃；
+// 否则在内存中排序，条目超过内存预算时把排好序的一段写入临时文件，最后多路归并各段
+class RowSorter
+{
+public:
+    RowSorter() = default;
+    RowSorter(RowSorter &&) = default;
+    RowSorter &operator=(RowSorter &&) = default;
+
+    // 函数 setup 准备一次排序：memoryBudget 为条目缓冲区的字节数上限，limit 为需要的条目个数（没有 LIMIT 时为最大值）
+    void setup(const std::vector<SortKey> &sortKeys, size_t memoryBudget, uint64_t limit);
+    void add(size_t item);
+    // 函数 finish 在全部条目加入后调用，之后才能用 next 取出
+    void finish();
+    // 函数 next 按顺序取出至多 maxItems 个条目追加到 out，全部取完时返回 false
+    bool next(std::vector<size_t> &out, size_t maxItems);
+    void clear();
+    // 函数 runCount 返回写入临时文件的有序段个数，0 表示全部在内存中排序
+    size_t runCount() const { return runs.size(); }
+
+private:
+    struct Entry
+    {
+        uint64_t prefix;
+        uint64_t item;
+    };
+    struct FileCloser
+    {
+        void operator()(std::FILE *file) const { std::fclose(file); }
+    };
+    // 临时文件中的一个有序段，归并时分块读入
+    struct Run
+    {
+        std::unique_ptr<std::FILE, FileCloser> file;
+        uint64_t remaining = 0;
+        std::vector<Entry> buffer;
+        size_t position = 0;
+    };
+
+    std::vector<SortKey> keys;
+    std::vector<std::vector<uint32_t>> ranks; // 与 keys 对应：字典编码的 TEXT 列中每个编码的名次，其他列为空
+    size_t budgetEntries = 0;
+    uint64_t limit = UINT64_MAX;
+    bool topK = false;
+    std::vector<Entry> entries; // top-k 的堆、内存中的缓冲区，或内存排序的结果
+    size_t position = 0;
+    std::vector<Run> runs;
+    size_t runBuffer = 0;          // 归并时每段的读缓冲区能容纳的条目数
+    std::vector<size_t> mergeHeap; // 归并时各段当前条目组成的堆，保存段的下标
+
+    size_t rowOf(const SortKey &key, size_t item) const { return key.rows ? (*key.rows)[item] : item; }
+    // 函数 exactPrefix 判断第 k 个键的前缀是否完全决定这个键的顺序：只有普通 TEXT 的前缀只是前 8 个字节
+    bool exactPrefix(size_t k) const { return keys[k].column->getType() != ColumnType::TEXT || keys[k].column->isDictionary(); }
+    uint64_t prefixOf(size_t k, size_t item) const;
+    int compareKey(size_t k, size_t first, size_t second) const;
+    // 函数 lessFrom 从第 k 个键开始比较两个条目，所有键都相同时按条目本身比较
+    bool lessFrom(size_t k, size_t first, size_t second) const;
+    bool less(const Entry &first, const Entry &second) const;
+    static void sortByPrefix(std::vector<Entry>::iterator begin, std::vector<Entry>::iterator end);
+    void sortTies(std::vector<Entry>::iterator begin, std::vector<Entry>::iterator end, size_t k);
+    void sortEntries();
+    bool spillRun();
+    bool fillRun(Run &run);
+};
+
+#endif // SORT_HPP
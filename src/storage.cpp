@@ -0,0 +1,370 @@
+#include "storage.hpp"
+#include "data_manager.hpp"
+#include <cstring>
+#include <memory>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    const char FILE_MAGIC[8] = {'M', 'I', 'N', 'I', 'D', 'B', 'P', 'G'};
+    // 版本 2 在目录中为每列增加了 TEXT 编码；版本 1 的文件仍可读取，其中的 TEXT 列都是 PLAIN
+    const uint32_t FILE_VERSION = 2;
+
+    // 按 8 字节一组计算 CRC32（slicing-by-8）：entries[k][b] 是字节 b 之后再跟 k 个零字节时的余数
+    struct Crc32Table
+    {
+        uint32_t entries[8][256];
+        Crc32Table()
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t value = i;
+                for (int bit = 0; bit < 8; ++bit)
+                    value = (value & 1) ? (value >> 1) ^ 0xEDB88320u : value >> 1;
+                entries[0][i] = value;
+            }
+            for (int k = 1; k < 8; ++k)
+            {
+                for (uint32_t i = 0; i < 256; ++i)
+                    entries[k][i] = (entries[k - 1][i] >> 8) ^ entries[0][entries[k - 1][i] & 0xFF];
+            }
+        }
+    };
+
+    uint64_t pagesFor(uint64_t length)
+    {
+        return (length + PAGE_SIZE - 1) / PAGE_SIZE;
+    }
+
+    bool writeAt(std::FILE *file, uint64_t page, std::string_view bytes)
+    {
+        if (std::fseek(file, static_cast<long>(page * PAGE_SIZE), SEEK_SET) != 0)
+            return false;
+        if (!bytes.empty() && std::fwrite(bytes.data(), 1, bytes.size(), file) != bytes.size())
+            return false;
+        // 补齐最后一页
+        static const char zeros[PAGE_SIZE] = {};
+        size_t padding = pagesFor(bytes.size()) * PAGE_SIZE - bytes.size();
+        return padding == 0 || std::fwrite(zeros, 1, padding, file) == padding;
+    }
+}
+
+uint32_t crc32(const void *data, size_t size)
+{
+    static const Crc32Table table;
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    const auto &t = table.entries;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (; size >= 8; bytes += 8, size -= 8)
+    {
+        uint32_t low, high;
+        std::memcpy(&low, bytes, sizeof(low));
+        std::memcpy(&high, bytes + 4, sizeof(high));
+        low ^= crc;
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+              t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+    }
+    for (size_t i = 0; i < size; ++i)
+        crc = t[0][(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+PageWriter::~PageWriter()
+{
+    if (file)
+    {
+        std::fclose(file);
+        std::remove(tempPath.c_str());
+    }
+}
+
+bool PageWriter::create(const std::string &path)
+{
+    finalPath = path;
+    tempPath = path + ".tmp";
+    file = std::fopen(tempPath.c_str(), "wb");
+    pageCount = 1;
+    return file != nullptr;
+}
+
+bool PageWriter::appendSegment(std::string_view bytes, SegmentRef &segment)
+{
+    segment.firstPage = pageCount;
+    segment.length = bytes.size();
+    segment.checksum = crc32(bytes.data(), bytes.size());
+    if (!writeAt(file, pageCount, bytes))
+        return false;
+    pageCount += pagesFor(bytes.size());
+    return true;
+}
+
+bool PageWriter::finish(std::string_view catalog)
+{
+    SegmentRef catalogSegment;
+    if (!appendSegment(catalog, catalogSegment))
+        return false;
+
+    ByteWriter header;
+    header.bytes.append(FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.put(FILE_VERSION);
+    header.put(static_cast<uint32_t>(PAGE_SIZE));
+    header.put(pageCount);
+    header.putSegment(catalogSegment);
+    header.put(crc32(header.bytes.data(), header.bytes.size()));
+    if (!writeAt(file, 0, header.bytes))
+        return false;
+
+    bool ok = std::fflush(file) == 0;
+    ok = std::fclose(file) == 0 && ok;
+    file = nullptr;
+    if (!ok || std::rename(tempPath.c_str(), finalPath.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+PageReader::~PageReader()
+{
+    if (data)
+        ::munmap(const_cast<char *>(data), mappedLength);
+}
+
+bool PageReader::open(const std::string &path, std::string &errorMessage)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        errorMessage = "Failed to open file for loading.";
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(PAGE_SIZE))
+    {
+        ::close(fd);
+        errorMessage = "Not a MiniDB database file: " + path;
+        return false;
+    }
+    void *mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        errorMessage = "Failed to map " + path + ".";
+        return false;
+    }
+    data = static_cast<const char *>(mapping);
+    mappedLength = static_cast<size_t>(info.st_size);
+    if (std::memcmp(data, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    {
+        errorMessage = "Not a MiniDB database file: " + path;
+        return false;
+    }
+
+    ByteReader header(std::string_view(data + sizeof(FILE_MAGIC), PAGE_SIZE - sizeof(FILE_MAGIC)));
+    uint32_t version = header.get<uint32_t>();
+    uint32_t pageSize = header.get<uint32_t>();
+    fileVersion = version;
+    pageCount = header.get<uint64_t>();
+    SegmentRef catalogSegment = header.getSegment();
+    size_t headerLength = sizeof(FILE_MAGIC) + 2 * sizeof(uint32_t) + sizeof(uint64_t) + 2 * sizeof(uint64_t) + sizeof(uint32_t);
+    uint32_t headerChecksum = header.get<uint32_t>();
+    if (headerChecksum != crc32(data, headerLength))
+    {
+        errorMessage = "Corrupted database header in " + path;
+        return false;
+    }
+    if (version < 1 || version > FILE_VERSION || pageSize != PAGE_SIZE)
+    {
+        errorMessage = "Unsupported database file version in " + path;
+        return false;
+    }
+    if (pageCount > mappedLength / PAGE_SIZE)
+    {
+        errorMessage = "Truncated database file " + path;
+        return false;
+    }
+    return readSegment(catalogSegment, catalog, errorMessage);
+}
+
+bool PageReader::readSegment(const SegmentRef &segment, std::string_view &out, std::string &errorMessage) const
+{
+    uint64_t pages = pagesFor(segment.length);
+    if (segment.firstPage == 0 || segment.firstPage > pageCount || pages > pageCount - segment.firstPage)
+    {
+        errorMessage = "Database segment out of range.";
+        return false;
+    }
+    out = std::string_view(data + segment.firstPage * PAGE_SIZE, segment.length);
+    if (crc32(out.data(), out.size()) != segment.checksum)
+    {
+        errorMessage = "Checksum mismatch in database segment at page " + std::to_string(segment.firstPage) + ".";
+        return false;
+    }
+    return true;
+}
+
+std::string databaseFileName(const std::string &DBname)
+{
+    return DBname + ".mdb";
+}
+
+bool writeDatabaseFile(const Database &db, std::string &errorMessage)
+{
+    PageWriter writer;
+    if (!writer.create(databaseFileName(db.name)))
+    {
+        errorMessage = "Failed to open file for saving.";
+        return false;
+    }
+
+    ByteWriter catalog;
+    std::string bytes;
+    catalog.put(static_cast<uint32_t>(db.tables.size()));
+    for (const auto &tablePair : db.tables)
+    {
+        const Table &table = tablePair.second;
+        catalog.putString(table.name);
+        catalog.put(static_cast<uint64_t>(table.rowCount));
+        catalog.put(static_cast<uint32_t>(table.columns.size()));
+        // 尚未读入内存的表直接从旧文件的映射中复制各段
+        const TableSource *source = table.source.get();
+        std::string_view raw;
+        for (size_t i = 0; i < table.columns.size(); ++i)
+        {
+            SegmentRef segment;
+            bytes.clear();
+            if (source)
+            {
+                if (!source->file->readSegment(source->columns[i], raw, errorMessage))
+                    return false;
+            }
+            else
+            {
+                table.data[i].serialize(bytes);
+                raw = bytes;
+            }
+            if (!writer.appendSegment(raw, segment))
+            {
+                errorMessage = "Failed to write table " + table.name + ".";
+                return false;
+            }
+            catalog.putString(table.columns[i].name);
+            catalog.put(static_cast<uint8_t>(table.columns[i].type));
+            catalog.put(static_cast<uint8_t>(source ? source->encodings[i] : table.data[i].getEncoding()));
+            catalog.putSegment(segment);
+        }
+
+        // 哈希索引只保存定义，加载时重建；有序索引连同排好序的条目一起保存
+        catalog.put(static_cast<uint32_t>(table.indexes.size() + table.orderedIndexes.size()));
+        for (const auto &index : table.indexes)
+        {
+            catalog.putString(index.name);
+            catalog.putString(index.columnName);
+            catalog.put(static_cast<uint8_t>(0));
+            catalog.putSegment(SegmentRef());
+        }
+        for (size_t i = 0; i < table.orderedIndexes.size(); ++i)
+        {
+            const OrderedIndex &index = table.orderedIndexes[i];
+            SegmentRef segment;
+            bytes.clear();
+            if (!source)
+            {
+                index.save(bytes);
+                raw = bytes;
+            }
+            else if (!source->file->readSegment(source->orderedIndexes[i], raw, errorMessage))
+            {
+                // 旧的索引段已损坏时写一个空段，下次读入表时会按表数据重建
+                raw = std::string_view();
+            }
+            if (!writer.appendSegment(raw, segment))
+            {
+                errorMessage = "Failed to write index " + index.name + ".";
+                return false;
+            }
+            catalog.putString(index.name);
+            catalog.putString(index.columnName);
+            catalog.put(static_cast<uint8_t>(1));
+            catalog.putSegment(segment);
+        }
+    }
+    catalog.put(db.checkpointLsn);
+    if (!writer.finish(catalog.bytes))
+    {
+        errorMessage = "Failed to save database " + db.name + ".";
+        return false;
+    }
+    return true;
+}
+
+bool readDatabaseFile(const std::string &DBname, Database &db, std::string &errorMessage)
+{
+    auto reader = std::make_shared<PageReader>();
+    if (!reader->open(databaseFileName(DBname), errorMessage))
+        return false;
+
+    ByteReader catalog(reader->getCatalog());
+    uint32_t tableCount = catalog.get<uint32_t>();
+    for (uint32_t t = 0; t < tableCount && catalog.ok(); ++t)
+    {
+        Table table(catalog.getString());
+        table.rowCount = catalog.get<uint64_t>();
+        auto source = std::make_shared<TableSource>();
+        source->file = reader;
+        uint32_t columnCount = catalog.get<uint32_t>();
+        for (uint32_t c = 0; c < columnCount && catalog.ok(); ++c)
+        {
+            std::string columnName = catalog.getString();
+            uint8_t typeCode = catalog.get<uint8_t>();
+            uint8_t encodingCode = reader->getVersion() >= 2 ? catalog.get<uint8_t>() : 0;
+            SegmentRef segment = catalog.getSegment();
+            if (!catalog.ok() || typeCode > static_cast<uint8_t>(ColumnType::TEXT) || encodingCode > static_cast<uint8_t>(TextEncoding::DICTIONARY))
+            {
+                errorMessage = "Corrupted catalog in " + databaseFileName(DBname) + ".";
+                return false;
+            }
+            table.addColumns(columnName, static_cast<ColumnType>(typeCode));
+            source->columns.push_back(segment);
+            source->encodings.push_back(static_cast<TextEncoding>(encodingCode));
+        }
+
+        uint32_t indexCount = catalog.get<uint32_t>();
+        for (uint32_t i = 0; i < indexCount && catalog.ok(); ++i)
+        {
+            std::string indexName = catalog.getString();
+            std::string columnName = catalog.getString();
+            bool ordered = catalog.get<uint8_t>() != 0;
+            SegmentRef segment = catalog.getSegment();
+            int column = table.findColumn(columnName);
+            if (!catalog.ok() || column < 0)
+            {
+                errorMessage = "Corrupted catalog in " + databaseFileName(DBname) + ".";
+                return false;
+            }
+            if (!ordered)
+            {
+                table.indexes.emplace_back(indexName, columnName, static_cast<size_t>(column));
+                continue;
+            }
+            table.orderedIndexes.emplace_back(indexName, columnName, static_cast<size_t>(column), table.columns[column].type);
+            source->orderedIndexes.push_back(segment);
+        }
+        if (!catalog.ok())
+            break;
+        table.source = source;
+        std::string tableName = table.name;
+        db.tables[tableName] = std::move(table);
+    }
+    db.checkpointLsn = catalog.get<uint64_t>();
+    if (!catalog.ok() || !catalog.atEnd())
+    {
+        errorMessage = "Corrupted catalog in " + databaseFileName(DBname) + ".";
+        return false;
+    }
+    return true;
+}
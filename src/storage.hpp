@@ -0,0 +1,147 @@
+#ifndef STORAGE_HPP
+#define STORAGE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+class Database;
+
+// 数据库文件 <库名>.mdb 由固定大小的页组成：
+//   第 0 页是文件头：魔数、版本、页大小、总页数、目录段的位置与校验和，以及文件头自身的校验和；
+//   之后依次是每个表的列段和有序索引段，每段从页边界开始并占用连续的页；
+//   最后是目录段，记录每个表的表名、行数、列定义（版本 2 起包括 TEXT 列的编码）、索引定义以及各段的位置、长度和 CRC32，
+//   末尾是已并入本文件的最后一条日志记录的序号（检查点 LSN）。
+// 所有整数按本机字节序（小端）保存。
+const size_t PAGE_SIZE = 4096;
+
+uint32_t crc32(const void *data, size_t size);
+
+// 文件中一段连续的页
+struct SegmentRef
+{
+    uint64_t firstPage = 0;
+    uint64_t length = 0; // 有效字节数，最后一页的剩余部分补零
+    uint32_t checksum = 0;
+};
+
+// 目录、文件头和日志记录的编码：定长整数按本机字节序，字符串为 32 位长度加内容
+class ByteWriter
+{
+public:
+    std::string bytes;
+
+    template <typename T>
+    void put(T value) { bytes.append(reinterpret_cast<const char *>(&value), sizeof(value)); }
+    void putString(const std::string &value)
+    {
+        put(static_cast<uint32_t>(value.size()));
+        bytes.append(value);
+    }
+    void putSegment(const SegmentRef &segment)
+    {
+        put(segment.firstPage);
+        put(segment.length);
+        put(segment.checksum);
+    }
+};
+
+class ByteReader
+{
+public:
+    explicit ByteReader(std::string_view data) : rest(data) {}
+    bool ok() const { return good; }
+    bool atEnd() const { return rest.empty(); }
+
+    template <typename T>
+    T get()
+    {
+        T value{};
+        if (rest.size() < sizeof(value))
+        {
+            good = false;
+            rest = {};
+            return value;
+        }
+        std::memcpy(&value, rest.data(), sizeof(value));
+        rest.remove_prefix(sizeof(value));
+        return value;
+    }
+    std::string getString()
+    {
+        uint32_t size = get<uint32_t>();
+        if (rest.size() < size)
+        {
+            good = false;
+            rest = {};
+            return std::string();
+        }
+        std::string value(rest.substr(0, size));
+        rest.remove_prefix(size);
+        return value;
+    }
+    SegmentRef getSegment()
+    {
+        SegmentRef segment;
+        segment.firstPage = get<uint64_t>();
+        segment.length = get<uint64_t>();
+        segment.checksum = get<uint32_t>();
+        return segment;
+    }
+
+private:
+    std::string_view rest;
+    bool good = true;
+};
+
+// 类 PageWriter 按页写出一个新的数据库文件：先写到临时文件，全部写完后再替换原文件，
+// 因此中途失败不会破坏已有的数据库
+class PageWriter
+{
+public:
+    ~PageWriter();
+    bool create(const std::string &path);
+    bool appendSegment(std::string_view bytes, SegmentRef &segment);
+    // 函数 finish 写出目录段和文件头，并把临时文件改名为正式文件
+    bool finish(std::string_view catalog);
+
+private:
+    std::string finalPath;
+    std::string tempPath;
+    std::FILE *file = nullptr;
+    uint64_t pageCount = 1; // 第 0 页留给文件头
+};
+
+// 类 PageReader 把数据库文件整体映射到内存（mmap），打开时只校验文件头并定位目录段；
+// 各段在第一次被读取时才校验并访问，未被访问的页不会读入内存
+class PageReader
+{
+public:
+    PageReader() = default;
+    PageReader(const PageReader &) = delete;
+    PageReader &operator=(const PageReader &) = delete;
+    ~PageReader();
+    bool open(const std::string &path, std::string &errorMessage);
+    std::string_view getCatalog() const { return catalog; }
+    uint32_t getVersion() const { return fileVersion; }
+    // 函数 readSegment 返回段在映射中的字节（不复制），越界或校验失败时返回 false
+    bool readSegment(const SegmentRef &segment, std::string_view &out, std::string &errorMessage) const;
+
+private:
+    const char *data = nullptr;
+    size_t mappedLength = 0;
+    uint64_t pageCount = 0;
+    uint32_t fileVersion = 0;
+    std::string_view catalog;
+};
+
+std::string databaseFileName(const std::string &DBname);
+// 函数 writeDatabaseFile 把整个数据库写成页式二进制文件
+bool writeDatabaseFile(const Database &db, std::string &errorMessage);
+// 函数 readDatabaseFile 打开页式二进制文件并只读入目录：表结构和索引定义立即可用，
+// 表数据留在映射中，由 Table::materialize 在第一次访问时读入；目录校验失败时返回 false 并给出原因
+bool readDatabaseFile(const std::string &DBname, Database &db, std::string &errorMessage);
+
+#endif // STORAGE_HPP
@@ -0,0 +1,92 @@
+#include "thread_pool.hpp"
+
+void ThreadPool::setThreads(size_t count)
+{
+    stop();
+    threadCount = count == 0 ? 1 : count;
+}
+
+void ThreadPool::run(size_t count, const std::function<void(size_t)> &task)
+{
+    if (threadCount <= 1 || count <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+    if (workers.empty())
+    {
+        stopping = false;
+        for (size_t i = 1; i < threadCount; ++i)
+        {
+            workers.emplace_back(&ThreadPool::workerLoop, this, generation);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &task;
+        jobSize = count;
+        nextMorsel = 0;
+        active = workers.size();
+        ++generation;
+    }
+    wake.notify_all();
+    work();
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]
+                  { return active == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::stop()
+{
+    if (workers.empty())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+}
+
+// 函数 workerLoop 是工作线程的主循环，seen 为线程创建时已经提交过的作业编号
+void ThreadPool::workerLoop(uint64_t seen)
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]
+                      { return stopping || generation != seen; });
+            if (stopping)
+            {
+                return;
+            }
+            seen = generation;
+        }
+        work();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--active == 0)
+        {
+            finished.notify_one();
+        }
+    }
+}
+
+// 函数 work 反复领取下一个 morsel 并执行，直到作业的 morsel 全部被领完
+void ThreadPool::work()
+{
+    for (size_t morsel = nextMorsel++; morsel < jobSize; morsel = nextMorsel++)
+    {
+        (*job)(morsel);
+    }
+}
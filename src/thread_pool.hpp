@@ -0,0 +1,49 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 并行扫描时每个 morsel 包含的行数
+const size_t MORSEL_ROWS = 64 * 1024;
+
+// 类 ThreadPool 是并行扫描使用的一组常驻工作线程。run 把作业拆成若干个 morsel，工作线程和调用线程
+// 都从共享计数器上领取下一个 morsel，先做完的线程自然领得多，直到全部完成。线程在第一次并行执行时才创建
+class ThreadPool
+{
+public:
+    ThreadPool() = default;
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ~ThreadPool() { stop(); }
+
+    // 函数 setThreads 设置并行度（包括调用线程），为 1 时所有作业都在调用线程上执行
+    void setThreads(size_t count);
+    size_t threads() const { return threadCount; }
+    // 函数 run 并行执行 task(0) ... task(count - 1)，全部完成后返回；各个 task 之间不能相互依赖
+    void run(size_t count, const std::function<void(size_t)> &task);
+
+private:
+    size_t threadCount = 1;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    const std::function<void(size_t)> *job = nullptr;
+    size_t jobSize = 0;
+    std::atomic<size_t> nextMorsel{0};
+    size_t active = 0;       // 尚未做完当前作业的工作线程数
+    uint64_t generation = 0; // 每提交一个作业加一，工作线程据此发现新作业
+    bool stopping = false;
+
+    void stop();
+    void workerLoop(uint64_t seen);
+    void work();
+};
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,96 @@
+#include "transaction.hpp"
+#include "data_manager.hpp"
+
+namespace
+{
+    // 函数 restoreValue 把第 i 个旧值写回目标列的第 row 行
+    void restoreValue(ColumnData &target, const ColumnData &oldValues, size_t i, size_t row)
+    {
+        switch (target.getType())
+        {
+        case ColumnType::INTEGER:
+            target.setInt(row, oldValues.intAt(i));
+            break;
+        case ColumnType::FLOAT:
+            target.setFloat(row, oldValues.floatAt(i));
+            break;
+        default:
+            target.setText(row, oldValues.textAt(i));
+            break;
+        }
+    }
+}
+
+void undoChange(Database &db, UndoRecord &undo)
+{
+    if (undo.type == LogRecordType::CREATE_TABLE)
+    {
+        db.tables.erase(undo.table);
+        return;
+    }
+    if (undo.type == LogRecordType::DROP_TABLE)
+    {
+        db.tables[undo.table] = std::move(*undo.dropped);
+        return;
+    }
+    auto it = db.tables.find(undo.table);
+    if (it == db.tables.end())
+        return;
+    Table &table = it->second;
+    switch (undo.type)
+    {
+    case LogRecordType::INSERT:
+        // 撤销的行不少于保留的行时，截断后整体重建索引比逐行删除更快
+        if (table.rowCount - undo.firstRow >= undo.firstRow)
+        {
+            table.truncateRows(undo.firstRow);
+            table.rebuildIndexes();
+            break;
+        }
+        for (size_t row = undo.firstRow; row < table.rowCount; ++row)
+        {
+            for (auto &index : table.indexes)
+                index.eraseRow(table.data[index.column], row);
+            for (auto &index : table.orderedIndexes)
+                index.eraseRow(table.data[index.column], row);
+        }
+        table.truncateRows(undo.firstRow);
+        break;
+    case LogRecordType::UPDATE:
+    {
+        ColumnData &target = table.data[undo.column];
+        for (size_t i = 0; i < undo.rows.size(); ++i)
+        {
+            size_t row = undo.rows[i];
+            for (auto &index : table.indexes)
+            {
+                if (index.column == undo.column)
+                    index.eraseRow(target, row);
+            }
+            for (auto &index : table.orderedIndexes)
+            {
+                if (index.column == undo.column)
+                    index.eraseRow(target, row);
+            }
+            restoreValue(target, undo.oldValues, i, row);
+            for (auto &index : table.indexes)
+            {
+                if (index.column == undo.column)
+                    index.insertRow(target, row);
+            }
+            for (auto &index : table.orderedIndexes)
+            {
+                if (index.column == undo.column)
+                    index.insertRow(target, row);
+            }
+        }
+        break;
+    }
+    case LogRecordType::TOMBSTONE:
+        for (uint64_t row : undo.rows)
+            table.deleted.unmark(row);
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef TRANSACTION_HPP
+#define TRANSACTION_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "column_store.hpp"
+#include "wal.hpp"
+
+class Table;
+class Database;
+
+// 事务中一次修改的撤销记录，类型沿用日志记录的类型，只用到 CREATE_TABLE、DROP_TABLE、INSERT、UPDATE 和 TOMBSTONE
+struct UndoRecord
+{
+    LogRecordType type = LogRecordType::INSERT;
+    std::string table;
+    size_t firstRow = 0;            // INSERT：追加之前的行数
+    uint32_t column = 0;            // UPDATE：被修改的列
+    std::vector<uint64_t> rows;     // UPDATE/TOMBSTONE：行号
+    ColumnData oldValues;           // UPDATE：与 rows 一一对应的旧值
+    std::unique_ptr<Table> dropped; // DROP_TABLE：被删除的表，连同它的索引
+};
+
+// 一个 BEGIN 之后尚未结束的事务：修改照常作用在内存中的表上，日志记录攒到 COMMIT 时作为一帧写入，
+// ROLLBACK 按相反的顺序应用撤销记录，只涉及事务修改过的行
+struct Transaction
+{
+    bool active = false;
+    std::string database;        // BEGIN 时的当前数据库，事务中不能切换
+    std::vector<LogRecord> redo; // 提交时写入日志
+    std::vector<UndoRecord> undo;
+    bool checkpoint = false;     // 事务中有 COPY，提交时做检查点而不是写日志
+};
+
+// 函数 undoChange 在 db 上撤销一次修改；同一事务中之后的修改必须已经撤销
+void undoChange(Database &db, UndoRecord &undo);
+
+#endif // TRANSACTION_HPP
@@ -0,0 +1,353 @@
+#include "wal.hpp"
+#include "data_manager.hpp"
+#include "storage.hpp"
+#include <unistd.h>
+
+namespace
+{
+    const size_t FRAME_HEADER = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t);
+
+    void encode(const LogRecord &record, ByteWriter &out)
+    {
+        out.put(static_cast<uint8_t>(record.type));
+        out.putString(record.table);
+        switch (record.type)
+        {
+        case LogRecordType::CREATE_TABLE:
+            out.put(static_cast<uint32_t>(record.columns.size()));
+            for (const auto &column : record.columns)
+            {
+                out.putString(column.first);
+                out.put(static_cast<uint8_t>(column.second));
+            }
+            break;
+        case LogRecordType::INSERT:
+            out.put(static_cast<uint64_t>(record.newValues.size()));
+            for (const auto &values : record.newValues)
+                out.putString(values);
+            break;
+        case LogRecordType::UPDATE:
+            out.put(record.column);
+            out.put(static_cast<uint64_t>(record.rows.size()));
+            for (size_t i = 0; i < record.rows.size(); ++i)
+            {
+                out.put(record.rows[i]);
+                out.putString(record.newValues[i]);
+            }
+            break;
+        case LogRecordType::DELETE:
+        case LogRecordType::TOMBSTONE:
+            out.put(static_cast<uint64_t>(record.rows.size()));
+            for (uint64_t row : record.rows)
+                out.put(row);
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool decode(std::string_view payload, LogRecord &record)
+    {
+        ByteReader in(payload);
+        uint8_t type = in.get<uint8_t>();
+        if (type < static_cast<uint8_t>(LogRecordType::CREATE_TABLE) || type > static_cast<uint8_t>(LogRecordType::VACUUM))
+            return false;
+        record = LogRecord();
+        record.type = static_cast<LogRecordType>(type);
+        record.table = in.getString();
+        switch (record.type)
+        {
+        case LogRecordType::CREATE_TABLE:
+        {
+            uint32_t count = in.get<uint32_t>();
+            for (uint32_t i = 0; i < count && in.ok(); ++i)
+            {
+                std::string name = in.getString();
+                uint8_t columnType = in.get<uint8_t>();
+                if (columnType > static_cast<uint8_t>(ColumnType::TEXT))
+                    return false;
+                record.columns.emplace_back(name, static_cast<ColumnType>(columnType));
+            }
+            break;
+        }
+        case LogRecordType::INSERT:
+        {
+            uint64_t count = in.get<uint64_t>();
+            for (uint64_t i = 0; i < count && in.ok(); ++i)
+                record.newValues.push_back(in.getString());
+            break;
+        }
+        case LogRecordType::UPDATE:
+        {
+            record.column = in.get<uint32_t>();
+            uint64_t count = in.get<uint64_t>();
+            for (uint64_t i = 0; i < count && in.ok(); ++i)
+            {
+                record.rows.push_back(in.get<uint64_t>());
+                record.newValues.push_back(in.getString());
+            }
+            break;
+        }
+        case LogRecordType::DELETE:
+        case LogRecordType::TOMBSTONE:
+        {
+            uint64_t count = in.get<uint64_t>();
+            for (uint64_t i = 0; i < count && in.ok(); ++i)
+                record.rows.push_back(in.get<uint64_t>());
+            break;
+        }
+        default:
+            break;
+        }
+        return in.ok() && in.atEnd();
+    }
+
+    // 函数 decodeFrame 解码一帧的负载：普通帧是一条记录，事务帧是记录个数加上各条记录的负载
+    bool decodeFrame(std::string_view payload, std::vector<LogRecord> &records)
+    {
+        records.clear();
+        if (payload.empty() || static_cast<uint8_t>(payload[0]) != static_cast<uint8_t>(LogRecordType::TRANSACTION))
+        {
+            records.emplace_back();
+            return decode(payload, records.back());
+        }
+        ByteReader in(payload.substr(1));
+        uint64_t count = in.get<uint64_t>();
+        for (uint64_t i = 0; i < count && in.ok(); ++i)
+        {
+            std::string inner = in.getString();
+            records.emplace_back();
+            if (!in.ok() || !decode(inner, records.back()))
+                return false;
+        }
+        return in.ok() && in.atEnd();
+    }
+}
+
+bool WriteAheadLog::open(const std::string &logPath, uint64_t lastSequence)
+{
+    close();
+    path = logPath;
+    file = std::fopen(path.c_str(), "ab");
+    if (!file)
+        return false;
+    std::fseek(file, 0, SEEK_END);
+    long end = std::ftell(file);
+    size = end > 0 ? static_cast<uint64_t>(end) : 0;
+    lastLsn = lastSequence;
+    pending = 0;
+    return true;
+}
+
+void WriteAheadLog::close()
+{
+    if (!file)
+        return;
+    sync();
+    std::fclose(file);
+    file = nullptr;
+}
+
+bool WriteAheadLog::append(const LogRecord &record)
+{
+    if (!file)
+        return false;
+    ByteWriter payload;
+    encode(record, payload);
+    return appendFrame(payload.bytes);
+}
+
+bool WriteAheadLog::appendTransaction(const std::vector<LogRecord> &records)
+{
+    if (!file)
+        return false;
+    ByteWriter payload;
+    payload.put(static_cast<uint8_t>(LogRecordType::TRANSACTION));
+    payload.put(static_cast<uint64_t>(records.size()));
+    ByteWriter inner;
+    for (const LogRecord &record : records)
+    {
+        inner.bytes.clear();
+        encode(record, inner);
+        payload.putString(inner.bytes);
+    }
+    return appendFrame(payload.bytes);
+}
+
+bool WriteAheadLog::appendFrame(const std::string &payload)
+{
+    uint64_t lsn = lastLsn + 1;
+    ByteWriter frame;
+    frame.put(static_cast<uint32_t>(payload.size()));
+    frame.put(static_cast<uint32_t>(0)); // 校验和占位
+    frame.put(lsn);
+    frame.bytes += payload;
+    uint32_t checksum = crc32(frame.bytes.data() + 2 * sizeof(uint32_t), frame.bytes.size() - 2 * sizeof(uint32_t));
+    std::memcpy(&frame.bytes[sizeof(uint32_t)], &checksum, sizeof(checksum));
+
+    if (std::fwrite(frame.bytes.data(), 1, frame.bytes.size(), file) != frame.bytes.size())
+        return false;
+    lastLsn = lsn;
+    size += frame.bytes.size();
+
+    if (pending == 0)
+        firstPending = std::chrono::steady_clock::now();
+    pending++;
+    switch (syncMode)
+    {
+    case WalSyncMode::FULL:
+        return sync();
+    case WalSyncMode::GROUP:
+        if (pending >= groupSize || std::chrono::steady_clock::now() - firstPending >= groupDelay)
+            return sync();
+        return true;
+    default:
+        // 不 fsync，但仍交给操作系统，进程崩溃时不丢失
+        return std::fflush(file) == 0;
+    }
+}
+
+bool WriteAheadLog::sync()
+{
+    if (!file)
+        return false;
+    bool ok = std::fflush(file) == 0;
+    if (pending > 0 && syncMode != WalSyncMode::OFF)
+        ok = ::fsync(fileno(file)) == 0 && ok;
+    pending = 0;
+    return ok;
+}
+
+bool WriteAheadLog::reset()
+{
+    if (!file)
+        return false;
+    std::fclose(file);
+    file = std::fopen(path.c_str(), "wb");
+    size = 0;
+    pending = 0;
+    return file != nullptr;
+}
+
+bool WriteAheadLog::replay(const std::string &logPath, uint64_t afterLsn, const std::function<void(const LogRecord &)> &apply, uint64_t &lastSequence)
+{
+    lastSequence = afterLsn;
+    std::FILE *in = std::fopen(logPath.c_str(), "rb");
+    if (!in)
+        return true; // 没有日志
+    uint64_t validBytes = 0;
+    std::string frame;
+    std::vector<LogRecord> records;
+    while (true)
+    {
+        char header[FRAME_HEADER];
+        if (std::fread(header, 1, FRAME_HEADER, in) != FRAME_HEADER)
+            break;
+        uint32_t length, checksum;
+        uint64_t lsn;
+        std::memcpy(&length, header, sizeof(length));
+        std::memcpy(&checksum, header + sizeof(uint32_t), sizeof(checksum));
+        std::memcpy(&lsn, header + 2 * sizeof(uint32_t), sizeof(lsn));
+        frame.assign(header + 2 * sizeof(uint32_t), sizeof(lsn));
+        frame.resize(sizeof(lsn) + length);
+        if (std::fread(&frame[sizeof(lsn)], 1, length, in) != length ||
+            crc32(frame.data(), frame.size()) != checksum ||
+            !decodeFrame(std::string_view(frame).substr(sizeof(lsn)), records))
+            break;
+        validBytes += FRAME_HEADER + length;
+        if (lsn > afterLsn)
+        {
+            for (const LogRecord &record : records)
+                apply(record);
+            lastSequence = lsn;
+        }
+    }
+    std::fseek(in, 0, SEEK_END);
+    long end = std::ftell(in);
+    std::fclose(in);
+    if (end >= 0 && static_cast<uint64_t>(end) > validBytes)
+    {
+        std::cerr << "Warning: Discarding incomplete log tail of " << logPath << "." << std::endl;
+        return ::truncate(logPath.c_str(), static_cast<off_t>(validBytes)) == 0;
+    }
+    return true;
+}
+
+std::string logFileName(const std::string &DBname)
+{
+    return DBname + ".wal";
+}
+
+bool applyLogRecord(Database &db, const LogRecord &record)
+{
+    if (record.type == LogRecordType::CREATE_TABLE)
+    {
+        Table table(record.table);
+        for (const auto &column : record.columns)
+            table.addColumns(column.first, column.second);
+        db.tables[record.table] = std::move(table);
+        return true;
+    }
+    auto it = db.tables.find(record.table);
+    if (it == db.tables.end())
+        return false;
+    Table &table = it->second;
+    std::string message;
+    if (record.type != LogRecordType::DROP_TABLE && !table.materialize(message))
+        return false;
+    switch (record.type)
+    {
+    case LogRecordType::DROP_TABLE:
+        db.tables.erase(it);
+        return true;
+    case LogRecordType::INSERT:
+    {
+        size_t firstRow = table.rowCount;
+        for (const auto &values : record.newValues)
+        {
+            if (!table.appendRow(values, message, false))
+            {
+                table.truncateRows(firstRow);
+                return false;
+            }
+        }
+        table.indexRowsFrom(firstRow);
+        return true;
+    }
+    case LogRecordType::UPDATE:
+    {
+        if (record.column >= table.data.size())
+            return false;
+        ColumnData &target = table.data[record.column];
+        for (size_t i = 0; i < record.rows.size(); ++i)
+        {
+            if (record.rows[i] >= table.rowCount || !target.assignParsed(record.rows[i], record.newValues[i]))
+                return false;
+        }
+        return true;
+    }
+    case LogRecordType::TOMBSTONE:
+        for (uint64_t row : record.rows)
+        {
+            if (row >= table.rowCount)
+                return false;
+            table.deleted.mark(row);
+        }
+        return true;
+    case LogRecordType::VACUUM:
+        table.vacuum();
+        return true;
+    default:
+    {
+        std::vector<char> erased(table.rowCount, 0);
+        for (uint64_t row : record.rows)
+        {
+            if (row >= table.rowCount)
+                return false;
+            erased[row] = 1;
+        }
+        table.eraseRows(erased);
+        return true;
+    }
+    }
+}
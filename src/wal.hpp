@@ -0,0 +1,101 @@
+#ifndef WAL_HPP
+#define WAL_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "column_store.hpp"
+
+class Database;
+
+enum class LogRecordType : uint8_t
+{
+    CREATE_TABLE = 1,
+    DROP_TABLE,
+    INSERT,
+    UPDATE,
+    DELETE,      // 立即移除行，只出现在旧版本写出的日志中
+    TOMBSTONE,   // 在删除位图中标记行
+    VACUUM,      // 压缩表中已删除的行
+    TRANSACTION  // 一个事务的全部记录，只作为日志帧的类型出现，重放时依次应用其中的记录
+};
+
+// 一条逻辑日志记录，只包含本次修改涉及的行
+struct LogRecord
+{
+    LogRecordType type = LogRecordType::INSERT;
+    std::string table;
+    std::vector<std::pair<std::string, ColumnType>> columns; // CREATE_TABLE：列定义
+    uint32_t column = 0;                                     // UPDATE：被修改的列
+    std::vector<uint64_t> rows;                              // UPDATE/DELETE/TOMBSTONE：行号
+    std::vector<std::string> newValues;                      // UPDATE：与 rows 一一对应的新值（存储格式）；INSERT：每行括号内的值列表
+};
+
+// 日志的刷盘策略：OFF 只写入操作系统缓存；FULL 每条记录都 fsync；
+// GROUP 攒够 groupSize 条记录或距第一条未刷盘记录超过 groupDelay 时一起 fsync（组提交）
+enum class WalSyncMode
+{
+    OFF,
+    FULL,
+    GROUP
+};
+
+// 类 WriteAheadLog 是数据库 <库名>.wal 的追加写日志。每条记录的格式为
+// [负载长度 u32][CRC32 u32][LSN u64][负载]，CRC 覆盖 LSN 和负载；
+// 检查点把日志并入数据库文件后清空日志，恢复时只重放 LSN 大于检查点的记录。
+class WriteAheadLog
+{
+public:
+    WriteAheadLog() = default;
+    WriteAheadLog(const WriteAheadLog &) = delete;
+    WriteAheadLog &operator=(const WriteAheadLog &) = delete;
+    ~WriteAheadLog() { close(); }
+
+    // 函数 open 以追加方式打开日志，下一条记录的 LSN 为 lastLsn + 1
+    bool open(const std::string &path, uint64_t lastLsn);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+
+    bool append(const LogRecord &record);
+    // 函数 appendTransaction 把一个事务的全部记录写成一帧：帧不完整时整个事务都不会重放。按刷盘策略只刷一次
+    bool appendTransaction(const std::vector<LogRecord> &records);
+    // 函数 sync 把尚未刷盘的记录写入磁盘
+    bool sync();
+    // 函数 reset 在检查点之后清空日志
+    bool reset();
+
+    uint64_t getLastLsn() const { return lastLsn; }
+    uint64_t getSize() const { return size; }
+    void setSyncMode(WalSyncMode mode, size_t size)
+    {
+        syncMode = mode;
+        groupSize = size > 0 ? size : 1;
+    }
+
+    // 函数 replay 依次读出日志中 LSN 大于 afterLsn 的记录（事务帧展开为其中的各条记录）；遇到不完整或校验失败的记录时停止，
+    // 并把日志截断到最后一条完整记录之后（崩溃时写了一半的记录）。lastLsn 返回最后一条完整记录的 LSN
+    static bool replay(const std::string &path, uint64_t afterLsn, const std::function<void(const LogRecord &)> &apply, uint64_t &lastLsn);
+
+private:
+    std::string path;
+    std::FILE *file = nullptr;
+    uint64_t lastLsn = 0;
+    uint64_t size = 0;
+    WalSyncMode syncMode = WalSyncMode::FULL;
+    size_t groupSize = 32;
+    std::chrono::milliseconds groupDelay{10};
+    size_t pending = 0;
+    std::chrono::steady_clock::time_point firstPending;
+
+    bool appendFrame(const std::string &payload);
+};
+
+std::string logFileName(const std::string &DBname);
+// 函数 applyLogRecord 把一条日志记录重放到 db 上，记录与当前数据不一致时返回 false
+bool applyLogRecord(Database &db, const LogRecord &record);
+
+#endif // WAL_HPP
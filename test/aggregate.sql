@@ -0,0 +1,26 @@
+CREATE DATABASE aggregate_db;
+USE DATABASE aggregate_db;
+CREATE TABLE student (
+    ID INTEGER,
+    Name TEXT,
+    GPA FLOAT,
+    Major TEXT
+);
+-- 空表：没有 GROUP BY 时整张表是一组
+SELECT COUNT(*), SUM(ID), MIN(GPA) FROM student;
+INSERT INTO student VALUES (1, 'Alice Johnson', 3.5, 'Computer Science'), (2, 'Bob Smith', 3.6, 'Mathematics'), (3, 'Catherine Lee', 3.9, 'Mathematics'), (4, 'Dave Brown', 3.2, 'Physics'), (5, 'Eva White', 3.8, 'Computer Science'), (6, 'Frank Miller', 2.9, 'Mathematics');
+SELECT COUNT(*) FROM student;
+SELECT COUNT(*), SUM(ID), AVG(GPA), MIN(Name), MAX(Name) FROM student;
+SELECT SUM(GPA), AVG(ID), MIN(ID), MAX(GPA) FROM student WHERE GPA > 3.3;
+-- 各组按第一次出现的顺序输出
+SELECT Major, COUNT(*), AVG(GPA), MIN(ID), MAX(Name) FROM student GROUP BY Major;
+SELECT Major, COUNT(*), SUM(ID) FROM student WHERE GPA > 3.0 GROUP BY Major;
+SELECT Major, ID, COUNT(*) FROM student GROUP BY Major, ID;
+-- 删除的行不计入
+DELETE FROM student WHERE ID = 2;
+SELECT Major, COUNT(*), SUM(ID) FROM student GROUP BY Major;
+SELECT COUNT(*) FROM student;
+-- 错误：普通列不在 GROUP BY 中、对 TEXT 求和
+SELECT Name, COUNT(*) FROM student GROUP BY Major;
+SELECT SUM(Name) FROM student;
+SELECT AVG(Major) FROM student GROUP BY Major;
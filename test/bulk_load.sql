@@ -0,0 +1,23 @@
+CREATE DATABASE bulk_load_db;
+USE DATABASE bulk_load_db;
+CREATE TABLE student (
+    ID INTEGER,
+    Name TEXT,
+    GPA FLOAT,
+    Major TEXT
+);
+CREATE INDEX student_id ON student(ID);
+-- 一条语句插入多行
+INSERT INTO student VALUES (1, 'Alice Johnson', 3.5, 'Computer Science'), (2, 'Bob Smith', 3.6, 'Mathematics'), (3, 'Catherine Lee', 3.9, 'Mathematics');
+-- 有一行不合法时整批都不插入
+INSERT INTO student VALUES (4, 'Dave Brown', 3.2, 'Physics'), (five, 'Eva White', 3.8, 'Chemistry');
+SELECT * FROM student;
+-- 从文件导入，跳过表头；文本中可以有逗号
+COPY student FROM 'bulk_load_input.csv' WITH HEADER;
+SELECT * FROM student;
+SELECT Name, Major FROM student WHERE ID = 6;
+SELECT COUNT(*) FROM student WHERE Major = 'Mathematics';
+-- 文件中有不合法的行时整个文件都不导入
+COPY student FROM 'bulk_load_bad.csv';
+COPY student FROM 'missing_file.csv';
+SELECT COUNT(*) FROM student;
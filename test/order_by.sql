@@ -0,0 +1,61 @@
+CREATE DATABASE order_by_db;
+USE DATABASE order_by_db;
+CREATE TABLE t (
+    ID INTEGER,
+    V INTEGER,
+    Name TEXT,
+    F FLOAT
+);
+INSERT INTO t VALUES (1, 19, 'Bob', 0.37), (2, 38, 'Catherine', 0.74), (3, 7, 'Dave', 1.11), (4, 26, 'Eva', 1.48), (5, 45, 'Frank', 1.85), (6, 14, 'Grace', 2.22), (7, 33, 'Henry', 2.59), (8, 2, 'Irene', 2.96), (9, 21, 'Jack', 3.33), (10, 40, 'Alice', 3.70), (11, 9, 'Bob', 4.07), (12, 28, 'Catherine', 4.44), (13, 47, 'Dave', 4.81), (14, 16, 'Eva', 5.18), (15, 35, 'Frank', 5.55), (16, 4, 'Grace', 5.92), (17, 23, 'Henry', 6.29), (18, 42, 'Irene', 6.66), (19, 11, 'Jack', 7.03), (20, 30, 'Alice', 7.40), (21, 49, 'Bob', 7.77), (22, 18, 'Catherine', 8.14), (23, 37, 'Dave', 8.51), (24, 6, 'Eva', 8.88), (25, 25, 'Frank', 9.25), (26, 44, 'Grace', 9.62), (27, 13, 'Henry', 9.99), (28, 32, 'Irene', 0.36), (29, 1, 'Jack', 0.73), (30, 20, 'Alice', 1.10), (31, 39, 'Bob', 1.47), (32, 8, 'Catherine', 1.84), (33, 27, 'Dave', 2.21), (34, 46, 'Eva', 2.58), (35, 15, 'Frank', 2.95), (36, 34, 'Grace', 3.32), (37, 3, 'Henry', 3.69), (38, 22, 'Irene', 4.06), (39, 41, 'Jack', 4.43), (40, 10, 'Alice', 4.80), (41, 29, 'Bob', 5.17), (42, 48, 'Catherine', 5.54), (43, 17, 'Dave', 5.91), (44, 36, 'Eva', 6.28), (45, 5, 'Frank', 6.65), (46, 24, 'Grace', 7.02), (47, 43, 'Henry', 7.39), (48, 12, 'Irene', 7.76), (49, 31, 'Jack', 8.13), (50, 0, 'Alice', 8.50), (51, 19, 'Bob', 8.87), (52, 38, 'Catherine', 9.24), (53, 7, 'Dave', 9.61), (54, 26, 'Eva', 9.98), (55, 45, 'Frank', 0.35), (56, 14, 'Grace', 0.72), (57, 33, 'Henry', 1.09), (58, 2, 'Irene', 1.46), (59, 21, 'Jack', 1.83), (60, 40, 'Alice', 2.20), (61, 9, 'Bob', 2.57), (62, 28, 'Catherine', 2.94), (63, 47, 'Dave', 3.31), (64, 16, 'Eva', 3.68), (65, 35, 'Frank', 4.05), (66, 4, 'Grace', 4.42), (67, 23, 'Henry', 4.79), (68, 42, 'Irene', 5.16), (69, 11, 'Jack', 5.53), (70, 30, 'Alice', 5.90), (71, 49, 'Bob', 6.27), (72, 18, 'Catherine', 6.64), (73, 37, 'Dave', 7.01), (74, 6, 'Eva', 7.38), (75, 25, 'Frank', 7.75), (76, 44, 'Grace', 8.12), (77, 13, 'Henry', 8.49), (78, 32, 'Irene', 8.86), (79, 1, 'Jack', 9.23), (80, 20, 'Alice', 9.60), (81, 39, 'Bob', 9.97), (82, 8, 'Catherine', 0.34), (83, 27, 'Dave', 0.71), (84, 46, 'Eva', 1.08), (85, 15, 'Frank', 1.45), (86, 34, 'Grace', 1.82), (87, 3, 'Henry', 2.19), (88, 22, 'Irene', 2.56), (89, 41, 'Jack', 2.93), (90, 10, 'Alice', 3.30), (91, 29, 'Bob', 3.67), (92, 48, 'Catherine', 4.04), (93, 17, 'Dave', 4.41), (94, 36, 'Eva', 4.78), (95, 5, 'Frank', 5.15), (96, 24, 'Grace', 5.52), (97, 43, 'Henry', 5.89), (98, 12, 'Irene', 6.26), (99, 31, 'Jack', 6.63), (100, 0, 'Alice', 7.00);
+INSERT INTO t VALUES (101, 19, 'Bob', 7.37), (102, 38, 'Catherine', 7.74), (103, 7, 'Dave', 8.11), (104, 26, 'Eva', 8.48), (105, 45, 'Frank', 8.85), (106, 14, 'Grace', 9.22), (107, 33, 'Henry', 9.59), (108, 2, 'Irene', 9.96), (109, 21, 'Jack', 0.33), (110, 40, 'Alice', 0.70), (111, 9, 'Bob', 1.07), (112, 28, 'Catherine', 1.44), (113, 47, 'Dave', 1.81), (114, 16, 'Eva', 2.18), (115, 35, 'Frank', 2.55), (116, 4, 'Grace', 2.92), (117, 23, 'Henry', 3.29), (118, 42, 'Irene', 3.66), (119, 11, 'Jack', 4.03), (120, 30, 'Alice', 4.40), (121, 49, 'Bob', 4.77), (122, 18, 'Catherine', 5.14), (123, 37, 'Dave', 5.51), (124, 6, 'Eva', 5.88), (125, 25, 'Frank', 6.25), (126, 44, 'Grace', 6.62), (127, 13, 'Henry', 6.99), (128, 32, 'Irene', 7.36), (129, 1, 'Jack', 7.73), (130, 20, 'Alice', 8.10), (131, 39, 'Bob', 8.47), (132, 8, 'Catherine', 8.84), (133, 27, 'Dave', 9.21), (134, 46, 'Eva', 9.58), (135, 15, 'Frank', 9.95), (136, 34, 'Grace', 0.32), (137, 3, 'Henry', 0.69), (138, 22, 'Irene', 1.06), (139, 41, 'Jack', 1.43), (140, 10, 'Alice', 1.80), (141, 29, 'Bob', 2.17), (142, 48, 'Catherine', 2.54), (143, 17, 'Dave', 2.91), (144, 36, 'Eva', 3.28), (145, 5, 'Frank', 3.65), (146, 24, 'Grace', 4.02), (147, 43, 'Henry', 4.39), (148, 12, 'Irene', 4.76), (149, 31, 'Jack', 5.13), (150, 0, 'Alice', 5.50), (151, 19, 'Bob', 5.87), (152, 38, 'Catherine', 6.24), (153, 7, 'Dave', 6.61), (154, 26, 'Eva', 6.98), (155, 45, 'Frank', 7.35), (156, 14, 'Grace', 7.72), (157, 33, 'Henry', 8.09), (158, 2, 'Irene', 8.46), (159, 21, 'Jack', 8.83), (160, 40, 'Alice', 9.20), (161, 9, 'Bob', 9.57), (162, 28, 'Catherine', 9.94), (163, 47, 'Dave', 0.31), (164, 16, 'Eva', 0.68), (165, 35, 'Frank', 1.05), (166, 4, 'Grace', 1.42), (167, 23, 'Henry', 1.79), (168, 42, 'Irene', 2.16), (169, 11, 'Jack', 2.53), (170, 30, 'Alice', 2.90), (171, 49, 'Bob', 3.27), (172, 18, 'Catherine', 3.64), (173, 37, 'Dave', 4.01), (174, 6, 'Eva', 4.38), (175, 25, 'Frank', 4.75), (176, 44, 'Grace', 5.12), (177, 13, 'Henry', 5.49), (178, 32, 'Irene', 5.86), (179, 1, 'Jack', 6.23), (180, 20, 'Alice', 6.60), (181, 39, 'Bob', 6.97), (182, 8, 'Catherine', 7.34), (183, 27, 'Dave', 7.71), (184, 46, 'Eva', 8.08), (185, 15, 'Frank', 8.45), (186, 34, 'Grace', 8.82), (187, 3, 'Henry', 9.19), (188, 22, 'Irene', 9.56), (189, 41, 'Jack', 9.93), (190, 10, 'Alice', 0.30), (191, 29, 'Bob', 0.67), (192, 48, 'Catherine', 1.04), (193, 17, 'Dave', 1.41), (194, 36, 'Eva', 1.78), (195, 5, 'Frank', 2.15), (196, 24, 'Grace', 2.52), (197, 43, 'Henry', 2.89), (198, 12, 'Irene', 3.26), (199, 31, 'Jack', 3.63), (200, 0, 'Alice', 4.00);
+INSERT INTO t VALUES (201, 19, 'Bob', 4.37), (202, 38, 'Catherine', 4.74), (203, 7, 'Dave', 5.11), (204, 26, 'Eva', 5.48), (205, 45, 'Frank', 5.85), (206, 14, 'Grace', 6.22), (207, 33, 'Henry', 6.59), (208, 2, 'Irene', 6.96), (209, 21, 'Jack', 7.33), (210, 40, 'Alice', 7.70), (211, 9, 'Bob', 8.07), (212, 28, 'Catherine', 8.44), (213, 47, 'Dave', 8.81), (214, 16, 'Eva', 9.18), (215, 35, 'Frank', 9.55), (216, 4, 'Grace', 9.92), (217, 23, 'Henry', 0.29), (218, 42, 'Irene', 0.66), (219, 11, 'Jack', 1.03), (220, 30, 'Alice', 1.40), (221, 49, 'Bob', 1.77), (222, 18, 'Catherine', 2.14), (223, 37, 'Dave', 2.51), (224, 6, 'Eva', 2.88), (225, 25, 'Frank', 3.25), (226, 44, 'Grace', 3.62), (227, 13, 'Henry', 3.99), (228, 32, 'Irene', 4.36), (229, 1, 'Jack', 4.73), (230, 20, 'Alice', 5.10), (231, 39, 'Bob', 5.47), (232, 8, 'Catherine', 5.84), (233, 27, 'Dave', 6.21), (234, 46, 'Eva', 6.58), (235, 15, 'Frank', 6.95), (236, 34, 'Grace', 7.32), (237, 3, 'Henry', 7.69), (238, 22, 'Irene', 8.06), (239, 41, 'Jack', 8.43), (240, 10, 'Alice', 8.80), (241, 29, 'Bob', 9.17), (242, 48, 'Catherine', 9.54), (243, 17, 'Dave', 9.91), (244, 36, 'Eva', 0.28), (245, 5, 'Frank', 0.65), (246, 24, 'Grace', 1.02), (247, 43, 'Henry', 1.39), (248, 12, 'Irene', 1.76), (249, 31, 'Jack', 2.13), (250, 0, 'Alice', 2.50), (251, 19, 'Bob', 2.87), (252, 38, 'Catherine', 3.24), (253, 7, 'Dave', 3.61), (254, 26, 'Eva', 3.98), (255, 45, 'Frank', 4.35), (256, 14, 'Grace', 4.72), (257, 33, 'Henry', 5.09), (258, 2, 'Irene', 5.46), (259, 21, 'Jack', 5.83), (260, 40, 'Alice', 6.20), (261, 9, 'Bob', 6.57), (262, 28, 'Catherine', 6.94), (263, 47, 'Dave', 7.31), (264, 16, 'Eva', 7.68), (265, 35, 'Frank', 8.05), (266, 4, 'Grace', 8.42), (267, 23, 'Henry', 8.79), (268, 42, 'Irene', 9.16), (269, 11, 'Jack', 9.53), (270, 30, 'Alice', 9.90), (271, 49, 'Bob', 0.27), (272, 18, 'Catherine', 0.64), (273, 37, 'Dave', 1.01), (274, 6, 'Eva', 1.38), (275, 25, 'Frank', 1.75), (276, 44, 'Grace', 2.12), (277, 13, 'Henry', 2.49), (278, 32, 'Irene', 2.86), (279, 1, 'Jack', 3.23), (280, 20, 'Alice', 3.60), (281, 39, 'Bob', 3.97), (282, 8, 'Catherine', 4.34), (283, 27, 'Dave', 4.71), (284, 46, 'Eva', 5.08), (285, 15, 'Frank', 5.45), (286, 34, 'Grace', 5.82), (287, 3, 'Henry', 6.19), (288, 22, 'Irene', 6.56), (289, 41, 'Jack', 6.93), (290, 10, 'Alice', 7.30), (291, 29, 'Bob', 7.67), (292, 48, 'Catherine', 8.04), (293, 17, 'Dave', 8.41), (294, 36, 'Eva', 8.78), (295, 5, 'Frank', 9.15), (296, 24, 'Grace', 9.52), (297, 43, 'Henry', 9.89), (298, 12, 'Irene', 0.26), (299, 31, 'Jack', 0.63), (300, 0, 'Alice', 1.00);
+INSERT INTO t VALUES (301, 19, 'Bob', 1.37), (302, 38, 'Catherine', 1.74), (303, 7, 'Dave', 2.11), (304, 26, 'Eva', 2.48), (305, 45, 'Frank', 2.85), (306, 14, 'Grace', 3.22), (307, 33, 'Henry', 3.59), (308, 2, 'Irene', 3.96), (309, 21, 'Jack', 4.33), (310, 40, 'Alice', 4.70), (311, 9, 'Bob', 5.07), (312, 28, 'Catherine', 5.44), (313, 47, 'Dave', 5.81), (314, 16, 'Eva', 6.18), (315, 35, 'Frank', 6.55), (316, 4, 'Grace', 6.92), (317, 23, 'Henry', 7.29), (318, 42, 'Irene', 7.66), (319, 11, 'Jack', 8.03), (320, 30, 'Alice', 8.40), (321, 49, 'Bob', 8.77), (322, 18, 'Catherine', 9.14), (323, 37, 'Dave', 9.51), (324, 6, 'Eva', 9.88), (325, 25, 'Frank', 0.25), (326, 44, 'Grace', 0.62), (327, 13, 'Henry', 0.99), (328, 32, 'Irene', 1.36), (329, 1, 'Jack', 1.73), (330, 20, 'Alice', 2.10), (331, 39, 'Bob', 2.47), (332, 8, 'Catherine', 2.84), (333, 27, 'Dave', 3.21), (334, 46, 'Eva', 3.58), (335, 15, 'Frank', 3.95), (336, 34, 'Grace', 4.32), (337, 3, 'Henry', 4.69), (338, 22, 'Irene', 5.06), (339, 41, 'Jack', 5.43), (340, 10, 'Alice', 5.80), (341, 29, 'Bob', 6.17), (342, 48, 'Catherine', 6.54), (343, 17, 'Dave', 6.91), (344, 36, 'Eva', 7.28), (345, 5, 'Frank', 7.65), (346, 24, 'Grace', 8.02), (347, 43, 'Henry', 8.39), (348, 12, 'Irene', 8.76), (349, 31, 'Jack', 9.13), (350, 0, 'Alice', 9.50), (351, 19, 'Bob', 9.87), (352, 38, 'Catherine', 0.24), (353, 7, 'Dave', 0.61), (354, 26, 'Eva', 0.98), (355, 45, 'Frank', 1.35), (356, 14, 'Grace', 1.72), (357, 33, 'Henry', 2.09), (358, 2, 'Irene', 2.46), (359, 21, 'Jack', 2.83), (360, 40, 'Alice', 3.20), (361, 9, 'Bob', 3.57), (362, 28, 'Catherine', 3.94), (363, 47, 'Dave', 4.31), (364, 16, 'Eva', 4.68), (365, 35, 'Frank', 5.05), (366, 4, 'Grace', 5.42), (367, 23, 'Henry', 5.79), (368, 42, 'Irene', 6.16), (369, 11, 'Jack', 6.53), (370, 30, 'Alice', 6.90), (371, 49, 'Bob', 7.27), (372, 18, 'Catherine', 7.64), (373, 37, 'Dave', 8.01), (374, 6, 'Eva', 8.38), (375, 25, 'Frank', 8.75), (376, 44, 'Grace', 9.12), (377, 13, 'Henry', 9.49), (378, 32, 'Irene', 9.86), (379, 1, 'Jack', 0.23), (380, 20, 'Alice', 0.60), (381, 39, 'Bob', 0.97), (382, 8, 'Catherine', 1.34), (383, 27, 'Dave', 1.71), (384, 46, 'Eva', 2.08), (385, 15, 'Frank', 2.45), (386, 34, 'Grace', 2.82), (387, 3, 'Henry', 3.19), (388, 22, 'Irene', 3.56), (389, 41, 'Jack', 3.93), (390, 10, 'Alice', 4.30), (391, 29, 'Bob', 4.67), (392, 48, 'Catherine', 5.04), (393, 17, 'Dave', 5.41), (394, 36, 'Eva', 5.78), (395, 5, 'Frank', 6.15), (396, 24, 'Grace', 6.52), (397, 43, 'Henry', 6.89), (398, 12, 'Irene', 7.26), (399, 31, 'Jack', 7.63), (400, 0, 'Alice', 8.00);
+INSERT INTO t VALUES (401, 19, 'Bob', 8.37), (402, 38, 'Catherine', 8.74), (403, 7, 'Dave', 9.11), (404, 26, 'Eva', 9.48), (405, 45, 'Frank', 9.85), (406, 14, 'Grace', 0.22), (407, 33, 'Henry', 0.59), (408, 2, 'Irene', 0.96), (409, 21, 'Jack', 1.33), (410, 40, 'Alice', 1.70), (411, 9, 'Bob', 2.07), (412, 28, 'Catherine', 2.44), (413, 47, 'Dave', 2.81), (414, 16, 'Eva', 3.18), (415, 35, 'Frank', 3.55), (416, 4, 'Grace', 3.92), (417, 23, 'Henry', 4.29), (418, 42, 'Irene', 4.66), (419, 11, 'Jack', 5.03), (420, 30, 'Alice', 5.40), (421, 49, 'Bob', 5.77), (422, 18, 'Catherine', 6.14), (423, 37, 'Dave', 6.51), (424, 6, 'Eva', 6.88), (425, 25, 'Frank', 7.25), (426, 44, 'Grace', 7.62), (427, 13, 'Henry', 7.99), (428, 32, 'Irene', 8.36), (429, 1, 'Jack', 8.73), (430, 20, 'Alice', 9.10), (431, 39, 'Bob', 9.47), (432, 8, 'Catherine', 9.84), (433, 27, 'Dave', 0.21), (434, 46, 'Eva', 0.58), (435, 15, 'Frank', 0.95), (436, 34, 'Grace', 1.32), (437, 3, 'Henry', 1.69), (438, 22, 'Irene', 2.06), (439, 41, 'Jack', 2.43), (440, 10, 'Alice', 2.80), (441, 29, 'Bob', 3.17), (442, 48, 'Catherine', 3.54), (443, 17, 'Dave', 3.91), (444, 36, 'Eva', 4.28), (445, 5, 'Frank', 4.65), (446, 24, 'Grace', 5.02), (447, 43, 'Henry', 5.39), (448, 12, 'Irene', 5.76), (449, 31, 'Jack', 6.13), (450, 0, 'Alice', 6.50), (451, 19, 'Bob', 6.87), (452, 38, 'Catherine', 7.24), (453, 7, 'Dave', 7.61), (454, 26, 'Eva', 7.98), (455, 45, 'Frank', 8.35), (456, 14, 'Grace', 8.72), (457, 33, 'Henry', 9.09), (458, 2, 'Irene', 9.46), (459, 21, 'Jack', 9.83), (460, 40, 'Alice', 0.20), (461, 9, 'Bob', 0.57), (462, 28, 'Catherine', 0.94), (463, 47, 'Dave', 1.31), (464, 16, 'Eva', 1.68), (465, 35, 'Frank', 2.05), (466, 4, 'Grace', 2.42), (467, 23, 'Henry', 2.79), (468, 42, 'Irene', 3.16), (469, 11, 'Jack', 3.53), (470, 30, 'Alice', 3.90), (471, 49, 'Bob', 4.27), (472, 18, 'Catherine', 4.64), (473, 37, 'Dave', 5.01), (474, 6, 'Eva', 5.38), (475, 25, 'Frank', 5.75), (476, 44, 'Grace', 6.12), (477, 13, 'Henry', 6.49), (478, 32, 'Irene', 6.86), (479, 1, 'Jack', 7.23), (480, 20, 'Alice', 7.60), (481, 39, 'Bob', 7.97), (482, 8, 'Catherine', 8.34), (483, 27, 'Dave', 8.71), (484, 46, 'Eva', 9.08), (485, 15, 'Frank', 9.45), (486, 34, 'Grace', 9.82), (487, 3, 'Henry', 0.19), (488, 22, 'Irene', 0.56), (489, 41, 'Jack', 0.93), (490, 10, 'Alice', 1.30), (491, 29, 'Bob', 1.67), (492, 48, 'Catherine', 2.04), (493, 17, 'Dave', 2.41), (494, 36, 'Eva', 2.78), (495, 5, 'Frank', 3.15), (496, 24, 'Grace', 3.52), (497, 43, 'Henry', 3.89), (498, 12, 'Irene', 4.26), (499, 31, 'Jack', 4.63), (500, 0, 'Alice', 5.00);
+INSERT INTO t VALUES (501, 19, 'Bob', 5.37), (502, 38, 'Catherine', 5.74), (503, 7, 'Dave', 6.11), (504, 26, 'Eva', 6.48), (505, 45, 'Frank', 6.85), (506, 14, 'Grace', 7.22), (507, 33, 'Henry', 7.59), (508, 2, 'Irene', 7.96), (509, 21, 'Jack', 8.33), (510, 40, 'Alice', 8.70), (511, 9, 'Bob', 9.07), (512, 28, 'Catherine', 9.44), (513, 47, 'Dave', 9.81), (514, 16, 'Eva', 0.18), (515, 35, 'Frank', 0.55), (516, 4, 'Grace', 0.92), (517, 23, 'Henry', 1.29), (518, 42, 'Irene', 1.66), (519, 11, 'Jack', 2.03), (520, 30, 'Alice', 2.40), (521, 49, 'Bob', 2.77), (522, 18, 'Catherine', 3.14), (523, 37, 'Dave', 3.51), (524, 6, 'Eva', 3.88), (525, 25, 'Frank', 4.25), (526, 44, 'Grace', 4.62), (527, 13, 'Henry', 4.99), (528, 32, 'Irene', 5.36), (529, 1, 'Jack', 5.73), (530, 20, 'Alice', 6.10), (531, 39, 'Bob', 6.47), (532, 8, 'Catherine', 6.84), (533, 27, 'Dave', 7.21), (534, 46, 'Eva', 7.58), (535, 15, 'Frank', 7.95), (536, 34, 'Grace', 8.32), (537, 3, 'Henry', 8.69), (538, 22, 'Irene', 9.06), (539, 41, 'Jack', 9.43), (540, 10, 'Alice', 9.80), (541, 29, 'Bob', 0.17), (542, 48, 'Catherine', 0.54), (543, 17, 'Dave', 0.91), (544, 36, 'Eva', 1.28), (545, 5, 'Frank', 1.65), (546, 24, 'Grace', 2.02), (547, 43, 'Henry', 2.39), (548, 12, 'Irene', 2.76), (549, 31, 'Jack', 3.13), (550, 0, 'Alice', 3.50), (551, 19, 'Bob', 3.87), (552, 38, 'Catherine', 4.24), (553, 7, 'Dave', 4.61), (554, 26, 'Eva', 4.98), (555, 45, 'Frank', 5.35), (556, 14, 'Grace', 5.72), (557, 33, 'Henry', 6.09), (558, 2, 'Irene', 6.46), (559, 21, 'Jack', 6.83), (560, 40, 'Alice', 7.20), (561, 9, 'Bob', 7.57), (562, 28, 'Catherine', 7.94), (563, 47, 'Dave', 8.31), (564, 16, 'Eva', 8.68), (565, 35, 'Frank', 9.05), (566, 4, 'Grace', 9.42), (567, 23, 'Henry', 9.79), (568, 42, 'Irene', 0.16), (569, 11, 'Jack', 0.53), (570, 30, 'Alice', 0.90), (571, 49, 'Bob', 1.27), (572, 18, 'Catherine', 1.64), (573, 37, 'Dave', 2.01), (574, 6, 'Eva', 2.38), (575, 25, 'Frank', 2.75), (576, 44, 'Grace', 3.12), (577, 13, 'Henry', 3.49), (578, 32, 'Irene', 3.86), (579, 1, 'Jack', 4.23), (580, 20, 'Alice', 4.60), (581, 39, 'Bob', 4.97), (582, 8, 'Catherine', 5.34), (583, 27, 'Dave', 5.71), (584, 46, 'Eva', 6.08), (585, 15, 'Frank', 6.45), (586, 34, 'Grace', 6.82), (587, 3, 'Henry', 7.19), (588, 22, 'Irene', 7.56), (589, 41, 'Jack', 7.93), (590, 10, 'Alice', 8.30), (591, 29, 'Bob', 8.67), (592, 48, 'Catherine', 9.04), (593, 17, 'Dave', 9.41), (594, 36, 'Eva', 9.78), (595, 5, 'Frank', 0.15), (596, 24, 'Grace', 0.52), (597, 43, 'Henry', 0.89), (598, 12, 'Irene', 1.26), (599, 31, 'Jack', 1.63), (600, 0, 'Alice', 2.00);
+INSERT INTO t VALUES (601, 19, 'Bob', 2.37), (602, 38, 'Catherine', 2.74), (603, 7, 'Dave', 3.11), (604, 26, 'Eva', 3.48), (605, 45, 'Frank', 3.85), (606, 14, 'Grace', 4.22), (607, 33, 'Henry', 4.59), (608, 2, 'Irene', 4.96), (609, 21, 'Jack', 5.33), (610, 40, 'Alice', 5.70), (611, 9, 'Bob', 6.07), (612, 28, 'Catherine', 6.44), (613, 47, 'Dave', 6.81), (614, 16, 'Eva', 7.18), (615, 35, 'Frank', 7.55), (616, 4, 'Grace', 7.92), (617, 23, 'Henry', 8.29), (618, 42, 'Irene', 8.66), (619, 11, 'Jack', 9.03), (620, 30, 'Alice', 9.40), (621, 49, 'Bob', 9.77), (622, 18, 'Catherine', 0.14), (623, 37, 'Dave', 0.51), (624, 6, 'Eva', 0.88), (625, 25, 'Frank', 1.25), (626, 44, 'Grace', 1.62), (627, 13, 'Henry', 1.99), (628, 32, 'Irene', 2.36), (629, 1, 'Jack', 2.73), (630, 20, 'Alice', 3.10), (631, 39, 'Bob', 3.47), (632, 8, 'Catherine', 3.84), (633, 27, 'Dave', 4.21), (634, 46, 'Eva', 4.58), (635, 15, 'Frank', 4.95), (636, 34, 'Grace', 5.32), (637, 3, 'Henry', 5.69), (638, 22, 'Irene', 6.06), (639, 41, 'Jack', 6.43), (640, 10, 'Alice', 6.80), (641, 29, 'Bob', 7.17), (642, 48, 'Catherine', 7.54), (643, 17, 'Dave', 7.91), (644, 36, 'Eva', 8.28), (645, 5, 'Frank', 8.65), (646, 24, 'Grace', 9.02), (647, 43, 'Henry', 9.39), (648, 12, 'Irene', 9.76), (649, 31, 'Jack', 0.13), (650, 0, 'Alice', 0.50), (651, 19, 'Bob', 0.87), (652, 38, 'Catherine', 1.24), (653, 7, 'Dave', 1.61), (654, 26, 'Eva', 1.98), (655, 45, 'Frank', 2.35), (656, 14, 'Grace', 2.72), (657, 33, 'Henry', 3.09), (658, 2, 'Irene', 3.46), (659, 21, 'Jack', 3.83), (660, 40, 'Alice', 4.20), (661, 9, 'Bob', 4.57), (662, 28, 'Catherine', 4.94), (663, 47, 'Dave', 5.31), (664, 16, 'Eva', 5.68), (665, 35, 'Frank', 6.05), (666, 4, 'Grace', 6.42), (667, 23, 'Henry', 6.79), (668, 42, 'Irene', 7.16), (669, 11, 'Jack', 7.53), (670, 30, 'Alice', 7.90), (671, 49, 'Bob', 8.27), (672, 18, 'Catherine', 8.64), (673, 37, 'Dave', 9.01), (674, 6, 'Eva', 9.38), (675, 25, 'Frank', 9.75), (676, 44, 'Grace', 0.12), (677, 13, 'Henry', 0.49), (678, 32, 'Irene', 0.86), (679, 1, 'Jack', 1.23), (680, 20, 'Alice', 1.60), (681, 39, 'Bob', 1.97), (682, 8, 'Catherine', 2.34), (683, 27, 'Dave', 2.71), (684, 46, 'Eva', 3.08), (685, 15, 'Frank', 3.45), (686, 34, 'Grace', 3.82), (687, 3, 'Henry', 4.19), (688, 22, 'Irene', 4.56), (689, 41, 'Jack', 4.93), (690, 10, 'Alice', 5.30), (691, 29, 'Bob', 5.67), (692, 48, 'Catherine', 6.04), (693, 17, 'Dave', 6.41), (694, 36, 'Eva', 6.78), (695, 5, 'Frank', 7.15), (696, 24, 'Grace', 7.52), (697, 43, 'Henry', 7.89), (698, 12, 'Irene', 8.26), (699, 31, 'Jack', 8.63), (700, 0, 'Alice', 9.00);
+INSERT INTO t VALUES (701, 19, 'Bob', 9.37), (702, 38, 'Catherine', 9.74), (703, 7, 'Dave', 0.11), (704, 26, 'Eva', 0.48), (705, 45, 'Frank', 0.85), (706, 14, 'Grace', 1.22), (707, 33, 'Henry', 1.59), (708, 2, 'Irene', 1.96), (709, 21, 'Jack', 2.33), (710, 40, 'Alice', 2.70), (711, 9, 'Bob', 3.07), (712, 28, 'Catherine', 3.44), (713, 47, 'Dave', 3.81), (714, 16, 'Eva', 4.18), (715, 35, 'Frank', 4.55), (716, 4, 'Grace', 4.92), (717, 23, 'Henry', 5.29), (718, 42, 'Irene', 5.66), (719, 11, 'Jack', 6.03), (720, 30, 'Alice', 6.40), (721, 49, 'Bob', 6.77), (722, 18, 'Catherine', 7.14), (723, 37, 'Dave', 7.51), (724, 6, 'Eva', 7.88), (725, 25, 'Frank', 8.25), (726, 44, 'Grace', 8.62), (727, 13, 'Henry', 8.99), (728, 32, 'Irene', 9.36), (729, 1, 'Jack', 9.73), (730, 20, 'Alice', 0.10), (731, 39, 'Bob', 0.47), (732, 8, 'Catherine', 0.84), (733, 27, 'Dave', 1.21), (734, 46, 'Eva', 1.58), (735, 15, 'Frank', 1.95), (736, 34, 'Grace', 2.32), (737, 3, 'Henry', 2.69), (738, 22, 'Irene', 3.06), (739, 41, 'Jack', 3.43), (740, 10, 'Alice', 3.80), (741, 29, 'Bob', 4.17), (742, 48, 'Catherine', 4.54), (743, 17, 'Dave', 4.91), (744, 36, 'Eva', 5.28), (745, 5, 'Frank', 5.65), (746, 24, 'Grace', 6.02), (747, 43, 'Henry', 6.39), (748, 12, 'Irene', 6.76), (749, 31, 'Jack', 7.13), (750, 0, 'Alice', 7.50), (751, 19, 'Bob', 7.87), (752, 38, 'Catherine', 8.24), (753, 7, 'Dave', 8.61), (754, 26, 'Eva', 8.98), (755, 45, 'Frank', 9.35), (756, 14, 'Grace', 9.72), (757, 33, 'Henry', 0.09), (758, 2, 'Irene', 0.46), (759, 21, 'Jack', 0.83), (760, 40, 'Alice', 1.20), (761, 9, 'Bob', 1.57), (762, 28, 'Catherine', 1.94), (763, 47, 'Dave', 2.31), (764, 16, 'Eva', 2.68), (765, 35, 'Frank', 3.05), (766, 4, 'Grace', 3.42), (767, 23, 'Henry', 3.79), (768, 42, 'Irene', 4.16), (769, 11, 'Jack', 4.53), (770, 30, 'Alice', 4.90), (771, 49, 'Bob', 5.27), (772, 18, 'Catherine', 5.64), (773, 37, 'Dave', 6.01), (774, 6, 'Eva', 6.38), (775, 25, 'Frank', 6.75), (776, 44, 'Grace', 7.12), (777, 13, 'Henry', 7.49), (778, 32, 'Irene', 7.86), (779, 1, 'Jack', 8.23), (780, 20, 'Alice', 8.60), (781, 39, 'Bob', 8.97), (782, 8, 'Catherine', 9.34), (783, 27, 'Dave', 9.71), (784, 46, 'Eva', 0.08), (785, 15, 'Frank', 0.45), (786, 34, 'Grace', 0.82), (787, 3, 'Henry', 1.19), (788, 22, 'Irene', 1.56), (789, 41, 'Jack', 1.93), (790, 10, 'Alice', 2.30), (791, 29, 'Bob', 2.67), (792, 48, 'Catherine', 3.04), (793, 17, 'Dave', 3.41), (794, 36, 'Eva', 3.78), (795, 5, 'Frank', 4.15), (796, 24, 'Grace', 4.52), (797, 43, 'Henry', 4.89), (798, 12, 'Irene', 5.26), (799, 31, 'Jack', 5.63), (800, 0, 'Alice', 6.00);
+INSERT INTO t VALUES (801, 19, 'Bob', 6.37), (802, 38, 'Catherine', 6.74), (803, 7, 'Dave', 7.11), (804, 26, 'Eva', 7.48), (805, 45, 'Frank', 7.85), (806, 14, 'Grace', 8.22), (807, 33, 'Henry', 8.59), (808, 2, 'Irene', 8.96), (809, 21, 'Jack', 9.33), (810, 40, 'Alice', 9.70), (811, 9, 'Bob', 0.07), (812, 28, 'Catherine', 0.44), (813, 47, 'Dave', 0.81), (814, 16, 'Eva', 1.18), (815, 35, 'Frank', 1.55), (816, 4, 'Grace', 1.92), (817, 23, 'Henry', 2.29), (818, 42, 'Irene', 2.66), (819, 11, 'Jack', 3.03), (820, 30, 'Alice', 3.40), (821, 49, 'Bob', 3.77), (822, 18, 'Catherine', 4.14), (823, 37, 'Dave', 4.51), (824, 6, 'Eva', 4.88), (825, 25, 'Frank', 5.25), (826, 44, 'Grace', 5.62), (827, 13, 'Henry', 5.99), (828, 32, 'Irene', 6.36), (829, 1, 'Jack', 6.73), (830, 20, 'Alice', 7.10), (831, 39, 'Bob', 7.47), (832, 8, 'Catherine', 7.84), (833, 27, 'Dave', 8.21), (834, 46, 'Eva', 8.58), (835, 15, 'Frank', 8.95), (836, 34, 'Grace', 9.32), (837, 3, 'Henry', 9.69), (838, 22, 'Irene', 0.06), (839, 41, 'Jack', 0.43), (840, 10, 'Alice', 0.80), (841, 29, 'Bob', 1.17), (842, 48, 'Catherine', 1.54), (843, 17, 'Dave', 1.91), (844, 36, 'Eva', 2.28), (845, 5, 'Frank', 2.65), (846, 24, 'Grace', 3.02), (847, 43, 'Henry', 3.39), (848, 12, 'Irene', 3.76), (849, 31, 'Jack', 4.13), (850, 0, 'Alice', 4.50), (851, 19, 'Bob', 4.87), (852, 38, 'Catherine', 5.24), (853, 7, 'Dave', 5.61), (854, 26, 'Eva', 5.98), (855, 45, 'Frank', 6.35), (856, 14, 'Grace', 6.72), (857, 33, 'Henry', 7.09), (858, 2, 'Irene', 7.46), (859, 21, 'Jack', 7.83), (860, 40, 'Alice', 8.20), (861, 9, 'Bob', 8.57), (862, 28, 'Catherine', 8.94), (863, 47, 'Dave', 9.31), (864, 16, 'Eva', 9.68), (865, 35, 'Frank', 0.05), (866, 4, 'Grace', 0.42), (867, 23, 'Henry', 0.79), (868, 42, 'Irene', 1.16), (869, 11, 'Jack', 1.53), (870, 30, 'Alice', 1.90), (871, 49, 'Bob', 2.27), (872, 18, 'Catherine', 2.64), (873, 37, 'Dave', 3.01), (874, 6, 'Eva', 3.38), (875, 25, 'Frank', 3.75), (876, 44, 'Grace', 4.12), (877, 13, 'Henry', 4.49), (878, 32, 'Irene', 4.86), (879, 1, 'Jack', 5.23), (880, 20, 'Alice', 5.60), (881, 39, 'Bob', 5.97), (882, 8, 'Catherine', 6.34), (883, 27, 'Dave', 6.71), (884, 46, 'Eva', 7.08), (885, 15, 'Frank', 7.45), (886, 34, 'Grace', 7.82), (887, 3, 'Henry', 8.19), (888, 22, 'Irene', 8.56), (889, 41, 'Jack', 8.93), (890, 10, 'Alice', 9.30), (891, 29, 'Bob', 9.67), (892, 48, 'Catherine', 0.04), (893, 17, 'Dave', 0.41), (894, 36, 'Eva', 0.78), (895, 5, 'Frank', 1.15), (896, 24, 'Grace', 1.52), (897, 43, 'Henry', 1.89), (898, 12, 'Irene', 2.26), (899, 31, 'Jack', 2.63), (900, 0, 'Alice', 3.00);
+INSERT INTO t VALUES (901, 19, 'Bob', 3.37), (902, 38, 'Catherine', 3.74), (903, 7, 'Dave', 4.11), (904, 26, 'Eva', 4.48), (905, 45, 'Frank', 4.85), (906, 14, 'Grace', 5.22), (907, 33, 'Henry', 5.59), (908, 2, 'Irene', 5.96), (909, 21, 'Jack', 6.33), (910, 40, 'Alice', 6.70), (911, 9, 'Bob', 7.07), (912, 28, 'Catherine', 7.44), (913, 47, 'Dave', 7.81), (914, 16, 'Eva', 8.18), (915, 35, 'Frank', 8.55), (916, 4, 'Grace', 8.92), (917, 23, 'Henry', 9.29), (918, 42, 'Irene', 9.66), (919, 11, 'Jack', 0.03), (920, 30, 'Alice', 0.40), (921, 49, 'Bob', 0.77), (922, 18, 'Catherine', 1.14), (923, 37, 'Dave', 1.51), (924, 6, 'Eva', 1.88), (925, 25, 'Frank', 2.25), (926, 44, 'Grace', 2.62), (927, 13, 'Henry', 2.99), (928, 32, 'Irene', 3.36), (929, 1, 'Jack', 3.73), (930, 20, 'Alice', 4.10), (931, 39, 'Bob', 4.47), (932, 8, 'Catherine', 4.84), (933, 27, 'Dave', 5.21), (934, 46, 'Eva', 5.58), (935, 15, 'Frank', 5.95), (936, 34, 'Grace', 6.32), (937, 3, 'Henry', 6.69), (938, 22, 'Irene', 7.06), (939, 41, 'Jack', 7.43), (940, 10, 'Alice', 7.80), (941, 29, 'Bob', 8.17), (942, 48, 'Catherine', 8.54), (943, 17, 'Dave', 8.91), (944, 36, 'Eva', 9.28), (945, 5, 'Frank', 9.65), (946, 24, 'Grace', 0.02), (947, 43, 'Henry', 0.39), (948, 12, 'Irene', 0.76), (949, 31, 'Jack', 1.13), (950, 0, 'Alice', 1.50), (951, 19, 'Bob', 1.87), (952, 38, 'Catherine', 2.24), (953, 7, 'Dave', 2.61), (954, 26, 'Eva', 2.98), (955, 45, 'Frank', 3.35), (956, 14, 'Grace', 3.72), (957, 33, 'Henry', 4.09), (958, 2, 'Irene', 4.46), (959, 21, 'Jack', 4.83), (960, 40, 'Alice', 5.20), (961, 9, 'Bob', 5.57), (962, 28, 'Catherine', 5.94), (963, 47, 'Dave', 6.31), (964, 16, 'Eva', 6.68), (965, 35, 'Frank', 7.05), (966, 4, 'Grace', 7.42), (967, 23, 'Henry', 7.79), (968, 42, 'Irene', 8.16), (969, 11, 'Jack', 8.53), (970, 30, 'Alice', 8.90), (971, 49, 'Bob', 9.27), (972, 18, 'Catherine', 9.64), (973, 37, 'Dave', 0.01), (974, 6, 'Eva', 0.38), (975, 25, 'Frank', 0.75), (976, 44, 'Grace', 1.12), (977, 13, 'Henry', 1.49), (978, 32, 'Irene', 1.86), (979, 1, 'Jack', 2.23), (980, 20, 'Alice', 2.60), (981, 39, 'Bob', 2.97), (982, 8, 'Catherine', 3.34), (983, 27, 'Dave', 3.71), (984, 46, 'Eva', 4.08), (985, 15, 'Frank', 4.45), (986, 34, 'Grace', 4.82), (987, 3, 'Henry', 5.19), (988, 22, 'Irene', 5.56), (989, 41, 'Jack', 5.93), (990, 10, 'Alice', 6.30), (991, 29, 'Bob', 6.67), (992, 48, 'Catherine', 7.04), (993, 17, 'Dave', 7.41), (994, 36, 'Eva', 7.78), (995, 5, 'Frank', 8.15), (996, 24, 'Grace', 8.52), (997, 43, 'Henry', 8.89), (998, 12, 'Irene', 9.26), (999, 31, 'Jack', 9.63), (1000, 0, 'Alice', 0.00);
+INSERT INTO t VALUES (1001, 19, 'Bob', 0.37), (1002, 38, 'Catherine', 0.74), (1003, 7, 'Dave', 1.11), (1004, 26, 'Eva', 1.48), (1005, 45, 'Frank', 1.85), (1006, 14, 'Grace', 2.22), (1007, 33, 'Henry', 2.59), (1008, 2, 'Irene', 2.96), (1009, 21, 'Jack', 3.33), (1010, 40, 'Alice', 3.70), (1011, 9, 'Bob', 4.07), (1012, 28, 'Catherine', 4.44), (1013, 47, 'Dave', 4.81), (1014, 16, 'Eva', 5.18), (1015, 35, 'Frank', 5.55), (1016, 4, 'Grace', 5.92), (1017, 23, 'Henry', 6.29), (1018, 42, 'Irene', 6.66), (1019, 11, 'Jack', 7.03), (1020, 30, 'Alice', 7.40), (1021, 49, 'Bob', 7.77), (1022, 18, 'Catherine', 8.14), (1023, 37, 'Dave', 8.51), (1024, 6, 'Eva', 8.88), (1025, 25, 'Frank', 9.25), (1026, 44, 'Grace', 9.62), (1027, 13, 'Henry', 9.99), (1028, 32, 'Irene', 0.36), (1029, 1, 'Jack', 0.73), (1030, 20, 'Alice', 1.10), (1031, 39, 'Bob', 1.47), (1032, 8, 'Catherine', 1.84), (1033, 27, 'Dave', 2.21), (1034, 46, 'Eva', 2.58), (1035, 15, 'Frank', 2.95), (1036, 34, 'Grace', 3.32), (1037, 3, 'Henry', 3.69), (1038, 22, 'Irene', 4.06), (1039, 41, 'Jack', 4.43), (1040, 10, 'Alice', 4.80), (1041, 29, 'Bob', 5.17), (1042, 48, 'Catherine', 5.54), (1043, 17, 'Dave', 5.91), (1044, 36, 'Eva', 6.28), (1045, 5, 'Frank', 6.65), (1046, 24, 'Grace', 7.02), (1047, 43, 'Henry', 7.39), (1048, 12, 'Irene', 7.76), (1049, 31, 'Jack', 8.13), (1050, 0, 'Alice', 8.50), (1051, 19, 'Bob', 8.87), (1052, 38, 'Catherine', 9.24), (1053, 7, 'Dave', 9.61), (1054, 26, 'Eva', 9.98), (1055, 45, 'Frank', 0.35), (1056, 14, 'Grace', 0.72), (1057, 33, 'Henry', 1.09), (1058, 2, 'Irene', 1.46), (1059, 21, 'Jack', 1.83), (1060, 40, 'Alice', 2.20), (1061, 9, 'Bob', 2.57), (1062, 28, 'Catherine', 2.94), (1063, 47, 'Dave', 3.31), (1064, 16, 'Eva', 3.68), (1065, 35, 'Frank', 4.05), (1066, 4, 'Grace', 4.42), (1067, 23, 'Henry', 4.79), (1068, 42, 'Irene', 5.16), (1069, 11, 'Jack', 5.53), (1070, 30, 'Alice', 5.90), (1071, 49, 'Bob', 6.27), (1072, 18, 'Catherine', 6.64), (1073, 37, 'Dave', 7.01), (1074, 6, 'Eva', 7.38), (1075, 25, 'Frank', 7.75), (1076, 44, 'Grace', 8.12), (1077, 13, 'Henry', 8.49), (1078, 32, 'Irene', 8.86), (1079, 1, 'Jack', 9.23), (1080, 20, 'Alice', 9.60), (1081, 39, 'Bob', 9.97), (1082, 8, 'Catherine', 0.34), (1083, 27, 'Dave', 0.71), (1084, 46, 'Eva', 1.08), (1085, 15, 'Frank', 1.45), (1086, 34, 'Grace', 1.82), (1087, 3, 'Henry', 2.19), (1088, 22, 'Irene', 2.56), (1089, 41, 'Jack', 2.93), (1090, 10, 'Alice', 3.30), (1091, 29, 'Bob', 3.67), (1092, 48, 'Catherine', 4.04), (1093, 17, 'Dave', 4.41), (1094, 36, 'Eva', 4.78), (1095, 5, 'Frank', 5.15), (1096, 24, 'Grace', 5.52), (1097, 43, 'Henry', 5.89), (1098, 12, 'Irene', 6.26), (1099, 31, 'Jack', 6.63), (1100, 0, 'Alice', 7.00);
+INSERT INTO t VALUES (1101, 19, 'Bob', 7.37), (1102, 38, 'Catherine', 7.74), (1103, 7, 'Dave', 8.11), (1104, 26, 'Eva', 8.48), (1105, 45, 'Frank', 8.85), (1106, 14, 'Grace', 9.22), (1107, 33, 'Henry', 9.59), (1108, 2, 'Irene', 9.96), (1109, 21, 'Jack', 0.33), (1110, 40, 'Alice', 0.70), (1111, 9, 'Bob', 1.07), (1112, 28, 'Catherine', 1.44), (1113, 47, 'Dave', 1.81), (1114, 16, 'Eva', 2.18), (1115, 35, 'Frank', 2.55), (1116, 4, 'Grace', 2.92), (1117, 23, 'Henry', 3.29), (1118, 42, 'Irene', 3.66), (1119, 11, 'Jack', 4.03), (1120, 30, 'Alice', 4.40), (1121, 49, 'Bob', 4.77), (1122, 18, 'Catherine', 5.14), (1123, 37, 'Dave', 5.51), (1124, 6, 'Eva', 5.88), (1125, 25, 'Frank', 6.25), (1126, 44, 'Grace', 6.62), (1127, 13, 'Henry', 6.99), (1128, 32, 'Irene', 7.36), (1129, 1, 'Jack', 7.73), (1130, 20, 'Alice', 8.10), (1131, 39, 'Bob', 8.47), (1132, 8, 'Catherine', 8.84), (1133, 27, 'Dave', 9.21), (1134, 46, 'Eva', 9.58), (1135, 15, 'Frank', 9.95), (1136, 34, 'Grace', 0.32), (1137, 3, 'Henry', 0.69), (1138, 22, 'Irene', 1.06), (1139, 41, 'Jack', 1.43), (1140, 10, 'Alice', 1.80), (1141, 29, 'Bob', 2.17), (1142, 48, 'Catherine', 2.54), (1143, 17, 'Dave', 2.91), (1144, 36, 'Eva', 3.28), (1145, 5, 'Frank', 3.65), (1146, 24, 'Grace', 4.02), (1147, 43, 'Henry', 4.39), (1148, 12, 'Irene', 4.76), (1149, 31, 'Jack', 5.13), (1150, 0, 'Alice', 5.50), (1151, 19, 'Bob', 5.87), (1152, 38, 'Catherine', 6.24), (1153, 7, 'Dave', 6.61), (1154, 26, 'Eva', 6.98), (1155, 45, 'Frank', 7.35), (1156, 14, 'Grace', 7.72), (1157, 33, 'Henry', 8.09), (1158, 2, 'Irene', 8.46), (1159, 21, 'Jack', 8.83), (1160, 40, 'Alice', 9.20), (1161, 9, 'Bob', 9.57), (1162, 28, 'Catherine', 9.94), (1163, 47, 'Dave', 0.31), (1164, 16, 'Eva', 0.68), (1165, 35, 'Frank', 1.05), (1166, 4, 'Grace', 1.42), (1167, 23, 'Henry', 1.79), (1168, 42, 'Irene', 2.16), (1169, 11, 'Jack', 2.53), (1170, 30, 'Alice', 2.90), (1171, 49, 'Bob', 3.27), (1172, 18, 'Catherine', 3.64), (1173, 37, 'Dave', 4.01), (1174, 6, 'Eva', 4.38), (1175, 25, 'Frank', 4.75), (1176, 44, 'Grace', 5.12), (1177, 13, 'Henry', 5.49), (1178, 32, 'Irene', 5.86), (1179, 1, 'Jack', 6.23), (1180, 20, 'Alice', 6.60), (1181, 39, 'Bob', 6.97), (1182, 8, 'Catherine', 7.34), (1183, 27, 'Dave', 7.71), (1184, 46, 'Eva', 8.08), (1185, 15, 'Frank', 8.45), (1186, 34, 'Grace', 8.82), (1187, 3, 'Henry', 9.19), (1188, 22, 'Irene', 9.56), (1189, 41, 'Jack', 9.93), (1190, 10, 'Alice', 0.30), (1191, 29, 'Bob', 0.67), (1192, 48, 'Catherine', 1.04), (1193, 17, 'Dave', 1.41), (1194, 36, 'Eva', 1.78), (1195, 5, 'Frank', 2.15), (1196, 24, 'Grace', 2.52), (1197, 43, 'Henry', 2.89), (1198, 12, 'Irene', 3.26), (1199, 31, 'Jack', 3.63), (1200, 0, 'Alice', 4.00);
+INSERT INTO t VALUES (1201, 19, 'Bob', 4.37), (1202, 38, 'Catherine', 4.74), (1203, 7, 'Dave', 5.11), (1204, 26, 'Eva', 5.48), (1205, 45, 'Frank', 5.85), (1206, 14, 'Grace', 6.22), (1207, 33, 'Henry', 6.59), (1208, 2, 'Irene', 6.96), (1209, 21, 'Jack', 7.33), (1210, 40, 'Alice', 7.70), (1211, 9, 'Bob', 8.07), (1212, 28, 'Catherine', 8.44), (1213, 47, 'Dave', 8.81), (1214, 16, 'Eva', 9.18), (1215, 35, 'Frank', 9.55), (1216, 4, 'Grace', 9.92), (1217, 23, 'Henry', 0.29), (1218, 42, 'Irene', 0.66), (1219, 11, 'Jack', 1.03), (1220, 30, 'Alice', 1.40), (1221, 49, 'Bob', 1.77), (1222, 18, 'Catherine', 2.14), (1223, 37, 'Dave', 2.51), (1224, 6, 'Eva', 2.88), (1225, 25, 'Frank', 3.25), (1226, 44, 'Grace', 3.62), (1227, 13, 'Henry', 3.99), (1228, 32, 'Irene', 4.36), (1229, 1, 'Jack', 4.73), (1230, 20, 'Alice', 5.10), (1231, 39, 'Bob', 5.47), (1232, 8, 'Catherine', 5.84), (1233, 27, 'Dave', 6.21), (1234, 46, 'Eva', 6.58), (1235, 15, 'Frank', 6.95), (1236, 34, 'Grace', 7.32), (1237, 3, 'Henry', 7.69), (1238, 22, 'Irene', 8.06), (1239, 41, 'Jack', 8.43), (1240, 10, 'Alice', 8.80), (1241, 29, 'Bob', 9.17), (1242, 48, 'Catherine', 9.54), (1243, 17, 'Dave', 9.91), (1244, 36, 'Eva', 0.28), (1245, 5, 'Frank', 0.65), (1246, 24, 'Grace', 1.02), (1247, 43, 'Henry', 1.39), (1248, 12, 'Irene', 1.76), (1249, 31, 'Jack', 2.13), (1250, 0, 'Alice', 2.50), (1251, 19, 'Bob', 2.87), (1252, 38, 'Catherine', 3.24), (1253, 7, 'Dave', 3.61), (1254, 26, 'Eva', 3.98), (1255, 45, 'Frank', 4.35), (1256, 14, 'Grace', 4.72), (1257, 33, 'Henry', 5.09), (1258, 2, 'Irene', 5.46), (1259, 21, 'Jack', 5.83), (1260, 40, 'Alice', 6.20), (1261, 9, 'Bob', 6.57), (1262, 28, 'Catherine', 6.94), (1263, 47, 'Dave', 7.31), (1264, 16, 'Eva', 7.68), (1265, 35, 'Frank', 8.05), (1266, 4, 'Grace', 8.42), (1267, 23, 'Henry', 8.79), (1268, 42, 'Irene', 9.16), (1269, 11, 'Jack', 9.53), (1270, 30, 'Alice', 9.90), (1271, 49, 'Bob', 0.27), (1272, 18, 'Catherine', 0.64), (1273, 37, 'Dave', 1.01), (1274, 6, 'Eva', 1.38), (1275, 25, 'Frank', 1.75), (1276, 44, 'Grace', 2.12), (1277, 13, 'Henry', 2.49), (1278, 32, 'Irene', 2.86), (1279, 1, 'Jack', 3.23), (1280, 20, 'Alice', 3.60), (1281, 39, 'Bob', 3.97), (1282, 8, 'Catherine', 4.34), (1283, 27, 'Dave', 4.71), (1284, 46, 'Eva', 5.08), (1285, 15, 'Frank', 5.45), (1286, 34, 'Grace', 5.82), (1287, 3, 'Henry', 6.19), (1288, 22, 'Irene', 6.56), (1289, 41, 'Jack', 6.93), (1290, 10, 'Alice', 7.30), (1291, 29, 'Bob', 7.67), (1292, 48, 'Catherine', 8.04), (1293, 17, 'Dave', 8.41), (1294, 36, 'Eva', 8.78), (1295, 5, 'Frank', 9.15), (1296, 24, 'Grace', 9.52), (1297, 43, 'Henry', 9.89), (1298, 12, 'Irene', 0.26), (1299, 31, 'Jack', 0.63), (1300, 0, 'Alice', 1.00);
+INSERT INTO t VALUES (1301, 19, 'Bob', 1.37), (1302, 38, 'Catherine', 1.74), (1303, 7, 'Dave', 2.11), (1304, 26, 'Eva', 2.48), (1305, 45, 'Frank', 2.85), (1306, 14, 'Grace', 3.22), (1307, 33, 'Henry', 3.59), (1308, 2, 'Irene', 3.96), (1309, 21, 'Jack', 4.33), (1310, 40, 'Alice', 4.70), (1311, 9, 'Bob', 5.07), (1312, 28, 'Catherine', 5.44), (1313, 47, 'Dave', 5.81), (1314, 16, 'Eva', 6.18), (1315, 35, 'Frank', 6.55), (1316, 4, 'Grace', 6.92), (1317, 23, 'Henry', 7.29), (1318, 42, 'Irene', 7.66), (1319, 11, 'Jack', 8.03), (1320, 30, 'Alice', 8.40), (1321, 49, 'Bob', 8.77), (1322, 18, 'Catherine', 9.14), (1323, 37, 'Dave', 9.51), (1324, 6, 'Eva', 9.88), (1325, 25, 'Frank', 0.25), (1326, 44, 'Grace', 0.62), (1327, 13, 'Henry', 0.99), (1328, 32, 'Irene', 1.36), (1329, 1, 'Jack', 1.73), (1330, 20, 'Alice', 2.10), (1331, 39, 'Bob', 2.47), (1332, 8, 'Catherine', 2.84), (1333, 27, 'Dave', 3.21), (1334, 46, 'Eva', 3.58), (1335, 15, 'Frank', 3.95), (1336, 34, 'Grace', 4.32), (1337, 3, 'Henry', 4.69), (1338, 22, 'Irene', 5.06), (1339, 41, 'Jack', 5.43), (1340, 10, 'Alice', 5.80), (1341, 29, 'Bob', 6.17), (1342, 48, 'Catherine', 6.54), (1343, 17, 'Dave', 6.91), (1344, 36, 'Eva', 7.28), (1345, 5, 'Frank', 7.65), (1346, 24, 'Grace', 8.02), (1347, 43, 'Henry', 8.39), (1348, 12, 'Irene', 8.76), (1349, 31, 'Jack', 9.13), (1350, 0, 'Alice', 9.50), (1351, 19, 'Bob', 9.87), (1352, 38, 'Catherine', 0.24), (1353, 7, 'Dave', 0.61), (1354, 26, 'Eva', 0.98), (1355, 45, 'Frank', 1.35), (1356, 14, 'Grace', 1.72), (1357, 33, 'Henry', 2.09), (1358, 2, 'Irene', 2.46), (1359, 21, 'Jack', 2.83), (1360, 40, 'Alice', 3.20), (1361, 9, 'Bob', 3.57), (1362, 28, 'Catherine', 3.94), (1363, 47, 'Dave', 4.31), (1364, 16, 'Eva', 4.68), (1365, 35, 'Frank', 5.05), (1366, 4, 'Grace', 5.42), (1367, 23, 'Henry', 5.79), (1368, 42, 'Irene', 6.16), (1369, 11, 'Jack', 6.53), (1370, 30, 'Alice', 6.90), (1371, 49, 'Bob', 7.27), (1372, 18, 'Catherine', 7.64), (1373, 37, 'Dave', 8.01), (1374, 6, 'Eva', 8.38), (1375, 25, 'Frank', 8.75), (1376, 44, 'Grace', 9.12), (1377, 13, 'Henry', 9.49), (1378, 32, 'Irene', 9.86), (1379, 1, 'Jack', 0.23), (1380, 20, 'Alice', 0.60), (1381, 39, 'Bob', 0.97), (1382, 8, 'Catherine', 1.34), (1383, 27, 'Dave', 1.71), (1384, 46, 'Eva', 2.08), (1385, 15, 'Frank', 2.45), (1386, 34, 'Grace', 2.82), (1387, 3, 'Henry', 3.19), (1388, 22, 'Irene', 3.56), (1389, 41, 'Jack', 3.93), (1390, 10, 'Alice', 4.30), (1391, 29, 'Bob', 4.67), (1392, 48, 'Catherine', 5.04), (1393, 17, 'Dave', 5.41), (1394, 36, 'Eva', 5.78), (1395, 5, 'Frank', 6.15), (1396, 24, 'Grace', 6.52), (1397, 43, 'Henry', 6.89), (1398, 12, 'Irene', 7.26), (1399, 31, 'Jack', 7.63), (1400, 0, 'Alice', 8.00);
+INSERT INTO t VALUES (1401, 19, 'Bob', 8.37), (1402, 38, 'Catherine', 8.74), (1403, 7, 'Dave', 9.11), (1404, 26, 'Eva', 9.48), (1405, 45, 'Frank', 9.85), (1406, 14, 'Grace', 0.22), (1407, 33, 'Henry', 0.59), (1408, 2, 'Irene', 0.96), (1409, 21, 'Jack', 1.33), (1410, 40, 'Alice', 1.70), (1411, 9, 'Bob', 2.07), (1412, 28, 'Catherine', 2.44), (1413, 47, 'Dave', 2.81), (1414, 16, 'Eva', 3.18), (1415, 35, 'Frank', 3.55), (1416, 4, 'Grace', 3.92), (1417, 23, 'Henry', 4.29), (1418, 42, 'Irene', 4.66), (1419, 11, 'Jack', 5.03), (1420, 30, 'Alice', 5.40), (1421, 49, 'Bob', 5.77), (1422, 18, 'Catherine', 6.14), (1423, 37, 'Dave', 6.51), (1424, 6, 'Eva', 6.88), (1425, 25, 'Frank', 7.25), (1426, 44, 'Grace', 7.62), (1427, 13, 'Henry', 7.99), (1428, 32, 'Irene', 8.36), (1429, 1, 'Jack', 8.73), (1430, 20, 'Alice', 9.10), (1431, 39, 'Bob', 9.47), (1432, 8, 'Catherine', 9.84), (1433, 27, 'Dave', 0.21), (1434, 46, 'Eva', 0.58), (1435, 15, 'Frank', 0.95), (1436, 34, 'Grace', 1.32), (1437, 3, 'Henry', 1.69), (1438, 22, 'Irene', 2.06), (1439, 41, 'Jack', 2.43), (1440, 10, 'Alice', 2.80), (1441, 29, 'Bob', 3.17), (1442, 48, 'Catherine', 3.54), (1443, 17, 'Dave', 3.91), (1444, 36, 'Eva', 4.28), (1445, 5, 'Frank', 4.65), (1446, 24, 'Grace', 5.02), (1447, 43, 'Henry', 5.39), (1448, 12, 'Irene', 5.76), (1449, 31, 'Jack', 6.13), (1450, 0, 'Alice', 6.50), (1451, 19, 'Bob', 6.87), (1452, 38, 'Catherine', 7.24), (1453, 7, 'Dave', 7.61), (1454, 26, 'Eva', 7.98), (1455, 45, 'Frank', 8.35), (1456, 14, 'Grace', 8.72), (1457, 33, 'Henry', 9.09), (1458, 2, 'Irene', 9.46), (1459, 21, 'Jack', 9.83), (1460, 40, 'Alice', 0.20), (1461, 9, 'Bob', 0.57), (1462, 28, 'Catherine', 0.94), (1463, 47, 'Dave', 1.31), (1464, 16, 'Eva', 1.68), (1465, 35, 'Frank', 2.05), (1466, 4, 'Grace', 2.42), (1467, 23, 'Henry', 2.79), (1468, 42, 'Irene', 3.16), (1469, 11, 'Jack', 3.53), (1470, 30, 'Alice', 3.90), (1471, 49, 'Bob', 4.27), (1472, 18, 'Catherine', 4.64), (1473, 37, 'Dave', 5.01), (1474, 6, 'Eva', 5.38), (1475, 25, 'Frank', 5.75), (1476, 44, 'Grace', 6.12), (1477, 13, 'Henry', 6.49), (1478, 32, 'Irene', 6.86), (1479, 1, 'Jack', 7.23), (1480, 20, 'Alice', 7.60), (1481, 39, 'Bob', 7.97), (1482, 8, 'Catherine', 8.34), (1483, 27, 'Dave', 8.71), (1484, 46, 'Eva', 9.08), (1485, 15, 'Frank', 9.45), (1486, 34, 'Grace', 9.82), (1487, 3, 'Henry', 0.19), (1488, 22, 'Irene', 0.56), (1489, 41, 'Jack', 0.93), (1490, 10, 'Alice', 1.30), (1491, 29, 'Bob', 1.67), (1492, 48, 'Catherine', 2.04), (1493, 17, 'Dave', 2.41), (1494, 36, 'Eva', 2.78), (1495, 5, 'Frank', 3.15), (1496, 24, 'Grace', 3.52), (1497, 43, 'Henry', 3.89), (1498, 12, 'Irene', 4.26), (1499, 31, 'Jack', 4.63), (1500, 0, 'Alice', 5.00);
+INSERT INTO t VALUES (1501, 19, 'Bob', 5.37), (1502, 38, 'Catherine', 5.74), (1503, 7, 'Dave', 6.11), (1504, 26, 'Eva', 6.48), (1505, 45, 'Frank', 6.85), (1506, 14, 'Grace', 7.22), (1507, 33, 'Henry', 7.59), (1508, 2, 'Irene', 7.96), (1509, 21, 'Jack', 8.33), (1510, 40, 'Alice', 8.70), (1511, 9, 'Bob', 9.07), (1512, 28, 'Catherine', 9.44), (1513, 47, 'Dave', 9.81), (1514, 16, 'Eva', 0.18), (1515, 35, 'Frank', 0.55), (1516, 4, 'Grace', 0.92), (1517, 23, 'Henry', 1.29), (1518, 42, 'Irene', 1.66), (1519, 11, 'Jack', 2.03), (1520, 30, 'Alice', 2.40), (1521, 49, 'Bob', 2.77), (1522, 18, 'Catherine', 3.14), (1523, 37, 'Dave', 3.51), (1524, 6, 'Eva', 3.88), (1525, 25, 'Frank', 4.25), (1526, 44, 'Grace', 4.62), (1527, 13, 'Henry', 4.99), (1528, 32, 'Irene', 5.36), (1529, 1, 'Jack', 5.73), (1530, 20, 'Alice', 6.10), (1531, 39, 'Bob', 6.47), (1532, 8, 'Catherine', 6.84), (1533, 27, 'Dave', 7.21), (1534, 46, 'Eva', 7.58), (1535, 15, 'Frank', 7.95), (1536, 34, 'Grace', 8.32), (1537, 3, 'Henry', 8.69), (1538, 22, 'Irene', 9.06), (1539, 41, 'Jack', 9.43), (1540, 10, 'Alice', 9.80), (1541, 29, 'Bob', 0.17), (1542, 48, 'Catherine', 0.54), (1543, 17, 'Dave', 0.91), (1544, 36, 'Eva', 1.28), (1545, 5, 'Frank', 1.65), (1546, 24, 'Grace', 2.02), (1547, 43, 'Henry', 2.39), (1548, 12, 'Irene', 2.76), (1549, 31, 'Jack', 3.13), (1550, 0, 'Alice', 3.50), (1551, 19, 'Bob', 3.87), (1552, 38, 'Catherine', 4.24), (1553, 7, 'Dave', 4.61), (1554, 26, 'Eva', 4.98), (1555, 45, 'Frank', 5.35), (1556, 14, 'Grace', 5.72), (1557, 33, 'Henry', 6.09), (1558, 2, 'Irene', 6.46), (1559, 21, 'Jack', 6.83), (1560, 40, 'Alice', 7.20), (1561, 9, 'Bob', 7.57), (1562, 28, 'Catherine', 7.94), (1563, 47, 'Dave', 8.31), (1564, 16, 'Eva', 8.68), (1565, 35, 'Frank', 9.05), (1566, 4, 'Grace', 9.42), (1567, 23, 'Henry', 9.79), (1568, 42, 'Irene', 0.16), (1569, 11, 'Jack', 0.53), (1570, 30, 'Alice', 0.90), (1571, 49, 'Bob', 1.27), (1572, 18, 'Catherine', 1.64), (1573, 37, 'Dave', 2.01), (1574, 6, 'Eva', 2.38), (1575, 25, 'Frank', 2.75), (1576, 44, 'Grace', 3.12), (1577, 13, 'Henry', 3.49), (1578, 32, 'Irene', 3.86), (1579, 1, 'Jack', 4.23), (1580, 20, 'Alice', 4.60), (1581, 39, 'Bob', 4.97), (1582, 8, 'Catherine', 5.34), (1583, 27, 'Dave', 5.71), (1584, 46, 'Eva', 6.08), (1585, 15, 'Frank', 6.45), (1586, 34, 'Grace', 6.82), (1587, 3, 'Henry', 7.19), (1588, 22, 'Irene', 7.56), (1589, 41, 'Jack', 7.93), (1590, 10, 'Alice', 8.30), (1591, 29, 'Bob', 8.67), (1592, 48, 'Catherine', 9.04), (1593, 17, 'Dave', 9.41), (1594, 36, 'Eva', 9.78), (1595, 5, 'Frank', 0.15), (1596, 24, 'Grace', 0.52), (1597, 43, 'Henry', 0.89), (1598, 12, 'Irene', 1.26), (1599, 31, 'Jack', 1.63), (1600, 0, 'Alice', 2.00);
+INSERT INTO t VALUES (1601, 19, 'Bob', 2.37), (1602, 38, 'Catherine', 2.74), (1603, 7, 'Dave', 3.11), (1604, 26, 'Eva', 3.48), (1605, 45, 'Frank', 3.85), (1606, 14, 'Grace', 4.22), (1607, 33, 'Henry', 4.59), (1608, 2, 'Irene', 4.96), (1609, 21, 'Jack', 5.33), (1610, 40, 'Alice', 5.70), (1611, 9, 'Bob', 6.07), (1612, 28, 'Catherine', 6.44), (1613, 47, 'Dave', 6.81), (1614, 16, 'Eva', 7.18), (1615, 35, 'Frank', 7.55), (1616, 4, 'Grace', 7.92), (1617, 23, 'Henry', 8.29), (1618, 42, 'Irene', 8.66), (1619, 11, 'Jack', 9.03), (1620, 30, 'Alice', 9.40), (1621, 49, 'Bob', 9.77), (1622, 18, 'Catherine', 0.14), (1623, 37, 'Dave', 0.51), (1624, 6, 'Eva', 0.88), (1625, 25, 'Frank', 1.25), (1626, 44, 'Grace', 1.62), (1627, 13, 'Henry', 1.99), (1628, 32, 'Irene', 2.36), (1629, 1, 'Jack', 2.73), (1630, 20, 'Alice', 3.10), (1631, 39, 'Bob', 3.47), (1632, 8, 'Catherine', 3.84), (1633, 27, 'Dave', 4.21), (1634, 46, 'Eva', 4.58), (1635, 15, 'Frank', 4.95), (1636, 34, 'Grace', 5.32), (1637, 3, 'Henry', 5.69), (1638, 22, 'Irene', 6.06), (1639, 41, 'Jack', 6.43), (1640, 10, 'Alice', 6.80), (1641, 29, 'Bob', 7.17), (1642, 48, 'Catherine', 7.54), (1643, 17, 'Dave', 7.91), (1644, 36, 'Eva', 8.28), (1645, 5, 'Frank', 8.65), (1646, 24, 'Grace', 9.02), (1647, 43, 'Henry', 9.39), (1648, 12, 'Irene', 9.76), (1649, 31, 'Jack', 0.13), (1650, 0, 'Alice', 0.50), (1651, 19, 'Bob', 0.87), (1652, 38, 'Catherine', 1.24), (1653, 7, 'Dave', 1.61), (1654, 26, 'Eva', 1.98), (1655, 45, 'Frank', 2.35), (1656, 14, 'Grace', 2.72), (1657, 33, 'Henry', 3.09), (1658, 2, 'Irene', 3.46), (1659, 21, 'Jack', 3.83), (1660, 40, 'Alice', 4.20), (1661, 9, 'Bob', 4.57), (1662, 28, 'Catherine', 4.94), (1663, 47, 'Dave', 5.31), (1664, 16, 'Eva', 5.68), (1665, 35, 'Frank', 6.05), (1666, 4, 'Grace', 6.42), (1667, 23, 'Henry', 6.79), (1668, 42, 'Irene', 7.16), (1669, 11, 'Jack', 7.53), (1670, 30, 'Alice', 7.90), (1671, 49, 'Bob', 8.27), (1672, 18, 'Catherine', 8.64), (1673, 37, 'Dave', 9.01), (1674, 6, 'Eva', 9.38), (1675, 25, 'Frank', 9.75), (1676, 44, 'Grace', 0.12), (1677, 13, 'Henry', 0.49), (1678, 32, 'Irene', 0.86), (1679, 1, 'Jack', 1.23), (1680, 20, 'Alice', 1.60), (1681, 39, 'Bob', 1.97), (1682, 8, 'Catherine', 2.34), (1683, 27, 'Dave', 2.71), (1684, 46, 'Eva', 3.08), (1685, 15, 'Frank', 3.45), (1686, 34, 'Grace', 3.82), (1687, 3, 'Henry', 4.19), (1688, 22, 'Irene', 4.56), (1689, 41, 'Jack', 4.93), (1690, 10, 'Alice', 5.30), (1691, 29, 'Bob', 5.67), (1692, 48, 'Catherine', 6.04), (1693, 17, 'Dave', 6.41), (1694, 36, 'Eva', 6.78), (1695, 5, 'Frank', 7.15), (1696, 24, 'Grace', 7.52), (1697, 43, 'Henry', 7.89), (1698, 12, 'Irene', 8.26), (1699, 31, 'Jack', 8.63), (1700, 0, 'Alice', 9.00);
+INSERT INTO t VALUES (1701, 19, 'Bob', 9.37), (1702, 38, 'Catherine', 9.74), (1703, 7, 'Dave', 0.11), (1704, 26, 'Eva', 0.48), (1705, 45, 'Frank', 0.85), (1706, 14, 'Grace', 1.22), (1707, 33, 'Henry', 1.59), (1708, 2, 'Irene', 1.96), (1709, 21, 'Jack', 2.33), (1710, 40, 'Alice', 2.70), (1711, 9, 'Bob', 3.07), (1712, 28, 'Catherine', 3.44), (1713, 47, 'Dave', 3.81), (1714, 16, 'Eva', 4.18), (1715, 35, 'Frank', 4.55), (1716, 4, 'Grace', 4.92), (1717, 23, 'Henry', 5.29), (1718, 42, 'Irene', 5.66), (1719, 11, 'Jack', 6.03), (1720, 30, 'Alice', 6.40), (1721, 49, 'Bob', 6.77), (1722, 18, 'Catherine', 7.14), (1723, 37, 'Dave', 7.51), (1724, 6, 'Eva', 7.88), (1725, 25, 'Frank', 8.25), (1726, 44, 'Grace', 8.62), (1727, 13, 'Henry', 8.99), (1728, 32, 'Irene', 9.36), (1729, 1, 'Jack', 9.73), (1730, 20, 'Alice', 0.10), (1731, 39, 'Bob', 0.47), (1732, 8, 'Catherine', 0.84), (1733, 27, 'Dave', 1.21), (1734, 46, 'Eva', 1.58), (1735, 15, 'Frank', 1.95), (1736, 34, 'Grace', 2.32), (1737, 3, 'Henry', 2.69), (1738, 22, 'Irene', 3.06), (1739, 41, 'Jack', 3.43), (1740, 10, 'Alice', 3.80), (1741, 29, 'Bob', 4.17), (1742, 48, 'Catherine', 4.54), (1743, 17, 'Dave', 4.91), (1744, 36, 'Eva', 5.28), (1745, 5, 'Frank', 5.65), (1746, 24, 'Grace', 6.02), (1747, 43, 'Henry', 6.39), (1748, 12, 'Irene', 6.76), (1749, 31, 'Jack', 7.13), (1750, 0, 'Alice', 7.50), (1751, 19, 'Bob', 7.87), (1752, 38, 'Catherine', 8.24), (1753, 7, 'Dave', 8.61), (1754, 26, 'Eva', 8.98), (1755, 45, 'Frank', 9.35), (1756, 14, 'Grace', 9.72), (1757, 33, 'Henry', 0.09), (1758, 2, 'Irene', 0.46), (1759, 21, 'Jack', 0.83), (1760, 40, 'Alice', 1.20), (1761, 9, 'Bob', 1.57), (1762, 28, 'Catherine', 1.94), (1763, 47, 'Dave', 2.31), (1764, 16, 'Eva', 2.68), (1765, 35, 'Frank', 3.05), (1766, 4, 'Grace', 3.42), (1767, 23, 'Henry', 3.79), (1768, 42, 'Irene', 4.16), (1769, 11, 'Jack', 4.53), (1770, 30, 'Alice', 4.90), (1771, 49, 'Bob', 5.27), (1772, 18, 'Catherine', 5.64), (1773, 37, 'Dave', 6.01), (1774, 6, 'Eva', 6.38), (1775, 25, 'Frank', 6.75), (1776, 44, 'Grace', 7.12), (1777, 13, 'Henry', 7.49), (1778, 32, 'Irene', 7.86), (1779, 1, 'Jack', 8.23), (1780, 20, 'Alice', 8.60), (1781, 39, 'Bob', 8.97), (1782, 8, 'Catherine', 9.34), (1783, 27, 'Dave', 9.71), (1784, 46, 'Eva', 0.08), (1785, 15, 'Frank', 0.45), (1786, 34, 'Grace', 0.82), (1787, 3, 'Henry', 1.19), (1788, 22, 'Irene', 1.56), (1789, 41, 'Jack', 1.93), (1790, 10, 'Alice', 2.30), (1791, 29, 'Bob', 2.67), (1792, 48, 'Catherine', 3.04), (1793, 17, 'Dave', 3.41), (1794, 36, 'Eva', 3.78), (1795, 5, 'Frank', 4.15), (1796, 24, 'Grace', 4.52), (1797, 43, 'Henry', 4.89), (1798, 12, 'Irene', 5.26), (1799, 31, 'Jack', 5.63), (1800, 0, 'Alice', 6.00);
+INSERT INTO t VALUES (1801, 19, 'Bob', 6.37), (1802, 38, 'Catherine', 6.74), (1803, 7, 'Dave', 7.11), (1804, 26, 'Eva', 7.48), (1805, 45, 'Frank', 7.85), (1806, 14, 'Grace', 8.22), (1807, 33, 'Henry', 8.59), (1808, 2, 'Irene', 8.96), (1809, 21, 'Jack', 9.33), (1810, 40, 'Alice', 9.70), (1811, 9, 'Bob', 0.07), (1812, 28, 'Catherine', 0.44), (1813, 47, 'Dave', 0.81), (1814, 16, 'Eva', 1.18), (1815, 35, 'Frank', 1.55), (1816, 4, 'Grace', 1.92), (1817, 23, 'Henry', 2.29), (1818, 42, 'Irene', 2.66), (1819, 11, 'Jack', 3.03), (1820, 30, 'Alice', 3.40), (1821, 49, 'Bob', 3.77), (1822, 18, 'Catherine', 4.14), (1823, 37, 'Dave', 4.51), (1824, 6, 'Eva', 4.88), (1825, 25, 'Frank', 5.25), (1826, 44, 'Grace', 5.62), (1827, 13, 'Henry', 5.99), (1828, 32, 'Irene', 6.36), (1829, 1, 'Jack', 6.73), (1830, 20, 'Alice', 7.10), (1831, 39, 'Bob', 7.47), (1832, 8, 'Catherine', 7.84), (1833, 27, 'Dave', 8.21), (1834, 46, 'Eva', 8.58), (1835, 15, 'Frank', 8.95), (1836, 34, 'Grace', 9.32), (1837, 3, 'Henry', 9.69), (1838, 22, 'Irene', 0.06), (1839, 41, 'Jack', 0.43), (1840, 10, 'Alice', 0.80), (1841, 29, 'Bob', 1.17), (1842, 48, 'Catherine', 1.54), (1843, 17, 'Dave', 1.91), (1844, 36, 'Eva', 2.28), (1845, 5, 'Frank', 2.65), (1846, 24, 'Grace', 3.02), (1847, 43, 'Henry', 3.39), (1848, 12, 'Irene', 3.76), (1849, 31, 'Jack', 4.13), (1850, 0, 'Alice', 4.50), (1851, 19, 'Bob', 4.87), (1852, 38, 'Catherine', 5.24), (1853, 7, 'Dave', 5.61), (1854, 26, 'Eva', 5.98), (1855, 45, 'Frank', 6.35), (1856, 14, 'Grace', 6.72), (1857, 33, 'Henry', 7.09), (1858, 2, 'Irene', 7.46), (1859, 21, 'Jack', 7.83), (1860, 40, 'Alice', 8.20), (1861, 9, 'Bob', 8.57), (1862, 28, 'Catherine', 8.94), (1863, 47, 'Dave', 9.31), (1864, 16, 'Eva', 9.68), (1865, 35, 'Frank', 0.05), (1866, 4, 'Grace', 0.42), (1867, 23, 'Henry', 0.79), (1868, 42, 'Irene', 1.16), (1869, 11, 'Jack', 1.53), (1870, 30, 'Alice', 1.90), (1871, 49, 'Bob', 2.27), (1872, 18, 'Catherine', 2.64), (1873, 37, 'Dave', 3.01), (1874, 6, 'Eva', 3.38), (1875, 25, 'Frank', 3.75), (1876, 44, 'Grace', 4.12), (1877, 13, 'Henry', 4.49), (1878, 32, 'Irene', 4.86), (1879, 1, 'Jack', 5.23), (1880, 20, 'Alice', 5.60), (1881, 39, 'Bob', 5.97), (1882, 8, 'Catherine', 6.34), (1883, 27, 'Dave', 6.71), (1884, 46, 'Eva', 7.08), (1885, 15, 'Frank', 7.45), (1886, 34, 'Grace', 7.82), (1887, 3, 'Henry', 8.19), (1888, 22, 'Irene', 8.56), (1889, 41, 'Jack', 8.93), (1890, 10, 'Alice', 9.30), (1891, 29, 'Bob', 9.67), (1892, 48, 'Catherine', 0.04), (1893, 17, 'Dave', 0.41), (1894, 36, 'Eva', 0.78), (1895, 5, 'Frank', 1.15), (1896, 24, 'Grace', 1.52), (1897, 43, 'Henry', 1.89), (1898, 12, 'Irene', 2.26), (1899, 31, 'Jack', 2.63), (1900, 0, 'Alice', 3.00);
+INSERT INTO t VALUES (1901, 19, 'Bob', 3.37), (1902, 38, 'Catherine', 3.74), (1903, 7, 'Dave', 4.11), (1904, 26, 'Eva', 4.48), (1905, 45, 'Frank', 4.85), (1906, 14, 'Grace', 5.22), (1907, 33, 'Henry', 5.59), (1908, 2, 'Irene', 5.96), (1909, 21, 'Jack', 6.33), (1910, 40, 'Alice', 6.70), (1911, 9, 'Bob', 7.07), (1912, 28, 'Catherine', 7.44), (1913, 47, 'Dave', 7.81), (1914, 16, 'Eva', 8.18), (1915, 35, 'Frank', 8.55), (1916, 4, 'Grace', 8.92), (1917, 23, 'Henry', 9.29), (1918, 42, 'Irene', 9.66), (1919, 11, 'Jack', 0.03), (1920, 30, 'Alice', 0.40), (1921, 49, 'Bob', 0.77), (1922, 18, 'Catherine', 1.14), (1923, 37, 'Dave', 1.51), (1924, 6, 'Eva', 1.88), (1925, 25, 'Frank', 2.25), (1926, 44, 'Grace', 2.62), (1927, 13, 'Henry', 2.99), (1928, 32, 'Irene', 3.36), (1929, 1, 'Jack', 3.73), (1930, 20, 'Alice', 4.10), (1931, 39, 'Bob', 4.47), (1932, 8, 'Catherine', 4.84), (1933, 27, 'Dave', 5.21), (1934, 46, 'Eva', 5.58), (1935, 15, 'Frank', 5.95), (1936, 34, 'Grace', 6.32), (1937, 3, 'Henry', 6.69), (1938, 22, 'Irene', 7.06), (1939, 41, 'Jack', 7.43), (1940, 10, 'Alice', 7.80), (1941, 29, 'Bob', 8.17), (1942, 48, 'Catherine', 8.54), (1943, 17, 'Dave', 8.91), (1944, 36, 'Eva', 9.28), (1945, 5, 'Frank', 9.65), (1946, 24, 'Grace', 0.02), (1947, 43, 'Henry', 0.39), (1948, 12, 'Irene', 0.76), (1949, 31, 'Jack', 1.13), (1950, 0, 'Alice', 1.50), (1951, 19, 'Bob', 1.87), (1952, 38, 'Catherine', 2.24), (1953, 7, 'Dave', 2.61), (1954, 26, 'Eva', 2.98), (1955, 45, 'Frank', 3.35), (1956, 14, 'Grace', 3.72), (1957, 33, 'Henry', 4.09), (1958, 2, 'Irene', 4.46), (1959, 21, 'Jack', 4.83), (1960, 40, 'Alice', 5.20), (1961, 9, 'Bob', 5.57), (1962, 28, 'Catherine', 5.94), (1963, 47, 'Dave', 6.31), (1964, 16, 'Eva', 6.68), (1965, 35, 'Frank', 7.05), (1966, 4, 'Grace', 7.42), (1967, 23, 'Henry', 7.79), (1968, 42, 'Irene', 8.16), (1969, 11, 'Jack', 8.53), (1970, 30, 'Alice', 8.90), (1971, 49, 'Bob', 9.27), (1972, 18, 'Catherine', 9.64), (1973, 37, 'Dave', 0.01), (1974, 6, 'Eva', 0.38), (1975, 25, 'Frank', 0.75), (1976, 44, 'Grace', 1.12), (1977, 13, 'Henry', 1.49), (1978, 32, 'Irene', 1.86), (1979, 1, 'Jack', 2.23), (1980, 20, 'Alice', 2.60), (1981, 39, 'Bob', 2.97), (1982, 8, 'Catherine', 3.34), (1983, 27, 'Dave', 3.71), (1984, 46, 'Eva', 4.08), (1985, 15, 'Frank', 4.45), (1986, 34, 'Grace', 4.82), (1987, 3, 'Henry', 5.19), (1988, 22, 'Irene', 5.56), (1989, 41, 'Jack', 5.93), (1990, 10, 'Alice', 6.30), (1991, 29, 'Bob', 6.67), (1992, 48, 'Catherine', 7.04), (1993, 17, 'Dave', 7.41), (1994, 36, 'Eva', 7.78), (1995, 5, 'Frank', 8.15), (1996, 24, 'Grace', 8.52), (1997, 43, 'Henry', 8.89), (1998, 12, 'Irene', 9.26), (1999, 31, 'Jack', 9.63), (2000, 0, 'Alice', 0.00);
+INSERT INTO t VALUES (2001, 19, 'Bob', 0.37), (2002, 38, 'Catherine', 0.74), (2003, 7, 'Dave', 1.11), (2004, 26, 'Eva', 1.48), (2005, 45, 'Frank', 1.85), (2006, 14, 'Grace', 2.22), (2007, 33, 'Henry', 2.59), (2008, 2, 'Irene', 2.96), (2009, 21, 'Jack', 3.33), (2010, 40, 'Alice', 3.70), (2011, 9, 'Bob', 4.07), (2012, 28, 'Catherine', 4.44), (2013, 47, 'Dave', 4.81), (2014, 16, 'Eva', 5.18), (2015, 35, 'Frank', 5.55), (2016, 4, 'Grace', 5.92), (2017, 23, 'Henry', 6.29), (2018, 42, 'Irene', 6.66), (2019, 11, 'Jack', 7.03), (2020, 30, 'Alice', 7.40), (2021, 49, 'Bob', 7.77), (2022, 18, 'Catherine', 8.14), (2023, 37, 'Dave', 8.51), (2024, 6, 'Eva', 8.88), (2025, 25, 'Frank', 9.25), (2026, 44, 'Grace', 9.62), (2027, 13, 'Henry', 9.99), (2028, 32, 'Irene', 0.36), (2029, 1, 'Jack', 0.73), (2030, 20, 'Alice', 1.10), (2031, 39, 'Bob', 1.47), (2032, 8, 'Catherine', 1.84), (2033, 27, 'Dave', 2.21), (2034, 46, 'Eva', 2.58), (2035, 15, 'Frank', 2.95), (2036, 34, 'Grace', 3.32), (2037, 3, 'Henry', 3.69), (2038, 22, 'Irene', 4.06), (2039, 41, 'Jack', 4.43), (2040, 10, 'Alice', 4.80), (2041, 29, 'Bob', 5.17), (2042, 48, 'Catherine', 5.54), (2043, 17, 'Dave', 5.91), (2044, 36, 'Eva', 6.28), (2045, 5, 'Frank', 6.65), (2046, 24, 'Grace', 7.02), (2047, 43, 'Henry', 7.39), (2048, 12, 'Irene', 7.76), (2049, 31, 'Jack', 8.13), (2050, 0, 'Alice', 8.50), (2051, 19, 'Bob', 8.87), (2052, 38, 'Catherine', 9.24), (2053, 7, 'Dave', 9.61), (2054, 26, 'Eva', 9.98), (2055, 45, 'Frank', 0.35), (2056, 14, 'Grace', 0.72), (2057, 33, 'Henry', 1.09), (2058, 2, 'Irene', 1.46), (2059, 21, 'Jack', 1.83), (2060, 40, 'Alice', 2.20), (2061, 9, 'Bob', 2.57), (2062, 28, 'Catherine', 2.94), (2063, 47, 'Dave', 3.31), (2064, 16, 'Eva', 3.68), (2065, 35, 'Frank', 4.05), (2066, 4, 'Grace', 4.42), (2067, 23, 'Henry', 4.79), (2068, 42, 'Irene', 5.16), (2069, 11, 'Jack', 5.53), (2070, 30, 'Alice', 5.90), (2071, 49, 'Bob', 6.27), (2072, 18, 'Catherine', 6.64), (2073, 37, 'Dave', 7.01), (2074, 6, 'Eva', 7.38), (2075, 25, 'Frank', 7.75), (2076, 44, 'Grace', 8.12), (2077, 13, 'Henry', 8.49), (2078, 32, 'Irene', 8.86), (2079, 1, 'Jack', 9.23), (2080, 20, 'Alice', 9.60), (2081, 39, 'Bob', 9.97), (2082, 8, 'Catherine', 0.34), (2083, 27, 'Dave', 0.71), (2084, 46, 'Eva', 1.08), (2085, 15, 'Frank', 1.45), (2086, 34, 'Grace', 1.82), (2087, 3, 'Henry', 2.19), (2088, 22, 'Irene', 2.56), (2089, 41, 'Jack', 2.93), (2090, 10, 'Alice', 3.30), (2091, 29, 'Bob', 3.67), (2092, 48, 'Catherine', 4.04), (2093, 17, 'Dave', 4.41), (2094, 36, 'Eva', 4.78), (2095, 5, 'Frank', 5.15), (2096, 24, 'Grace', 5.52), (2097, 43, 'Henry', 5.89), (2098, 12, 'Irene', 6.26), (2099, 31, 'Jack', 6.63), (2100, 0, 'Alice', 7.00);
+INSERT INTO t VALUES (2101, 19, 'Bob', 7.37), (2102, 38, 'Catherine', 7.74), (2103, 7, 'Dave', 8.11), (2104, 26, 'Eva', 8.48), (2105, 45, 'Frank', 8.85), (2106, 14, 'Grace', 9.22), (2107, 33, 'Henry', 9.59), (2108, 2, 'Irene', 9.96), (2109, 21, 'Jack', 0.33), (2110, 40, 'Alice', 0.70), (2111, 9, 'Bob', 1.07), (2112, 28, 'Catherine', 1.44), (2113, 47, 'Dave', 1.81), (2114, 16, 'Eva', 2.18), (2115, 35, 'Frank', 2.55), (2116, 4, 'Grace', 2.92), (2117, 23, 'Henry', 3.29), (2118, 42, 'Irene', 3.66), (2119, 11, 'Jack', 4.03), (2120, 30, 'Alice', 4.40), (2121, 49, 'Bob', 4.77), (2122, 18, 'Catherine', 5.14), (2123, 37, 'Dave', 5.51), (2124, 6, 'Eva', 5.88), (2125, 25, 'Frank', 6.25), (2126, 44, 'Grace', 6.62), (2127, 13, 'Henry', 6.99), (2128, 32, 'Irene', 7.36), (2129, 1, 'Jack', 7.73), (2130, 20, 'Alice', 8.10), (2131, 39, 'Bob', 8.47), (2132, 8, 'Catherine', 8.84), (2133, 27, 'Dave', 9.21), (2134, 46, 'Eva', 9.58), (2135, 15, 'Frank', 9.95), (2136, 34, 'Grace', 0.32), (2137, 3, 'Henry', 0.69), (2138, 22, 'Irene', 1.06), (2139, 41, 'Jack', 1.43), (2140, 10, 'Alice', 1.80), (2141, 29, 'Bob', 2.17), (2142, 48, 'Catherine', 2.54), (2143, 17, 'Dave', 2.91), (2144, 36, 'Eva', 3.28), (2145, 5, 'Frank', 3.65), (2146, 24, 'Grace', 4.02), (2147, 43, 'Henry', 4.39), (2148, 12, 'Irene', 4.76), (2149, 31, 'Jack', 5.13), (2150, 0, 'Alice', 5.50), (2151, 19, 'Bob', 5.87), (2152, 38, 'Catherine', 6.24), (2153, 7, 'Dave', 6.61), (2154, 26, 'Eva', 6.98), (2155, 45, 'Frank', 7.35), (2156, 14, 'Grace', 7.72), (2157, 33, 'Henry', 8.09), (2158, 2, 'Irene', 8.46), (2159, 21, 'Jack', 8.83), (2160, 40, 'Alice', 9.20), (2161, 9, 'Bob', 9.57), (2162, 28, 'Catherine', 9.94), (2163, 47, 'Dave', 0.31), (2164, 16, 'Eva', 0.68), (2165, 35, 'Frank', 1.05), (2166, 4, 'Grace', 1.42), (2167, 23, 'Henry', 1.79), (2168, 42, 'Irene', 2.16), (2169, 11, 'Jack', 2.53), (2170, 30, 'Alice', 2.90), (2171, 49, 'Bob', 3.27), (2172, 18, 'Catherine', 3.64), (2173, 37, 'Dave', 4.01), (2174, 6, 'Eva', 4.38), (2175, 25, 'Frank', 4.75), (2176, 44, 'Grace', 5.12), (2177, 13, 'Henry', 5.49), (2178, 32, 'Irene', 5.86), (2179, 1, 'Jack', 6.23), (2180, 20, 'Alice', 6.60), (2181, 39, 'Bob', 6.97), (2182, 8, 'Catherine', 7.34), (2183, 27, 'Dave', 7.71), (2184, 46, 'Eva', 8.08), (2185, 15, 'Frank', 8.45), (2186, 34, 'Grace', 8.82), (2187, 3, 'Henry', 9.19), (2188, 22, 'Irene', 9.56), (2189, 41, 'Jack', 9.93), (2190, 10, 'Alice', 0.30), (2191, 29, 'Bob', 0.67), (2192, 48, 'Catherine', 1.04), (2193, 17, 'Dave', 1.41), (2194, 36, 'Eva', 1.78), (2195, 5, 'Frank', 2.15), (2196, 24, 'Grace', 2.52), (2197, 43, 'Henry', 2.89), (2198, 12, 'Irene', 3.26), (2199, 31, 'Jack', 3.63), (2200, 0, 'Alice', 4.00);
+INSERT INTO t VALUES (2201, 19, 'Bob', 4.37), (2202, 38, 'Catherine', 4.74), (2203, 7, 'Dave', 5.11), (2204, 26, 'Eva', 5.48), (2205, 45, 'Frank', 5.85), (2206, 14, 'Grace', 6.22), (2207, 33, 'Henry', 6.59), (2208, 2, 'Irene', 6.96), (2209, 21, 'Jack', 7.33), (2210, 40, 'Alice', 7.70), (2211, 9, 'Bob', 8.07), (2212, 28, 'Catherine', 8.44), (2213, 47, 'Dave', 8.81), (2214, 16, 'Eva', 9.18), (2215, 35, 'Frank', 9.55), (2216, 4, 'Grace', 9.92), (2217, 23, 'Henry', 0.29), (2218, 42, 'Irene', 0.66), (2219, 11, 'Jack', 1.03), (2220, 30, 'Alice', 1.40), (2221, 49, 'Bob', 1.77), (2222, 18, 'Catherine', 2.14), (2223, 37, 'Dave', 2.51), (2224, 6, 'Eva', 2.88), (2225, 25, 'Frank', 3.25), (2226, 44, 'Grace', 3.62), (2227, 13, 'Henry', 3.99), (2228, 32, 'Irene', 4.36), (2229, 1, 'Jack', 4.73), (2230, 20, 'Alice', 5.10), (2231, 39, 'Bob', 5.47), (2232, 8, 'Catherine', 5.84), (2233, 27, 'Dave', 6.21), (2234, 46, 'Eva', 6.58), (2235, 15, 'Frank', 6.95), (2236, 34, 'Grace', 7.32), (2237, 3, 'Henry', 7.69), (2238, 22, 'Irene', 8.06), (2239, 41, 'Jack', 8.43), (2240, 10, 'Alice', 8.80), (2241, 29, 'Bob', 9.17), (2242, 48, 'Catherine', 9.54), (2243, 17, 'Dave', 9.91), (2244, 36, 'Eva', 0.28), (2245, 5, 'Frank', 0.65), (2246, 24, 'Grace', 1.02), (2247, 43, 'Henry', 1.39), (2248, 12, 'Irene', 1.76), (2249, 31, 'Jack', 2.13), (2250, 0, 'Alice', 2.50), (2251, 19, 'Bob', 2.87), (2252, 38, 'Catherine', 3.24), (2253, 7, 'Dave', 3.61), (2254, 26, 'Eva', 3.98), (2255, 45, 'Frank', 4.35), (2256, 14, 'Grace', 4.72), (2257, 33, 'Henry', 5.09), (2258, 2, 'Irene', 5.46), (2259, 21, 'Jack', 5.83), (2260, 40, 'Alice', 6.20), (2261, 9, 'Bob', 6.57), (2262, 28, 'Catherine', 6.94), (2263, 47, 'Dave', 7.31), (2264, 16, 'Eva', 7.68), (2265, 35, 'Frank', 8.05), (2266, 4, 'Grace', 8.42), (2267, 23, 'Henry', 8.79), (2268, 42, 'Irene', 9.16), (2269, 11, 'Jack', 9.53), (2270, 30, 'Alice', 9.90), (2271, 49, 'Bob', 0.27), (2272, 18, 'Catherine', 0.64), (2273, 37, 'Dave', 1.01), (2274, 6, 'Eva', 1.38), (2275, 25, 'Frank', 1.75), (2276, 44, 'Grace', 2.12), (2277, 13, 'Henry', 2.49), (2278, 32, 'Irene', 2.86), (2279, 1, 'Jack', 3.23), (2280, 20, 'Alice', 3.60), (2281, 39, 'Bob', 3.97), (2282, 8, 'Catherine', 4.34), (2283, 27, 'Dave', 4.71), (2284, 46, 'Eva', 5.08), (2285, 15, 'Frank', 5.45), (2286, 34, 'Grace', 5.82), (2287, 3, 'Henry', 6.19), (2288, 22, 'Irene', 6.56), (2289, 41, 'Jack', 6.93), (2290, 10, 'Alice', 7.30), (2291, 29, 'Bob', 7.67), (2292, 48, 'Catherine', 8.04), (2293, 17, 'Dave', 8.41), (2294, 36, 'Eva', 8.78), (2295, 5, 'Frank', 9.15), (2296, 24, 'Grace', 9.52), (2297, 43, 'Henry', 9.89), (2298, 12, 'Irene', 0.26), (2299, 31, 'Jack', 0.63), (2300, 0, 'Alice', 1.00);
+INSERT INTO t VALUES (2301, 19, 'Bob', 1.37), (2302, 38, 'Catherine', 1.74), (2303, 7, 'Dave', 2.11), (2304, 26, 'Eva', 2.48), (2305, 45, 'Frank', 2.85), (2306, 14, 'Grace', 3.22), (2307, 33, 'Henry', 3.59), (2308, 2, 'Irene', 3.96), (2309, 21, 'Jack', 4.33), (2310, 40, 'Alice', 4.70), (2311, 9, 'Bob', 5.07), (2312, 28, 'Catherine', 5.44), (2313, 47, 'Dave', 5.81), (2314, 16, 'Eva', 6.18), (2315, 35, 'Frank', 6.55), (2316, 4, 'Grace', 6.92), (2317, 23, 'Henry', 7.29), (2318, 42, 'Irene', 7.66), (2319, 11, 'Jack', 8.03), (2320, 30, 'Alice', 8.40), (2321, 49, 'Bob', 8.77), (2322, 18, 'Catherine', 9.14), (2323, 37, 'Dave', 9.51), (2324, 6, 'Eva', 9.88), (2325, 25, 'Frank', 0.25), (2326, 44, 'Grace', 0.62), (2327, 13, 'Henry', 0.99), (2328, 32, 'Irene', 1.36), (2329, 1, 'Jack', 1.73), (2330, 20, 'Alice', 2.10), (2331, 39, 'Bob', 2.47), (2332, 8, 'Catherine', 2.84), (2333, 27, 'Dave', 3.21), (2334, 46, 'Eva', 3.58), (2335, 15, 'Frank', 3.95), (2336, 34, 'Grace', 4.32), (2337, 3, 'Henry', 4.69), (2338, 22, 'Irene', 5.06), (2339, 41, 'Jack', 5.43), (2340, 10, 'Alice', 5.80), (2341, 29, 'Bob', 6.17), (2342, 48, 'Catherine', 6.54), (2343, 17, 'Dave', 6.91), (2344, 36, 'Eva', 7.28), (2345, 5, 'Frank', 7.65), (2346, 24, 'Grace', 8.02), (2347, 43, 'Henry', 8.39), (2348, 12, 'Irene', 8.76), (2349, 31, 'Jack', 9.13), (2350, 0, 'Alice', 9.50), (2351, 19, 'Bob', 9.87), (2352, 38, 'Catherine', 0.24), (2353, 7, 'Dave', 0.61), (2354, 26, 'Eva', 0.98), (2355, 45, 'Frank', 1.35), (2356, 14, 'Grace', 1.72), (2357, 33, 'Henry', 2.09), (2358, 2, 'Irene', 2.46), (2359, 21, 'Jack', 2.83), (2360, 40, 'Alice', 3.20), (2361, 9, 'Bob', 3.57), (2362, 28, 'Catherine', 3.94), (2363, 47, 'Dave', 4.31), (2364, 16, 'Eva', 4.68), (2365, 35, 'Frank', 5.05), (2366, 4, 'Grace', 5.42), (2367, 23, 'Henry', 5.79), (2368, 42, 'Irene', 6.16), (2369, 11, 'Jack', 6.53), (2370, 30, 'Alice', 6.90), (2371, 49, 'Bob', 7.27), (2372, 18, 'Catherine', 7.64), (2373, 37, 'Dave', 8.01), (2374, 6, 'Eva', 8.38), (2375, 25, 'Frank', 8.75), (2376, 44, 'Grace', 9.12), (2377, 13, 'Henry', 9.49), (2378, 32, 'Irene', 9.86), (2379, 1, 'Jack', 0.23), (2380, 20, 'Alice', 0.60), (2381, 39, 'Bob', 0.97), (2382, 8, 'Catherine', 1.34), (2383, 27, 'Dave', 1.71), (2384, 46, 'Eva', 2.08), (2385, 15, 'Frank', 2.45), (2386, 34, 'Grace', 2.82), (2387, 3, 'Henry', 3.19), (2388, 22, 'Irene', 3.56), (2389, 41, 'Jack', 3.93), (2390, 10, 'Alice', 4.30), (2391, 29, 'Bob', 4.67), (2392, 48, 'Catherine', 5.04), (2393, 17, 'Dave', 5.41), (2394, 36, 'Eva', 5.78), (2395, 5, 'Frank', 6.15), (2396, 24, 'Grace', 6.52), (2397, 43, 'Henry', 6.89), (2398, 12, 'Irene', 7.26), (2399, 31, 'Jack', 7.63), (2400, 0, 'Alice', 8.00);
+INSERT INTO t VALUES (2401, 19, 'Bob', 8.37), (2402, 38, 'Catherine', 8.74), (2403, 7, 'Dave', 9.11), (2404, 26, 'Eva', 9.48), (2405, 45, 'Frank', 9.85), (2406, 14, 'Grace', 0.22), (2407, 33, 'Henry', 0.59), (2408, 2, 'Irene', 0.96), (2409, 21, 'Jack', 1.33), (2410, 40, 'Alice', 1.70), (2411, 9, 'Bob', 2.07), (2412, 28, 'Catherine', 2.44), (2413, 47, 'Dave', 2.81), (2414, 16, 'Eva', 3.18), (2415, 35, 'Frank', 3.55), (2416, 4, 'Grace', 3.92), (2417, 23, 'Henry', 4.29), (2418, 42, 'Irene', 4.66), (2419, 11, 'Jack', 5.03), (2420, 30, 'Alice', 5.40), (2421, 49, 'Bob', 5.77), (2422, 18, 'Catherine', 6.14), (2423, 37, 'Dave', 6.51), (2424, 6, 'Eva', 6.88), (2425, 25, 'Frank', 7.25), (2426, 44, 'Grace', 7.62), (2427, 13, 'Henry', 7.99), (2428, 32, 'Irene', 8.36), (2429, 1, 'Jack', 8.73), (2430, 20, 'Alice', 9.10), (2431, 39, 'Bob', 9.47), (2432, 8, 'Catherine', 9.84), (2433, 27, 'Dave', 0.21), (2434, 46, 'Eva', 0.58), (2435, 15, 'Frank', 0.95), (2436, 34, 'Grace', 1.32), (2437, 3, 'Henry', 1.69), (2438, 22, 'Irene', 2.06), (2439, 41, 'Jack', 2.43), (2440, 10, 'Alice', 2.80), (2441, 29, 'Bob', 3.17), (2442, 48, 'Catherine', 3.54), (2443, 17, 'Dave', 3.91), (2444, 36, 'Eva', 4.28), (2445, 5, 'Frank', 4.65), (2446, 24, 'Grace', 5.02), (2447, 43, 'Henry', 5.39), (2448, 12, 'Irene', 5.76), (2449, 31, 'Jack', 6.13), (2450, 0, 'Alice', 6.50), (2451, 19, 'Bob', 6.87), (2452, 38, 'Catherine', 7.24), (2453, 7, 'Dave', 7.61), (2454, 26, 'Eva', 7.98), (2455, 45, 'Frank', 8.35), (2456, 14, 'Grace', 8.72), (2457, 33, 'Henry', 9.09), (2458, 2, 'Irene', 9.46), (2459, 21, 'Jack', 9.83), (2460, 40, 'Alice', 0.20), (2461, 9, 'Bob', 0.57), (2462, 28, 'Catherine', 0.94), (2463, 47, 'Dave', 1.31), (2464, 16, 'Eva', 1.68), (2465, 35, 'Frank', 2.05), (2466, 4, 'Grace', 2.42), (2467, 23, 'Henry', 2.79), (2468, 42, 'Irene', 3.16), (2469, 11, 'Jack', 3.53), (2470, 30, 'Alice', 3.90), (2471, 49, 'Bob', 4.27), (2472, 18, 'Catherine', 4.64), (2473, 37, 'Dave', 5.01), (2474, 6, 'Eva', 5.38), (2475, 25, 'Frank', 5.75), (2476, 44, 'Grace', 6.12), (2477, 13, 'Henry', 6.49), (2478, 32, 'Irene', 6.86), (2479, 1, 'Jack', 7.23), (2480, 20, 'Alice', 7.60), (2481, 39, 'Bob', 7.97), (2482, 8, 'Catherine', 8.34), (2483, 27, 'Dave', 8.71), (2484, 46, 'Eva', 9.08), (2485, 15, 'Frank', 9.45), (2486, 34, 'Grace', 9.82), (2487, 3, 'Henry', 0.19), (2488, 22, 'Irene', 0.56), (2489, 41, 'Jack', 0.93), (2490, 10, 'Alice', 1.30), (2491, 29, 'Bob', 1.67), (2492, 48, 'Catherine', 2.04), (2493, 17, 'Dave', 2.41), (2494, 36, 'Eva', 2.78), (2495, 5, 'Frank', 3.15), (2496, 24, 'Grace', 3.52), (2497, 43, 'Henry', 3.89), (2498, 12, 'Irene', 4.26), (2499, 31, 'Jack', 4.63), (2500, 0, 'Alice', 5.00);
+INSERT INTO t VALUES (2501, 19, 'Bob', 5.37), (2502, 38, 'Catherine', 5.74), (2503, 7, 'Dave', 6.11), (2504, 26, 'Eva', 6.48), (2505, 45, 'Frank', 6.85), (2506, 14, 'Grace', 7.22), (2507, 33, 'Henry', 7.59), (2508, 2, 'Irene', 7.96), (2509, 21, 'Jack', 8.33), (2510, 40, 'Alice', 8.70), (2511, 9, 'Bob', 9.07), (2512, 28, 'Catherine', 9.44), (2513, 47, 'Dave', 9.81), (2514, 16, 'Eva', 0.18), (2515, 35, 'Frank', 0.55), (2516, 4, 'Grace', 0.92), (2517, 23, 'Henry', 1.29), (2518, 42, 'Irene', 1.66), (2519, 11, 'Jack', 2.03), (2520, 30, 'Alice', 2.40), (2521, 49, 'Bob', 2.77), (2522, 18, 'Catherine', 3.14), (2523, 37, 'Dave', 3.51), (2524, 6, 'Eva', 3.88), (2525, 25, 'Frank', 4.25), (2526, 44, 'Grace', 4.62), (2527, 13, 'Henry', 4.99), (2528, 32, 'Irene', 5.36), (2529, 1, 'Jack', 5.73), (2530, 20, 'Alice', 6.10), (2531, 39, 'Bob', 6.47), (2532, 8, 'Catherine', 6.84), (2533, 27, 'Dave', 7.21), (2534, 46, 'Eva', 7.58), (2535, 15, 'Frank', 7.95), (2536, 34, 'Grace', 8.32), (2537, 3, 'Henry', 8.69), (2538, 22, 'Irene', 9.06), (2539, 41, 'Jack', 9.43), (2540, 10, 'Alice', 9.80), (2541, 29, 'Bob', 0.17), (2542, 48, 'Catherine', 0.54), (2543, 17, 'Dave', 0.91), (2544, 36, 'Eva', 1.28), (2545, 5, 'Frank', 1.65), (2546, 24, 'Grace', 2.02), (2547, 43, 'Henry', 2.39), (2548, 12, 'Irene', 2.76), (2549, 31, 'Jack', 3.13), (2550, 0, 'Alice', 3.50), (2551, 19, 'Bob', 3.87), (2552, 38, 'Catherine', 4.24), (2553, 7, 'Dave', 4.61), (2554, 26, 'Eva', 4.98), (2555, 45, 'Frank', 5.35), (2556, 14, 'Grace', 5.72), (2557, 33, 'Henry', 6.09), (2558, 2, 'Irene', 6.46), (2559, 21, 'Jack', 6.83), (2560, 40, 'Alice', 7.20), (2561, 9, 'Bob', 7.57), (2562, 28, 'Catherine', 7.94), (2563, 47, 'Dave', 8.31), (2564, 16, 'Eva', 8.68), (2565, 35, 'Frank', 9.05), (2566, 4, 'Grace', 9.42), (2567, 23, 'Henry', 9.79), (2568, 42, 'Irene', 0.16), (2569, 11, 'Jack', 0.53), (2570, 30, 'Alice', 0.90), (2571, 49, 'Bob', 1.27), (2572, 18, 'Catherine', 1.64), (2573, 37, 'Dave', 2.01), (2574, 6, 'Eva', 2.38), (2575, 25, 'Frank', 2.75), (2576, 44, 'Grace', 3.12), (2577, 13, 'Henry', 3.49), (2578, 32, 'Irene', 3.86), (2579, 1, 'Jack', 4.23), (2580, 20, 'Alice', 4.60), (2581, 39, 'Bob', 4.97), (2582, 8, 'Catherine', 5.34), (2583, 27, 'Dave', 5.71), (2584, 46, 'Eva', 6.08), (2585, 15, 'Frank', 6.45), (2586, 34, 'Grace', 6.82), (2587, 3, 'Henry', 7.19), (2588, 22, 'Irene', 7.56), (2589, 41, 'Jack', 7.93), (2590, 10, 'Alice', 8.30), (2591, 29, 'Bob', 8.67), (2592, 48, 'Catherine', 9.04), (2593, 17, 'Dave', 9.41), (2594, 36, 'Eva', 9.78), (2595, 5, 'Frank', 0.15), (2596, 24, 'Grace', 0.52), (2597, 43, 'Henry', 0.89), (2598, 12, 'Irene', 1.26), (2599, 31, 'Jack', 1.63), (2600, 0, 'Alice', 2.00);
+INSERT INTO t VALUES (2601, 19, 'Bob', 2.37), (2602, 38, 'Catherine', 2.74), (2603, 7, 'Dave', 3.11), (2604, 26, 'Eva', 3.48), (2605, 45, 'Frank', 3.85), (2606, 14, 'Grace', 4.22), (2607, 33, 'Henry', 4.59), (2608, 2, 'Irene', 4.96), (2609, 21, 'Jack', 5.33), (2610, 40, 'Alice', 5.70), (2611, 9, 'Bob', 6.07), (2612, 28, 'Catherine', 6.44), (2613, 47, 'Dave', 6.81), (2614, 16, 'Eva', 7.18), (2615, 35, 'Frank', 7.55), (2616, 4, 'Grace', 7.92), (2617, 23, 'Henry', 8.29), (2618, 42, 'Irene', 8.66), (2619, 11, 'Jack', 9.03), (2620, 30, 'Alice', 9.40), (2621, 49, 'Bob', 9.77), (2622, 18, 'Catherine', 0.14), (2623, 37, 'Dave', 0.51), (2624, 6, 'Eva', 0.88), (2625, 25, 'Frank', 1.25), (2626, 44, 'Grace', 1.62), (2627, 13, 'Henry', 1.99), (2628, 32, 'Irene', 2.36), (2629, 1, 'Jack', 2.73), (2630, 20, 'Alice', 3.10), (2631, 39, 'Bob', 3.47), (2632, 8, 'Catherine', 3.84), (2633, 27, 'Dave', 4.21), (2634, 46, 'Eva', 4.58), (2635, 15, 'Frank', 4.95), (2636, 34, 'Grace', 5.32), (2637, 3, 'Henry', 5.69), (2638, 22, 'Irene', 6.06), (2639, 41, 'Jack', 6.43), (2640, 10, 'Alice', 6.80), (2641, 29, 'Bob', 7.17), (2642, 48, 'Catherine', 7.54), (2643, 17, 'Dave', 7.91), (2644, 36, 'Eva', 8.28), (2645, 5, 'Frank', 8.65), (2646, 24, 'Grace', 9.02), (2647, 43, 'Henry', 9.39), (2648, 12, 'Irene', 9.76), (2649, 31, 'Jack', 0.13), (2650, 0, 'Alice', 0.50), (2651, 19, 'Bob', 0.87), (2652, 38, 'Catherine', 1.24), (2653, 7, 'Dave', 1.61), (2654, 26, 'Eva', 1.98), (2655, 45, 'Frank', 2.35), (2656, 14, 'Grace', 2.72), (2657, 33, 'Henry', 3.09), (2658, 2, 'Irene', 3.46), (2659, 21, 'Jack', 3.83), (2660, 40, 'Alice', 4.20), (2661, 9, 'Bob', 4.57), (2662, 28, 'Catherine', 4.94), (2663, 47, 'Dave', 5.31), (2664, 16, 'Eva', 5.68), (2665, 35, 'Frank', 6.05), (2666, 4, 'Grace', 6.42), (2667, 23, 'Henry', 6.79), (2668, 42, 'Irene', 7.16), (2669, 11, 'Jack', 7.53), (2670, 30, 'Alice', 7.90), (2671, 49, 'Bob', 8.27), (2672, 18, 'Catherine', 8.64), (2673, 37, 'Dave', 9.01), (2674, 6, 'Eva', 9.38), (2675, 25, 'Frank', 9.75), (2676, 44, 'Grace', 0.12), (2677, 13, 'Henry', 0.49), (2678, 32, 'Irene', 0.86), (2679, 1, 'Jack', 1.23), (2680, 20, 'Alice', 1.60), (2681, 39, 'Bob', 1.97), (2682, 8, 'Catherine', 2.34), (2683, 27, 'Dave', 2.71), (2684, 46, 'Eva', 3.08), (2685, 15, 'Frank', 3.45), (2686, 34, 'Grace', 3.82), (2687, 3, 'Henry', 4.19), (2688, 22, 'Irene', 4.56), (2689, 41, 'Jack', 4.93), (2690, 10, 'Alice', 5.30), (2691, 29, 'Bob', 5.67), (2692, 48, 'Catherine', 6.04), (2693, 17, 'Dave', 6.41), (2694, 36, 'Eva', 6.78), (2695, 5, 'Frank', 7.15), (2696, 24, 'Grace', 7.52), (2697, 43, 'Henry', 7.89), (2698, 12, 'Irene', 8.26), (2699, 31, 'Jack', 8.63), (2700, 0, 'Alice', 9.00);
+INSERT INTO t VALUES (2701, 19, 'Bob', 9.37), (2702, 38, 'Catherine', 9.74), (2703, 7, 'Dave', 0.11), (2704, 26, 'Eva', 0.48), (2705, 45, 'Frank', 0.85), (2706, 14, 'Grace', 1.22), (2707, 33, 'Henry', 1.59), (2708, 2, 'Irene', 1.96), (2709, 21, 'Jack', 2.33), (2710, 40, 'Alice', 2.70), (2711, 9, 'Bob', 3.07), (2712, 28, 'Catherine', 3.44), (2713, 47, 'Dave', 3.81), (2714, 16, 'Eva', 4.18), (2715, 35, 'Frank', 4.55), (2716, 4, 'Grace', 4.92), (2717, 23, 'Henry', 5.29), (2718, 42, 'Irene', 5.66), (2719, 11, 'Jack', 6.03), (2720, 30, 'Alice', 6.40), (2721, 49, 'Bob', 6.77), (2722, 18, 'Catherine', 7.14), (2723, 37, 'Dave', 7.51), (2724, 6, 'Eva', 7.88), (2725, 25, 'Frank', 8.25), (2726, 44, 'Grace', 8.62), (2727, 13, 'Henry', 8.99), (2728, 32, 'Irene', 9.36), (2729, 1, 'Jack', 9.73), (2730, 20, 'Alice', 0.10), (2731, 39, 'Bob', 0.47), (2732, 8, 'Catherine', 0.84), (2733, 27, 'Dave', 1.21), (2734, 46, 'Eva', 1.58), (2735, 15, 'Frank', 1.95), (2736, 34, 'Grace', 2.32), (2737, 3, 'Henry', 2.69), (2738, 22, 'Irene', 3.06), (2739, 41, 'Jack', 3.43), (2740, 10, 'Alice', 3.80), (2741, 29, 'Bob', 4.17), (2742, 48, 'Catherine', 4.54), (2743, 17, 'Dave', 4.91), (2744, 36, 'Eva', 5.28), (2745, 5, 'Frank', 5.65), (2746, 24, 'Grace', 6.02), (2747, 43, 'Henry', 6.39), (2748, 12, 'Irene', 6.76), (2749, 31, 'Jack', 7.13), (2750, 0, 'Alice', 7.50), (2751, 19, 'Bob', 7.87), (2752, 38, 'Catherine', 8.24), (2753, 7, 'Dave', 8.61), (2754, 26, 'Eva', 8.98), (2755, 45, 'Frank', 9.35), (2756, 14, 'Grace', 9.72), (2757, 33, 'Henry', 0.09), (2758, 2, 'Irene', 0.46), (2759, 21, 'Jack', 0.83), (2760, 40, 'Alice', 1.20), (2761, 9, 'Bob', 1.57), (2762, 28, 'Catherine', 1.94), (2763, 47, 'Dave', 2.31), (2764, 16, 'Eva', 2.68), (2765, 35, 'Frank', 3.05), (2766, 4, 'Grace', 3.42), (2767, 23, 'Henry', 3.79), (2768, 42, 'Irene', 4.16), (2769, 11, 'Jack', 4.53), (2770, 30, 'Alice', 4.90), (2771, 49, 'Bob', 5.27), (2772, 18, 'Catherine', 5.64), (2773, 37, 'Dave', 6.01), (2774, 6, 'Eva', 6.38), (2775, 25, 'Frank', 6.75), (2776, 44, 'Grace', 7.12), (2777, 13, 'Henry', 7.49), (2778, 32, 'Irene', 7.86), (2779, 1, 'Jack', 8.23), (2780, 20, 'Alice', 8.60), (2781, 39, 'Bob', 8.97), (2782, 8, 'Catherine', 9.34), (2783, 27, 'Dave', 9.71), (2784, 46, 'Eva', 0.08), (2785, 15, 'Frank', 0.45), (2786, 34, 'Grace', 0.82), (2787, 3, 'Henry', 1.19), (2788, 22, 'Irene', 1.56), (2789, 41, 'Jack', 1.93), (2790, 10, 'Alice', 2.30), (2791, 29, 'Bob', 2.67), (2792, 48, 'Catherine', 3.04), (2793, 17, 'Dave', 3.41), (2794, 36, 'Eva', 3.78), (2795, 5, 'Frank', 4.15), (2796, 24, 'Grace', 4.52), (2797, 43, 'Henry', 4.89), (2798, 12, 'Irene', 5.26), (2799, 31, 'Jack', 5.63), (2800, 0, 'Alice', 6.00);
+INSERT INTO t VALUES (2801, 19, 'Bob', 6.37), (2802, 38, 'Catherine', 6.74), (2803, 7, 'Dave', 7.11), (2804, 26, 'Eva', 7.48), (2805, 45, 'Frank', 7.85), (2806, 14, 'Grace', 8.22), (2807, 33, 'Henry', 8.59), (2808, 2, 'Irene', 8.96), (2809, 21, 'Jack', 9.33), (2810, 40, 'Alice', 9.70), (2811, 9, 'Bob', 0.07), (2812, 28, 'Catherine', 0.44), (2813, 47, 'Dave', 0.81), (2814, 16, 'Eva', 1.18), (2815, 35, 'Frank', 1.55), (2816, 4, 'Grace', 1.92), (2817, 23, 'Henry', 2.29), (2818, 42, 'Irene', 2.66), (2819, 11, 'Jack', 3.03), (2820, 30, 'Alice', 3.40), (2821, 49, 'Bob', 3.77), (2822, 18, 'Catherine', 4.14), (2823, 37, 'Dave', 4.51), (2824, 6, 'Eva', 4.88), (2825, 25, 'Frank', 5.25), (2826, 44, 'Grace', 5.62), (2827, 13, 'Henry', 5.99), (2828, 32, 'Irene', 6.36), (2829, 1, 'Jack', 6.73), (2830, 20, 'Alice', 7.10), (2831, 39, 'Bob', 7.47), (2832, 8, 'Catherine', 7.84), (2833, 27, 'Dave', 8.21), (2834, 46, 'Eva', 8.58), (2835, 15, 'Frank', 8.95), (2836, 34, 'Grace', 9.32), (2837, 3, 'Henry', 9.69), (2838, 22, 'Irene', 0.06), (2839, 41, 'Jack', 0.43), (2840, 10, 'Alice', 0.80), (2841, 29, 'Bob', 1.17), (2842, 48, 'Catherine', 1.54), (2843, 17, 'Dave', 1.91), (2844, 36, 'Eva', 2.28), (2845, 5, 'Frank', 2.65), (2846, 24, 'Grace', 3.02), (2847, 43, 'Henry', 3.39), (2848, 12, 'Irene', 3.76), (2849, 31, 'Jack', 4.13), (2850, 0, 'Alice', 4.50), (2851, 19, 'Bob', 4.87), (2852, 38, 'Catherine', 5.24), (2853, 7, 'Dave', 5.61), (2854, 26, 'Eva', 5.98), (2855, 45, 'Frank', 6.35), (2856, 14, 'Grace', 6.72), (2857, 33, 'Henry', 7.09), (2858, 2, 'Irene', 7.46), (2859, 21, 'Jack', 7.83), (2860, 40, 'Alice', 8.20), (2861, 9, 'Bob', 8.57), (2862, 28, 'Catherine', 8.94), (2863, 47, 'Dave', 9.31), (2864, 16, 'Eva', 9.68), (2865, 35, 'Frank', 0.05), (2866, 4, 'Grace', 0.42), (2867, 23, 'Henry', 0.79), (2868, 42, 'Irene', 1.16), (2869, 11, 'Jack', 1.53), (2870, 30, 'Alice', 1.90), (2871, 49, 'Bob', 2.27), (2872, 18, 'Catherine', 2.64), (2873, 37, 'Dave', 3.01), (2874, 6, 'Eva', 3.38), (2875, 25, 'Frank', 3.75), (2876, 44, 'Grace', 4.12), (2877, 13, 'Henry', 4.49), (2878, 32, 'Irene', 4.86), (2879, 1, 'Jack', 5.23), (2880, 20, 'Alice', 5.60), (2881, 39, 'Bob', 5.97), (2882, 8, 'Catherine', 6.34), (2883, 27, 'Dave', 6.71), (2884, 46, 'Eva', 7.08), (2885, 15, 'Frank', 7.45), (2886, 34, 'Grace', 7.82), (2887, 3, 'Henry', 8.19), (2888, 22, 'Irene', 8.56), (2889, 41, 'Jack', 8.93), (2890, 10, 'Alice', 9.30), (2891, 29, 'Bob', 9.67), (2892, 48, 'Catherine', 0.04), (2893, 17, 'Dave', 0.41), (2894, 36, 'Eva', 0.78), (2895, 5, 'Frank', 1.15), (2896, 24, 'Grace', 1.52), (2897, 43, 'Henry', 1.89), (2898, 12, 'Irene', 2.26), (2899, 31, 'Jack', 2.63), (2900, 0, 'Alice', 3.00);
+INSERT INTO t VALUES (2901, 19, 'Bob', 3.37), (2902, 38, 'Catherine', 3.74), (2903, 7, 'Dave', 4.11), (2904, 26, 'Eva', 4.48), (2905, 45, 'Frank', 4.85), (2906, 14, 'Grace', 5.22), (2907, 33, 'Henry', 5.59), (2908, 2, 'Irene', 5.96), (2909, 21, 'Jack', 6.33), (2910, 40, 'Alice', 6.70), (2911, 9, 'Bob', 7.07), (2912, 28, 'Catherine', 7.44), (2913, 47, 'Dave', 7.81), (2914, 16, 'Eva', 8.18), (2915, 35, 'Frank', 8.55), (2916, 4, 'Grace', 8.92), (2917, 23, 'Henry', 9.29), (2918, 42, 'Irene', 9.66), (2919, 11, 'Jack', 0.03), (2920, 30, 'Alice', 0.40), (2921, 49, 'Bob', 0.77), (2922, 18, 'Catherine', 1.14), (2923, 37, 'Dave', 1.51), (2924, 6, 'Eva', 1.88), (2925, 25, 'Frank', 2.25), (2926, 44, 'Grace', 2.62), (2927, 13, 'Henry', 2.99), (2928, 32, 'Irene', 3.36), (2929, 1, 'Jack', 3.73), (2930, 20, 'Alice', 4.10), (2931, 39, 'Bob', 4.47), (2932, 8, 'Catherine', 4.84), (2933, 27, 'Dave', 5.21), (2934, 46, 'Eva', 5.58), (2935, 15, 'Frank', 5.95), (2936, 34, 'Grace', 6.32), (2937, 3, 'Henry', 6.69), (2938, 22, 'Irene', 7.06), (2939, 41, 'Jack', 7.43), (2940, 10, 'Alice', 7.80), (2941, 29, 'Bob', 8.17), (2942, 48, 'Catherine', 8.54), (2943, 17, 'Dave', 8.91), (2944, 36, 'Eva', 9.28), (2945, 5, 'Frank', 9.65), (2946, 24, 'Grace', 0.02), (2947, 43, 'Henry', 0.39), (2948, 12, 'Irene', 0.76), (2949, 31, 'Jack', 1.13), (2950, 0, 'Alice', 1.50), (2951, 19, 'Bob', 1.87), (2952, 38, 'Catherine', 2.24), (2953, 7, 'Dave', 2.61), (2954, 26, 'Eva', 2.98), (2955, 45, 'Frank', 3.35), (2956, 14, 'Grace', 3.72), (2957, 33, 'Henry', 4.09), (2958, 2, 'Irene', 4.46), (2959, 21, 'Jack', 4.83), (2960, 40, 'Alice', 5.20), (2961, 9, 'Bob', 5.57), (2962, 28, 'Catherine', 5.94), (2963, 47, 'Dave', 6.31), (2964, 16, 'Eva', 6.68), (2965, 35, 'Frank', 7.05), (2966, 4, 'Grace', 7.42), (2967, 23, 'Henry', 7.79), (2968, 42, 'Irene', 8.16), (2969, 11, 'Jack', 8.53), (2970, 30, 'Alice', 8.90), (2971, 49, 'Bob', 9.27), (2972, 18, 'Catherine', 9.64), (2973, 37, 'Dave', 0.01), (2974, 6, 'Eva', 0.38), (2975, 25, 'Frank', 0.75), (2976, 44, 'Grace', 1.12), (2977, 13, 'Henry', 1.49), (2978, 32, 'Irene', 1.86), (2979, 1, 'Jack', 2.23), (2980, 20, 'Alice', 2.60), (2981, 39, 'Bob', 2.97), (2982, 8, 'Catherine', 3.34), (2983, 27, 'Dave', 3.71), (2984, 46, 'Eva', 4.08), (2985, 15, 'Frank', 4.45), (2986, 34, 'Grace', 4.82), (2987, 3, 'Henry', 5.19), (2988, 22, 'Irene', 5.56), (2989, 41, 'Jack', 5.93), (2990, 10, 'Alice', 6.30), (2991, 29, 'Bob', 6.67), (2992, 48, 'Catherine', 7.04), (2993, 17, 'Dave', 7.41), (2994, 36, 'Eva', 7.78), (2995, 5, 'Frank', 8.15), (2996, 24, 'Grace', 8.52), (2997, 43, 'Henry', 8.89), (2998, 12, 'Irene', 9.26), (2999, 31, 'Jack', 9.63), (3000, 0, 'Alice', 0.00);
+-- 小结果直接全排序；相同的键保持表中的顺序
+SELECT ID, F, Name FROM t WHERE ID < 16 ORDER BY F DESC;
+SELECT ID, V, Name FROM t WHERE ID < 16 ORDER BY Name, V DESC;
+-- OFFSET + LIMIT 不超过 1024 行时用堆保留最好的行，超过时全排序；两者的前 4 行相同
+SELECT ID, V, F FROM t ORDER BY V, F DESC LIMIT 4 OFFSET 1020;
+SELECT ID, V, F FROM t ORDER BY V, F DESC LIMIT 5 OFFSET 1020;
+SELECT ID, V FROM t ORDER BY V DESC, ID LIMIT 5;
+SELECT ID, V, Name FROM t ORDER BY V LIMIT 6 OFFSET 2000;
+-- 排序内存很小时每 1024 行写出一个有序段再归并，结果与内存中排序相同
+SET SORT_MEMORY = 1;
+SELECT ID, V, F FROM t ORDER BY V, F DESC LIMIT 4 OFFSET 1020;
+SELECT ID, V, F FROM t ORDER BY V, F DESC LIMIT 5 OFFSET 1020;
+SELECT ID, V FROM t ORDER BY V DESC, ID LIMIT 5;
+SELECT ID, V, Name FROM t ORDER BY V LIMIT 6 OFFSET 2000;
+SELECT ID, Name, F FROM t WHERE V = 7 ORDER BY Name DESC, F;
+SELECT ID FROM t ORDER BY F, ID DESC LIMIT 3 OFFSET 2997;
+SELECT ID FROM t ORDER BY F LIMIT 3 OFFSET 3000;
+SET SORT_MEMORY = 67108864;
+-- 聚合结果按分组列或聚合值排序
+SELECT V, COUNT(*), MAX(F) FROM t GROUP BY V ORDER BY COUNT(*) DESC, V LIMIT 3;
+SELECT Name, COUNT(*) FROM t WHERE V < 10 GROUP BY Name ORDER BY Name DESC LIMIT 4 OFFSET 1;
+-- 错误：排序列不存在
+SELECT ID FROM t ORDER BY Missing;
@@ -0,0 +1,33 @@
+CREATE DATABASE prepared_db;
+USE DATABASE prepared_db;
+CREATE TABLE student (
+    ID INTEGER,
+    Name TEXT,
+    GPA FLOAT,
+    Major TEXT
+);
+PREPARE add_student AS INSERT INTO student VALUES (?, ?, ?, ?);
+EXECUTE add_student (1, 'Alice Johnson', 3.5, 'Computer Science');
+EXECUTE add_student (2, 'Bob Smith', 3.6, 'Mathematics');
+EXECUTE add_student (3, 'Catherine Lee', 3.9, 'Mathematics');
+PREPARE by_id AS SELECT * FROM student WHERE ID = ?;
+EXECUTE by_id (2);
+EXECUTE by_id (3);
+PREPARE by_major AS SELECT Name FROM student WHERE Major = ? AND GPA > ?;
+EXECUTE by_major ('Mathematics', 3.7);
+EXECUTE by_major ('Mathematics', 3.0);
+PREPARE raise AS UPDATE student SET GPA = ? WHERE ID = ?;
+EXECUTE raise (4.0, 1);
+-- 参数个数不符时不执行
+EXECUTE raise (3.0);
+EXECUTE missing (1);
+-- 建表会使缓存的计划失效，准备好的语句重新解析后照常执行
+CREATE TABLE course (
+    CourseID INTEGER,
+    CourseName TEXT
+);
+EXECUTE by_id (1);
+-- 只有常量不同的语句共享计划
+SELECT Name FROM student WHERE ID = 1;
+SELECT Name FROM student WHERE ID = 3;
+SELECT Name FROM student WHERE ID = 5;
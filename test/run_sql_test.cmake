@@ -0,0 +1,24 @@
+# 在空目录中用 minidb 执行 NAME.sql，把生成的 output.csv 与 EXPECTED 逐字节比较
+# 用法：cmake -DMINIDB=<minidb> -DSOURCE_DIR=<test 目录> -DNAME=<脚本名> -DEXPECTED=<期望输出>
+#             -DWORK_DIR=<运行目录> [-DINPUTS=<脚本读取的文件;...>] -P run_sql_test.cmake
+foreach(variable MINIDB SOURCE_DIR NAME EXPECTED WORK_DIR)
+    if(NOT DEFINED ${variable})
+        message(FATAL_ERROR "run_sql_test.cmake: ${variable} is not set")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+foreach(input ${NAME}.sql ${INPUTS})
+    configure_file(${SOURCE_DIR}/${input} ${WORK_DIR}/${input} COPYONLY)
+endforeach()
+
+execute_process(COMMAND ${MINIDB} ${NAME} WORKING_DIRECTORY ${WORK_DIR} RESULT_VARIABLE result ERROR_VARIABLE errors)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "minidb ${NAME} exited with ${result}\n${errors}")
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK_DIR}/output.csv ${SOURCE_DIR}/${EXPECTED} RESULT_VARIABLE different)
+if(different)
+    file(READ ${WORK_DIR}/output.csv actual)
+    message(FATAL_ERROR "output.csv differs from ${EXPECTED}:\n${actual}\nstandard error:\n${errors}")
+endif()
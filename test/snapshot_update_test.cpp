@@ -0,0 +1,64 @@
+// 回归测试：打开快照读者之后，多线程 UPDATE 修改的行落在同一个被快照共享的段中时不能丢失修改
+#include "data_manager.hpp"
+#include "snapshot.hpp"
+#include <iostream>
+#include <string>
+
+namespace
+{
+    const int ROWS = 400000;
+    const int BATCH = 1000;
+
+    // 函数 countOf 执行一条 COUNT(*) 查询并返回结果，出错时返回 -1
+    template <typename Engine>
+    int64_t countOf(Engine &engine, const std::string &sql)
+    {
+        ResultCursor cursor = engine.query(sql);
+        ResultBatch batch;
+        if (!cursor.ok() || !cursor.next(batch) || batch.size() != 1)
+        {
+            std::cerr << sql << ": " << cursor.error() << std::endl;
+            return -1;
+        }
+        return batch.intAt(0, 0);
+    }
+
+    bool expect(const char *what, int64_t actual, int64_t expected)
+    {
+        if (actual == expected)
+            return true;
+        std::cerr << what << ": expected " << expected << ", got " << actual << std::endl;
+        return false;
+    }
+}
+
+int main()
+{
+    MiniDB db;
+    db.run("SET WAL_SYNC = OFF;");
+    db.run("SET THREADS = 8;");
+    db.run("CREATE DATABASE snapshot_update;");
+    db.run("USE DATABASE snapshot_update;");
+    db.run("DROP TABLE t;");
+    db.run("CREATE TABLE t (ID INTEGER, V INTEGER);");
+    for (int first = 0; first < ROWS; first += BATCH)
+    {
+        std::string insert = "INSERT INTO t VALUES ";
+        for (int id = first; id < first + BATCH; ++id)
+            insert += (id > first ? ", (" : "(") + std::to_string(id) + ", 0)";
+        db.run(insert);
+    }
+
+    // 读者使各段被快照共享，之后的 UPDATE 要先复制段再修改
+    std::unique_ptr<SnapshotReader> reader = db.openReader();
+    if (!reader)
+        return 1;
+    bool ok = expect("rows before update", countOf(*reader, "SELECT COUNT(*) FROM t WHERE V = 0"), ROWS);
+    db.run("UPDATE t SET V = V + 1 WHERE ID > 999;");
+    ok = expect("writer after update", countOf(db, "SELECT COUNT(*) FROM t WHERE V = 1"), ROWS - 1000) && ok;
+    ok = expect("reader after update", countOf(*reader, "SELECT COUNT(*) FROM t WHERE V = 1"), ROWS - 1000) && ok;
+    ok = expect("untouched rows", countOf(db, "SELECT COUNT(*) FROM t WHERE V = 0"), 1000) && ok;
+    reader.reset();
+    db.run("DROP TABLE t;");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+CREATE DATABASE transaction_db;
+USE DATABASE transaction_db;
+CREATE TABLE student (
+    ID INTEGER,
+    Name TEXT,
+    GPA FLOAT,
+    Major TEXT
+);
+CREATE INDEX student_id ON student(ID);
+CREATE INDEX student_gpa ON student(GPA) USING BTREE;
+INSERT INTO student VALUES (1, 'Alice Johnson', 3.5, 'Computer Science'), (2, 'Bob Smith', 3.6, 'Mathematics'), (3, 'Catherine Lee', 3.9, 'Mathematics'), (4, 'Dave Brown', 3.2, 'Physics');
+-- 事务中的语句看得到自己的修改
+BEGIN;
+UPDATE student SET GPA = 2.0 WHERE Major = 'Mathematics';
+UPDATE student SET Major = 'History' WHERE ID = 1;
+DELETE FROM student WHERE ID = 4;
+INSERT INTO student VALUES (5, 'Eva White', 3.8, 'Chemistry');
+SELECT * FROM student;
+SELECT Name FROM student WHERE GPA < 2.5;
+-- 事务中不能切换数据库或压缩表
+USE DATABASE transaction_db;
+VACUUM student;
+BEGIN;
+-- 回滚恢复被修改和删除的行，去掉插入的行，索引随之恢复
+ROLLBACK;
+SELECT * FROM student;
+SELECT * FROM student WHERE ID = 4;
+SELECT * FROM student WHERE ID = 5;
+SELECT Name FROM student WHERE GPA > 3.55 AND GPA < 4.0;
+SELECT Name FROM student WHERE GPA < 2.5;
+-- 表的创建和删除也能回滚
+BEGIN TRANSACTION;
+CREATE TABLE course (
+    CourseID INTEGER,
+    CourseName TEXT
+);
+INSERT INTO course VALUES (101, 'Linear Algebra');
+DROP TABLE student;
+SELECT * FROM student;
+ROLLBACK;
+-- 回滚后 course 不存在，可以重新建立，之前插入的行不会出现
+CREATE TABLE course (
+    CourseID INTEGER,
+    CourseName TEXT
+);
+INSERT INTO course VALUES (102, 'Quantum Mechanics');
+SELECT * FROM course;
+SELECT * FROM student WHERE ID = 3;
+SELECT COUNT(*) FROM student;
+-- 提交后修改保留，之后的回滚不影响已提交的修改
+BEGIN;
+UPDATE student SET GPA = 4.0 WHERE ID = 2;
+DELETE FROM student WHERE ID = 1;
+COMMIT;
+BEGIN;
+UPDATE student SET GPA = 1.0 WHERE ID = 2;
+DELETE FROM student WHERE ID = 3;
+ROLLBACK;
+SELECT * FROM student;
+SELECT * FROM student WHERE ID = 1;
+SELECT Name FROM student WHERE GPA > 3.95;
+-- 建立和删除索引会保存数据库，事务中不能执行；回滚后删除和修改的行照常恢复
+CREATE TABLE t (ID INTEGER, Name TEXT);
+INSERT INTO t VALUES (1, 'a'), (2, 'b'), (3, 'c');
+BEGIN;
+DELETE FROM t WHERE ID = 1;
+UPDATE t SET Name = 'zz' WHERE ID = 3;
+CREATE INDEX t_id ON t(ID);
+DROP INDEX student_id;
+ROLLBACK;
+SELECT * FROM t;
+SELECT * FROM student WHERE ID = 2;
+-- 没有事务时 COMMIT 和 ROLLBACK 报错
+COMMIT;
+ROLLBACK;
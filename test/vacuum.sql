@@ -0,0 +1,39 @@
+CREATE DATABASE vacuum_db;
+USE DATABASE vacuum_db;
+SET VACUUM_THRESHOLD = 0;
+CREATE TABLE student (
+    ID INTEGER,
+    Name TEXT,
+    GPA FLOAT,
+    Major TEXT
+);
+CREATE INDEX student_id ON student(ID);
+CREATE INDEX student_gpa ON student(GPA) USING BTREE;
+INSERT INTO student VALUES (1, 'Alice Johnson', 3.5, 'Computer Science'), (2, 'Bob Smith', 3.6, 'Mathematics'), (3, 'Catherine Lee', 3.9, 'Mathematics'), (4, 'Dave Brown', 3.2, 'Physics'), (5, 'Eva White', 3.8, 'Chemistry'), (6, 'Frank Miller', 2.9, 'History');
+-- 删除只标记行，扫描、索引查找和范围查询都跳过这些行
+DELETE FROM student WHERE ID = 2;
+DELETE FROM student WHERE GPA < 3.3;
+SELECT * FROM student;
+SELECT * FROM student WHERE ID = 2;
+SELECT Name FROM student WHERE GPA > 3.4 AND GPA < 4.0;
+SELECT COUNT(*) FROM student;
+-- VACUUM 压缩各列并重建索引，结果不变
+VACUUM student;
+SELECT * FROM student;
+SELECT * FROM student WHERE ID = 5;
+SELECT Name FROM student WHERE GPA > 3.4 AND GPA < 4.0;
+SELECT COUNT(*) FROM student;
+-- 压缩后新插入的行照常使用索引
+INSERT INTO student VALUES (7, 'Grace Davis', 3.7, 'Mathematics');
+DELETE FROM student WHERE Major = 'Computer Science';
+VACUUM;
+SELECT * FROM student;
+SELECT Name FROM student WHERE ID = 7;
+SELECT Name FROM student WHERE GPA > 3.6 AND GPA < 3.85;
+-- 删除的行达到阈值时自动压缩
+SET VACUUM_THRESHOLD = 50;
+DELETE FROM student WHERE ID = 3;
+DELETE FROM student WHERE ID = 5;
+SELECT * FROM student;
+SELECT * FROM student WHERE ID = 7;
+VACUUM missing_table;